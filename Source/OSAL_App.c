@@ -15,32 +15,58 @@
 #include "commissioning.h"
 #include "factory_reset.h"
 #include "Debug.h"
+#include "mem_stats.h"
+#include "task_profiler.h"
+#include "trace.h"
 
 #include "bdb_interface.h"
 #include "zcl_app.h"
 
-const pTaskEventHandlerFn tasksArr[] = {macEventLoop,
-                                        nwk_event_loop,
-                                        Hal_ProcessEvent,
+PROFILED_TASK_WRAPPER(macEventLoop)
+PROFILED_TASK_WRAPPER(nwk_event_loop)
+PROFILED_TASK_WRAPPER(Hal_ProcessEvent)
 #if defined( MT_TASK )
-                                        MT_ProcessEvent,
+PROFILED_TASK_WRAPPER(MT_ProcessEvent)
 #endif
-                                        APS_event_loop,
-                                        ZDApp_event_loop,
-                                        zcl_event_loop,
-                                        bdb_event_loop,
-                                        zclApp_event_loop,
-                                        zclCommissioning_event_loop,
-                                        zclFactoryResetter_loop};
+PROFILED_TASK_WRAPPER(APS_event_loop)
+PROFILED_TASK_WRAPPER(ZDApp_event_loop)
+PROFILED_TASK_WRAPPER(zcl_event_loop)
+PROFILED_TASK_WRAPPER(bdb_event_loop)
+PROFILED_TASK_WRAPPER(zclApp_event_loop)
+PROFILED_TASK_WRAPPER(zclCommissioning_event_loop)
+PROFILED_TASK_WRAPPER(zclFactoryResetter_loop)
+#if TRACE
+PROFILED_TASK_WRAPPER(zclTrace_event_loop)
+#endif
+
+const pTaskEventHandlerFn tasksArr[] = {PROFILED_TASK(macEventLoop),
+                                        PROFILED_TASK(nwk_event_loop),
+                                        PROFILED_TASK(Hal_ProcessEvent),
+#if defined( MT_TASK )
+                                        PROFILED_TASK(MT_ProcessEvent),
+#endif
+                                        PROFILED_TASK(APS_event_loop),
+                                        PROFILED_TASK(ZDApp_event_loop),
+                                        PROFILED_TASK(zcl_event_loop),
+                                        PROFILED_TASK(bdb_event_loop),
+                                        PROFILED_TASK(zclApp_event_loop),
+                                        PROFILED_TASK(zclCommissioning_event_loop),
+                                        PROFILED_TASK(zclFactoryResetter_loop)
+#if TRACE
+                                        ,
+                                        PROFILED_TASK(zclTrace_event_loop)
+#endif
+};
 
 const uint8 tasksCnt = sizeof(tasksArr) / sizeof(tasksArr[0]);
 uint16 *tasksEvents;
 
 void osalInitTasks(void) {
     uint8 taskID = 0;
+    zclMemStats_Init();
     DebugInit();
 
-    tasksEvents = (uint16 *)osal_mem_alloc(sizeof(uint16) * tasksCnt);
+    tasksEvents = (uint16 *)zclMemStats_Alloc(sizeof(uint16) * tasksCnt);
     osal_memset(tasksEvents, 0, (sizeof(uint16) * tasksCnt));
     macTaskInit(taskID++);
     nwk_init(taskID++);
@@ -55,6 +81,9 @@ void osalInitTasks(void) {
     zclApp_Init(taskID++);
     zclCommissioning_Init(taskID++);
     zclFactoryResetter_Init(taskID++);
+#if TRACE
+    zclTrace_Init(taskID++);
+#endif
 }
 
 /*********************************************************************
@@ -15,6 +15,9 @@
 #define ZCL_IDENTIFY
 #define ZCL_REPORTING_DEVICE
 #define ZCL_ELECTRICAL_MEASUREMENT
+#define ZCL_ON_OFF
+#define ZCL_ALARMS
+#define ZCL_DIAGNOSTIC
 
 #define DISABLE_GREENPOWER_BASIC_PROXY
 #define BDB_FINDING_BINDING_CAPABILITY_ENABLED 1
@@ -55,6 +58,16 @@
 
 #define FACTORY_RESET_HOLD_TIME_LONG 5000
 
+// heap use figures for the diagnostics attributes
+#define OSALMEM_METRICS TRUE
+
+// MAC / NWK / APS counters of the Diagnostics cluster
+#define FEATURE_SYSTEM_STATS
+
+
+// log verbosity, see Debug.h. Per module: LOG_LEVEL_APP, LOG_LEVEL_MERCURY, LOG_LEVEL_DS18B20,
+// LOG_LEVEL_COMMISSIONING, LOG_LEVEL_FACTORY_RESET
+// #define LOG_LEVEL LOG_LEVEL_WARN
 
 #ifdef DO_DEBUG_UART
     #define HAL_UART TRUE
@@ -64,6 +77,16 @@
 
 #define HAL_UART TRUE
 
+// binary trace over the debug UART, decode with trace_decode.py.
+// LREP text and the TASK_PROFILER dump are dropped while it owns the port.
+// #define TRACE TRUE
+
+// per task / event CPU time dumped to the debug UART every minute
+// #define TASK_PROFILER TRUE
+
+// external 24C256 on P0.5 (SCL) / P0.6 (SDA) for local history
+// #define EEPROM_LOG TRUE
+
 #define DS18B20_PORT 0
 #define TSENS_SBIT P0_0
 #define TSENS_BV BV(0)
@@ -7,6 +7,7 @@
 #include "ZDApp.h"
 #include "ZDObject.h"
 #include "math.h"
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -26,6 +27,7 @@
 
 #include "gp_interface.h"
 
+#define LOG_MODULE_LEVEL LOG_LEVEL_APP
 #include "Debug.h"
 
 #include "OnBoard.h"
@@ -33,7 +35,17 @@
 #include "commissioning.h"
 #include "factory_reset.h"
 
+#include "consumption.h"
 #include "ds18b20.h"
+#include "load_profile.h"
+#include "report_phase.h"
+#include "mem_stats.h"
+#include "eeprom_log.h"
+#include "trace.h"
+#if EEPROM_LOG
+#include "at24c.h"
+#include "hal_i2c.h"
+#endif
 
 /* HAL */
 #include "hal_drivers.h"
@@ -51,10 +63,70 @@
  * CONSTANTS
  */
 
+// ms, random delay of the poll after join / rejoin
+#define APP_CONNECT_MAX_DELAY 3000
+
+// intervals per GetProfileResponse, keeps the frame unfragmented
+#define APP_PROFILE_MAX_PERIODS 20
+
+#if LOAD_PROFILE_INTERVAL_MIN == 60
+    #define APP_PROFILE_INTERVAL_PERIOD 1
+#elif LOAD_PROFILE_INTERVAL_MIN == 30
+    #define APP_PROFILE_INTERVAL_PERIOD 2
+#elif LOAD_PROFILE_INTERVAL_MIN == 15
+    #define APP_PROFILE_INTERVAL_PERIOD 3
+#elif LOAD_PROFILE_INTERVAL_MIN == 10
+    #define APP_PROFILE_INTERVAL_PERIOD 4
+#elif LOAD_PROFILE_INTERVAL_MIN == 5
+    #define APP_PROFILE_INTERVAL_PERIOD 6
+#else
+    #error "LOAD_PROFILE_INTERVAL_MIN must be one of SE profile interval periods"
+#endif
+
 /*********************************************************************
  * TYPEDEFS
  */
 
+// last energy registers kept across reboots
+typedef struct {
+    energy_t Energies;
+    uint32 Utc; // reading time, 0 - read before the clock was synced
+} energyCheckpoint_t;
+
+// Utc of an item created at first boot or left erased, not a checkpoint
+#define APP_CHECKPOINT_NONE ((uint32)0xFFFFFFFF)
+
+// contiguous part of application_config_t stored in its own NV item
+typedef struct {
+    uint16 Id;
+    uint8 Offset;
+    uint8 Size;
+} appNvSection_t;
+
+#define APP_NV_SIZE(first, last)                                                                                                            \
+    (offsetof(application_config_t, last) + sizeof(((application_config_t *)0)->last) - offsetof(application_config_t, first))
+
+// order matches application_config_t, index is the bit in the changed mask
+#define APP_NV_SECTION_LIST(SECTION)                                                                                                        \
+    SECTION(NW_APP_CONFIG_METER, DeviceAddress, DeviceAddress)                                                                              \
+    SECTION(NW_APP_CONFIG_SCHEDULE, MeasurementPeriod, MaxAge)                                                                              \
+    SECTION(NW_APP_CONFIG_LOAD_LIMIT, LoadLimit, LoadLimit)                                                                                 \
+    SECTION(NW_APP_CONFIG_POWER_QUALITY, PowerQuality, PowerQuality)                                                                        \
+    SECTION(NW_APP_CONFIG_REPORT, ReportJitter, PollRate)
+
+#define APP_NV_SECTION(id, first, last) {id, offsetof(application_config_t, first), APP_NV_SIZE(first, last)},
+static const appNvSection_t zclApp_NvSections[] = {APP_NV_SECTION_LIST(APP_NV_SECTION)};
+
+// a member per section, NV buffers are sized by the largest one
+#define APP_NV_SECTION_BUF(id, first, last) uint8 first[APP_NV_SIZE(first, last)];
+typedef union {
+    APP_NV_SECTION_LIST(APP_NV_SECTION_BUF)
+} appNvSectionBuf_t;
+
+#define APP_NV_SECTION_POWER_QUALITY 3
+#define APP_NV_SECTIONS (sizeof(zclApp_NvSections) / sizeof(zclApp_NvSections[0]))
+#define APP_NV_SECTION_MAX_SIZE sizeof(appNvSectionBuf_t)
+
 /*********************************************************************
  * GLOBAL VARIABLES
  */
@@ -70,6 +142,48 @@ void user_delay_ms(uint32_t period) { MicroWait(period * 1000); }
  */
 static zclMercury_t const *mercury_dev = &mercury200_dev;
 
+static uint32 zclApp_ProfileBaseline = 0;
+
+static reportPhase_t zclApp_ReportPhase;
+
+static application_config_t zclApp_ConfigNV; // config as last written to NV
+static uint16 zclApp_NvSectionWrites[APP_NV_SECTIONS];
+
+static uint32 zclApp_CheckpointTime = 0; // ms, last checkpoint check, counted from boot
+static uint32 zclApp_ProfileEndTime = 0; // interval waiting for a fresh energy read, 0 - none
+
+// groups read by the running cycle, groups requested while it runs, groups it has read
+// successfully and groups to report to zclApp_PollRequester once read
+static uint8 zclApp_PollMask = APP_POLL_ALL;
+static uint8 zclApp_PollQueued = 0;
+static uint8 zclApp_PollDone = 0;
+static uint8 zclApp_PollReportMask = 0;
+static uint8 zclApp_BoundReportMask = 0; // groups reported to the bindings when the cycle ends
+// reports asked for, taken over by the next cycle reading the group. A running cycle may have
+// read it already, answering from it would send the values from before the request.
+static uint8 zclApp_PollReportWanted = 0;
+static uint8 zclApp_BoundReportWanted = 0;
+static afAddrType_t zclApp_PollRequester;
+// no destination address, APS sends to every device bound to the output cluster
+static afAddrType_t zclApp_BoundAddr = {.addrMode = (afAddrMode_t)AddrNotPresent, .endPoint = 0, .addr.shortAddr = 0};
+
+// group read by each zclApp_ReadSensors phase
+static const uint8 zclApp_PhaseGroup[] = {APP_POLL_INSTANTANEOUS, APP_POLL_INSTANTANEOUS, APP_POLL_ENERGY, APP_POLL_ENERGY,
+                                          APP_POLL_TEMPERATURE};
+
+// osal_GetSystemClock of the last successful read, 0 - never read
+static uint32 zclApp_CurrentValuesTime = 0;
+static uint32 zclApp_EnergiesTime = 0;
+static uint32 zclApp_TemperatureTime = 0;
+
+// timestamps of the Mercury request in flight, sleep timer ticks
+static latencyRequest_t *zclApp_PendingRequest = NULL;
+static uint32 zclApp_TxTime = 0;
+static uint32 zclApp_FirstRxTime = 0;
+static uint32 zclApp_FrameTime = 0;
+static bool zclApp_FirstRxSeen = false;
+static bool zclApp_FrameSeen = false;
+
 /*********************************************************************
  * LOCAL FUNCTIONS
  */
@@ -78,13 +192,42 @@ static ZStatus_t zclApp_ReadWriteAuthCB(afAddrType_t *srcAddr, zclAttrRec_t *pAt
 
 static void zclApp_RestoreAttributesFromNV(void);
 static void zclApp_SaveAttributesToNV(void);
+static void zclApp_WriteNvSection(uint8 index);
 
 static void zclApp_Report(void);
+static void zclApp_StartReportTimer(void);
+static void zclApp_ReschedulePeriod(void);
+static void zclApp_ArmReportTimer(uint32 delay);
+static void zclApp_StartPoll(uint8 mask);
 static void zclApp_ReadSensors(void);
+static void zclApp_ReadThrough(afAddrType_t *srcAddr, uint16 clusterId);
+static void zclApp_SendPollReports(uint8 mask);
+static void zclApp_SendGroupReports(afAddrType_t *dstAddr, uint8 groups);
+static void zclApp_OnNetworkUp(void);
+static void zclApp_RestoreCheckpoint(void);
+static void zclApp_RestoreLoadLimit(void);
+static void zclApp_SaveCheckpoint(void);
+static void zclApp_CheckLoadLimit(void);
+static void zclApp_CheckPowerQuality(uint8 events);
+static void zclApp_StartVoltageWatch(void);
+static void zclApp_SendReport(afAddrType_t *dstAddr, uint8 endpoint, uint16 clusterId, zclReport_t *attrs, uint8 count);
 
 static void zclApp_HandleKeys(byte portAndAction, byte keyCode);
 
 static void zclApp_InitMercuryUart(void);
+static void zclApp_MercuryUartCB(uint8 port, uint8 event);
+static void zclApp_StartRequestTiming(latencyRequest_t *request);
+static void zclApp_FinishRequestTiming(uint32 readStart, uint32 decoded);
+
+static void zclApp_StartLoadProfileTimer(uint32 after);
+static void zclApp_RecordLoadProfile(uint32 endTime);
+static uint32 *zclApp_Tiers(uint32 *tiers);
+#if EEPROM_LOG
+static void zclApp_LogSnapshot(void);
+#endif
+static ZStatus_t zclApp_MeteringPlugin(zclIncoming_t *pInMsg);
+static ZStatus_t zclApp_ProcessGetProfile(zclIncoming_t *pInMsg);
+static ZStatus_t zclApp_PollPlugin(zclIncoming_t *pInMsg);
 
 /*********************************************************************
  * ZCL General Profile Callback table
@@ -101,44 +244,68 @@ static zclGeneral_AppCallbacks_t zclApp_CmdCallbacks = {
 };
 
 void zclApp_Init(byte task_id) {
+    uint32 tiers[CONSUMPTION_TIERS];
+
     HalLedSet(HAL_LED_ALL, HAL_LED_MODE_BLINK);
 
     zclApp_RestoreAttributesFromNV();
+    zclDiagnostic_InitStats();
+    zclApp_RestoreCheckpoint();
+    zclApp_RestoreLoadLimit();
     zclApp_InitMercuryUart();
+    zclLoadProfile_Init();
+    zclConsumption_Init();
+    zclConsumption_Refresh(zclApp_Tiers(tiers));
+#if EEPROM_LOG
+    HalI2CInit();
+    zclEepromLog_Init(&at24c_dev);
+#endif
     zclApp_TaskID = task_id;
 
     bdb_RegisterSimpleDescriptor(&zclApp_FirstEP);
     zclGeneral_RegisterCmdCallbacks(zclApp_FirstEP.EndPoint, &zclApp_CmdCallbacks);
     zcl_registerAttrList(zclApp_FirstEP.EndPoint, zclApp_AttrsCount_FirstEP, zclApp_Attrs_FirstEP);
-    zcl_registerReadWriteCB(zclApp_FirstEP.EndPoint, NULL, zclApp_ReadWriteAuthCB);
+    zcl_registerReadWriteCB(zclApp_FirstEP.EndPoint, zclDiagnostic_ReadWriteAttrCB, zclApp_ReadWriteAuthCB);
     
     bdb_RegisterSimpleDescriptor(&zclApp_SecondEP);
     zclGeneral_RegisterCmdCallbacks(zclApp_SecondEP.EndPoint, &zclApp_CmdCallbacks);
     zcl_registerAttrList(zclApp_SecondEP.EndPoint, zclApp_AttrsCount_SecondEP, zclApp_Attrs_SecondEP);
     zcl_registerReadWriteCB(zclApp_SecondEP.EndPoint, NULL, zclApp_ReadWriteAuthCB);
     
+    zcl_registerPlugin(SE_METERING, SE_METERING, zclApp_MeteringPlugin);
+    zcl_registerPlugin(MERCURY_POLL, MERCURY_POLL, zclApp_PollPlugin);
     zcl_registerForMsg(zclApp_TaskID);
 
 
     RegisterForKeys(zclApp_TaskID);
+    zclCommissioning_RegisterConnectCB(zclApp_OnNetworkUp);
+    zclCommissioning_SetPollRate(zclApp_Config.PollRate);
 
-    LREP("Build %s \r\n", zclApp_DateCodeNT);
+    LOGI("Build %s \r\n", zclApp_DateCodeNT);
 
-    osal_start_reload_timer(zclApp_TaskID, APP_REPORT_EVT, zclApp_Config.MeasurementPeriod * 1000);
+    zclApp_StartReportTimer();
+    // load profile intervals start with the first time sync, boot time isn't a boundary
+    zclApp_StartVoltageWatch();
+    osal_start_timerEx(zclApp_TaskID, APP_TIME_SYNC_EVT, (uint32)TIME_SYNC_RETRY_SEC * 1000);
+    // first values right away, not a period after boot
+    zclApp_StartPoll(APP_POLL_ALL);
+#if EEPROM_LOG
+    osal_start_reload_timer(zclApp_TaskID, APP_EEPROM_LOG_EVT, (uint32)EEPROM_LOG_INTERVAL_MIN * 60 * 1000);
+#endif
 }
 
 static void zclApp_HandleKeys(byte portAndAction, byte keyCode) {
-    LREP("zclApp_HandleKeys portAndAction=0x%X keyCode=0x%X\r\n", portAndAction, keyCode);
+    LOGT("zclApp_HandleKeys portAndAction=0x%X keyCode=0x%X\r\n", portAndAction, keyCode);
     zclFactoryResetter_HandleKeys(portAndAction, keyCode);
     zclCommissioning_HandleKeys(portAndAction, keyCode);
     if (portAndAction & HAL_KEY_PRESS) {
-        LREPMaster("Key press\r\n");
+        LOGT("Key press\r\n");
         zclApp_Report();
     }
 }
 
 static void zclApp_InitMercuryUart(void) {
-    LREPMaster("Initializing Mercury UART \r\n");
+    LOGT("Initializing Mercury UART \r\n");
     halUARTCfg_t halUARTConfig;
     halUARTConfig.configured = TRUE;
     halUARTConfig.baudRate = HAL_UART_BR_9600;
@@ -149,25 +316,80 @@ static void zclApp_InitMercuryUart(void) {
     halUARTConfig.rx.maxBufSize = 15;
     halUARTConfig.tx.maxBufSize = 15;
     halUARTConfig.intEnable = TRUE;
-    halUARTConfig.callBackFunc = NULL;
+    halUARTConfig.callBackFunc = zclApp_MercuryUartCB;
     HalUARTInit();
     if (HalUARTOpen(MERCURY_PORT, &halUARTConfig) == HAL_UART_SUCCESS) {
-        LREPMaster("Initialized Mercury UART \r\n");
+        LOGI("Initialized Mercury UART \r\n");
+    }
+}
+
+static void zclApp_MercuryUartCB(uint8 port, uint8 event) {
+    if (zclApp_PendingRequest == NULL || zclApp_FrameSeen) {
+        return;
+    }
+    // HAL reports received data once the line is idle or the buffer fills,
+    // so the first RX stamp is the first notification with data in the buffer
+    uint32 now = zclLatency_Now();
+    if (!zclApp_FirstRxSeen && Hal_UART_RxBufLen(port)) {
+        zclApp_FirstRxTime = now;
+        zclApp_FirstRxSeen = true;
     }
+    if (event & HAL_UART_RX_TIMEOUT) {
+        zclApp_FrameTime = now;
+        zclApp_FrameSeen = true;
+    }
+}
+
+static void zclApp_StartRequestTiming(latencyRequest_t *request) {
+    zclApp_TxTime = zclLatency_Now();
+    zclApp_FirstRxSeen = false;
+    zclApp_FrameSeen = false;
+    zclApp_PendingRequest = request;
+}
+
+static void zclApp_FinishRequestTiming(uint32 readStart, uint32 decoded) {
+    latencyRequest_t *request = zclApp_PendingRequest;
+    uint32 queued = zclLatency_Now();
+
+    if (request == NULL) {
+        return;
+    }
+    request->FirstRx = zclApp_FirstRxSeen ? zclLatency_Between(zclApp_TxTime, zclApp_FirstRxTime) : 0;
+    request->Frame = zclApp_FrameSeen ? zclLatency_Between(zclApp_TxTime, zclApp_FrameTime) : 0;
+    request->Decode = zclLatency_Between(readStart, decoded);
+    request->Report = zclLatency_Between(decoded, queued);
+    zclLatency_Update(&request->Total, zclLatency_Between(zclApp_TxTime, queued));
+    zclApp_PendingRequest = NULL;
 }
 
 uint16 zclApp_event_loop(uint8 task_id, uint16 events) {
-    LREP("events 0x%x \r\n", events);
+    TRACE1(TRACE_APP_EVENTS, events);
     if (events & SYS_EVENT_MSG) {
         afIncomingMSGPacket_t *MSGpkt;
         while ((MSGpkt = (afIncomingMSGPacket_t *)osal_msg_receive(zclApp_TaskID))) {
-            LREP("MSGpkt->hdr.event 0x%X clusterId=0x%X\r\n", MSGpkt->hdr.event, MSGpkt->clusterId);
+            LOGT("MSGpkt->hdr.event 0x%X clusterId=0x%X\r\n", MSGpkt->hdr.event, MSGpkt->clusterId);
             switch (MSGpkt->hdr.event) {
             case KEY_CHANGE:
                 zclApp_HandleKeys(((keyChange_t *)MSGpkt)->state, ((keyChange_t *)MSGpkt)->keys);
                 break;
 
+            case AF_DATA_CONFIRM_CMD:
+                // zcl task passes confirms of frames sent from the endpoints on
+                if (MSGpkt->hdr.status == ZSuccess) {
+                    zclApp_ReportsSent++;
+                } else {
+                    zclApp_ReportsDropped++;
+                }
+                break;
+
             case ZCL_INCOMING_MSG:
+                zclCommissioning_FastPoll();
+                if (zclTimeSync_ProcessIncomingMsg((zclIncomingMsg_t *)MSGpkt)) {
+                    // re-anchor to wall clock boundaries
+                    zclApp_StartReportTimer();
+                    zclApp_StartLoadProfileTimer(osal_getClock());
+                    osal_start_timerEx(zclApp_TaskID, APP_TIME_SYNC_EVT, TIME_SYNC_INTERVAL_SEC * 1000);
+                }
                 if (((zclIncomingMsg_t *)MSGpkt)->attrCmd) {
                     osal_mem_free(((zclIncomingMsg_t *)MSGpkt)->attrCmd);
                 }
@@ -184,21 +406,63 @@ uint16 zclApp_event_loop(uint8 task_id, uint16 events) {
         return (events ^ SYS_EVENT_MSG);
     }
     if (events & APP_REPORT_EVT) {
-        LREPMaster("APP_REPORT_EVT\r\n");
+        LOGT("APP_REPORT_EVT\r\n");
+        zclApp_ArmReportTimer(zclReportPhase_Next(&zclApp_ReportPhase, osal_GetSystemClock(), osal_rand()));
+        zclMemStats_Sample();
         zclApp_Report();
         return (events ^ APP_REPORT_EVT);
     }
 
     if (events & APP_SAVE_ATTRS_EVT) {
-        LREPMaster("APP_SAVE_ATTRS_EVT\r\n");
+        LOGT("APP_SAVE_ATTRS_EVT\r\n");
         zclApp_SaveAttributesToNV();
         return (events ^ APP_SAVE_ATTRS_EVT);
     }
     if (events & APP_READ_SENSORS_EVT) {
-        LREPMaster("APP_READ_SENSORS_EVT\r\n");
+        LOGT("APP_READ_SENSORS_EVT\r\n");
         zclApp_ReadSensors();
         return (events ^ APP_READ_SENSORS_EVT);
     }
+    if (events & APP_LOAD_LIMIT_EVT) {
+        LOGT("APP_LOAD_LIMIT_EVT\r\n");
+        zclApp_StartPoll(APP_POLL_INSTANTANEOUS);
+        return (events ^ APP_LOAD_LIMIT_EVT);
+    }
+    if (events & APP_VOLTAGE_WATCH_EVT) {
+        LOGT("APP_VOLTAGE_WATCH_EVT\r\n");
+        zclApp_StartPoll(APP_POLL_INSTANTANEOUS);
+        return (events ^ APP_VOLTAGE_WATCH_EVT);
+    }
+    if (events & APP_LOAD_PROFILE_EVT) {
+        LOGT("APP_LOAD_PROFILE_EVT\r\n");
+        // round to the nearest interval boundary, timer may fire a bit off
+        zclApp_ProfileEndTime = (osal_getClock() + LOAD_PROFILE_INTERVAL_SEC / 2) / LOAD_PROFILE_INTERVAL_SEC * LOAD_PROFILE_INTERVAL_SEC;
+        zclApp_StartPoll(APP_POLL_ENERGY);
+        zclApp_StartLoadProfileTimer(zclApp_ProfileEndTime);
+        return (events ^ APP_LOAD_PROFILE_EVT);
+    }
+    if (events & APP_TIME_SYNC_EVT) {
+        LOGT("APP_TIME_SYNC_EVT\r\n");
+        zclTimeSync_Request(FIRST_ENDPOINT);
+        // retry until answered, a successful sync reschedules to the long interval
+        osal_start_timerEx(zclApp_TaskID, APP_TIME_SYNC_EVT,
+                           (zclTimeSync_IsSynced() ? TIME_SYNC_INTERVAL_SEC : (uint32)TIME_SYNC_RETRY_SEC) * 1000);
+        return (events ^ APP_TIME_SYNC_EVT);
+    }
+    if (events & APP_CONNECT_EVT) {
+        LOGT("APP_CONNECT_EVT\r\n");
+        zclApp_BoundReportWanted |= APP_POLL_ALL;
+        zclApp_StartPoll(APP_POLL_ALL);
+        zclApp_StartReportTimer();
+        return (events ^ APP_CONNECT_EVT);
+    }
+#if EEPROM_LOG
+    if (events & APP_EEPROM_LOG_EVT) {
+        LOGT("APP_EEPROM_LOG_EVT\r\n");
+        zclApp_LogSnapshot();
+        return (events ^ APP_EEPROM_LOG_EVT);
+    }
+#endif
     return 0;
 }
 
@@ -208,46 +472,99 @@ static void zclApp_ReadSensors(void)
   current_values_t CurrentValues;
   energy_t Energies;
   int16 temp;
+  uint32 readStart, decoded;
+  uint32 tiers[CONSUMPTION_TIERS];
+  bool answered;
 
-  LREP("currentSensorsReadingPhase %d\r\n", currentSensorsReadingPhase);
+  while (currentSensorsReadingPhase < sizeof(zclApp_PhaseGroup) && !(zclApp_PollMask & zclApp_PhaseGroup[currentSensorsReadingPhase])) {
+    currentSensorsReadingPhase++;
+  }
+  LOGT("currentSensorsReadingPhase %d\r\n", currentSensorsReadingPhase);
     // FYI: split reading sensors into phases, so single call wouldn't block processor
     // for extensive ammount of time
   switch (currentSensorsReadingPhase++) {
   case 0: // 
     HalLedSet(HAL_LED_1, HAL_LED_MODE_FLASH);
     (*mercury_dev->RequestMeasure)(zclApp_Config.DeviceAddress, 0x63);
+    zclApp_StartRequestTiming(&zclApp_LatencyCurrentValues);
     break;
   case 1:
-    
+    readStart = zclLatency_Now();
+    answered = Hal_UART_RxBufLen(MERCURY_PORT) > 0;
     CurrentValues = (*mercury_dev->ReadCurrentValues)();
+    decoded = zclLatency_Now();
     if (CurrentValues.Voltage == MERCURY_INVALID_RESPONSE) {
-      LREPMaster("Invalid response from counter\r\n");
+      LOGW("Invalid response from counter\r\n");
+      // only silence is an outage, a garbled reply came from a powered meter
+      if (answered) {
+        zclApp_MeterErrors++;
+        zclPowerQuality_Garbled(&zclApp_PowerQuality);
+      } else {
+        zclApp_CheckPowerQuality(zclPowerQuality_Miss(&zclApp_PowerQuality, osal_GetSystemClock()));
+      }
+      zclApp_PendingRequest = NULL;
       break;
     }
     zclApp_CurrentValues = CurrentValues;
+    zclApp_CurrentValuesTime = osal_GetSystemClock();
+    zclApp_PollDone |= APP_POLL_INSTANTANEOUS;
   
     bdb_RepChangedAttrValue(FIRST_ENDPOINT, ELECTRICAL, ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE);
+    zclApp_FinishRequestTiming(readStart, decoded);
+    zclApp_CheckLoadLimit();
+    zclApp_CheckPowerQuality(zclPowerQuality_Update(&zclApp_PowerQuality, &zclApp_Config.PowerQuality, CurrentValues.Voltage,
+                                                    zclApp_CurrentValuesTime));
     break;
   case 2:
     (*mercury_dev->RequestMeasure)(zclApp_Config.DeviceAddress, 0x27);
+    zclApp_StartRequestTiming(&zclApp_LatencyEnergy);
     break;
   case 3:
+    readStart = zclLatency_Now();
+    answered = Hal_UART_RxBufLen(MERCURY_PORT) > 0;
     Energies = (*mercury_dev->ReadEnergy)();
+    decoded = zclLatency_Now();
     if (Energies.Energy_T1 == MERCURY_INVALID_RESPONSE) {
-      LREPMaster("Invalid response from counter\r\n");
+      LOGW("Invalid response from counter\r\n");
+      if (answered) {
+        zclApp_MeterErrors++;
+      }
+      zclApp_PendingRequest = NULL;
       break;
     }
     zclApp_Energies = Energies;
+    zclApp_EnergiesTime = osal_GetSystemClock();
+    zclApp_PollDone |= APP_POLL_ENERGY;
+    // the clock counts from boot until synced, no reading time rather than a wrong one
+    zclApp_EnergiesUtc = 0;
+    if (zclTimeSync_IsSynced()) {
+      zclApp_EnergiesUtc = osal_getClock();
+      zclConsumption_Update(zclApp_Tiers(tiers), zclTimeSync_LocalTime());
+    } else {
+      // day and month of the last snapshots until the clock tells whether they changed
+      zclConsumption_Refresh(zclApp_Tiers(tiers));
+    }
+    bdb_RepChangedAttrValue(SECOND_ENDPOINT, SE_METERING, ATTRID_SE_METERING_CURR_DAY_CONS_DLVD);
+    if (zclApp_ProfileEndTime != 0) {
+      zclApp_RecordLoadProfile(zclApp_ProfileEndTime);
+      zclApp_ProfileEndTime = 0;
+    }
+    zclApp_SaveCheckpoint();
     bdb_RepChangedAttrValue(SECOND_ENDPOINT, SE_METERING, ATTRID_SE_METERING_CURR_TIER1_SUMM_DLVD);
+    zclApp_FinishRequestTiming(readStart, decoded);
     break;
   case 4:
+    readStart = zclLatency_Now();
     temp = readTemperature();
+    zclLatency_Update(&zclApp_LatencyDS18B20, zclLatency_Since(readStart));
     if (temp == 1) {
-      LREPMaster("ReadDS18B20 error\r\n");
+      LOGW("ReadDS18B20 error\r\n");
       break;
     } else {
       zclApp_Temperature = temp;
-      LREP("ReadDS18B20 t=%d\r\n", zclApp_Temperature);
+      zclApp_TemperatureTime = osal_GetSystemClock();
+      zclApp_PollDone |= APP_POLL_TEMPERATURE;
+      LOGT("ReadDS18B20 t=%d\r\n", zclApp_Temperature);
     }
     bdb_RepChangedAttrValue(FIRST_ENDPOINT, TEMP, ATTRID_MS_TEMPERATURE_MEASURED_VALUE);
     break;
@@ -256,6 +573,17 @@ static void zclApp_ReadSensors(void)
     osal_stop_timerEx(zclApp_TaskID, APP_READ_SENSORS_EVT);
     osal_clear_event(zclApp_TaskID, APP_READ_SENSORS_EVT);
     currentSensorsReadingPhase = 0;
+    if (zclApp_ProfileEndTime != 0 && (zclApp_PollMask & APP_POLL_ENERGY) && !(zclApp_PollQueued & APP_POLL_ENERGY)) {
+      LOGW("No energy read for the interval, using the previous one\r\n");
+      zclApp_RecordLoadProfile(zclApp_ProfileEndTime);
+      zclApp_ProfileEndTime = 0;
+    }
+    zclApp_SendPollReports(zclApp_PollMask);
+    if (zclApp_PollQueued) {
+      uint8 queued = zclApp_PollQueued;
+      zclApp_PollQueued = 0;
+      zclApp_StartPoll(queued);
+    }
     break;
 
   }
@@ -264,38 +592,516 @@ static void zclApp_ReadSensors(void)
 
 static void zclApp_Report(void) 
 { 
-  osal_start_reload_timer(zclApp_TaskID, APP_READ_SENSORS_EVT, 500); 
+  zclApp_StartPoll(APP_POLL_ALL);
+}
+
+static void zclApp_StartReportTimer(void) {
+    // devices powered up together by the same feeder get different slots
+    uint32 period = (uint32)zclApp_Config.MeasurementPeriod * 1000;
+    uint32 offset = zclReportPhase_Offset(NLME_GetExtAddr(), period);
+
+    if (zclTimeSync_IsSynced() && period > 0) {
+        // slots are counted from wall clock multiples of the period
+        uint32 intoPeriod = (osal_getClock() % zclApp_Config.MeasurementPeriod) * 1000;
+        offset = (offset + period - intoPeriod) % period;
+    }
+
+    zclApp_ReportPhase.Period = period;
+    zclApp_ReportPhase.Jitter = zclApp_Config.ReportJitter;
+    uint32 delay = zclReportPhase_Start(&zclApp_ReportPhase, offset, osal_GetSystemClock(), osal_rand());
+    LOGI("Report offset=%ld first in %ld ms\r\n", offset, delay);
+    zclApp_ArmReportTimer(delay);
+}
+
+static void zclApp_ReschedulePeriod(void) {
+    uint32 period = (uint32)zclApp_Config.MeasurementPeriod * 1000;
+    uint32 delay = zclReportPhase_SetPeriod(&zclApp_ReportPhase, period, osal_GetSystemClock(), osal_rand());
+    LOGI("Report period=%ld next in %ld ms\r\n", period, delay);
+    zclApp_ArmReportTimer(delay);
+}
+
+// MeasurementPeriod 0 turns the periodic cycle off, polls on demand still run
+static void zclApp_ArmReportTimer(uint32 delay) {
+    if (delay == 0) {
+        osal_stop_timerEx(zclApp_TaskID, APP_REPORT_EVT);
+        return;
+    }
+    osal_start_timerEx(zclApp_TaskID, APP_REPORT_EVT, delay);
+}
+
+static void zclApp_StartPoll(uint8 mask) {
+    // phases already done can't be repeated, run another cycle afterwards
+    if (osal_get_timeoutEx(zclApp_TaskID, APP_READ_SENSORS_EVT) != 0) {
+        zclApp_PollQueued |= mask;
+        return;
+    }
+    zclApp_PollMask = mask;
+    zclApp_PollDone = 0;
+    zclApp_PollReportMask |= zclApp_PollReportWanted & mask;
+    zclApp_PollReportWanted &= ~mask;
+    zclApp_BoundReportMask |= zclApp_BoundReportWanted & mask;
+    zclApp_BoundReportWanted &= ~mask;
+    osal_start_reload_timer(zclApp_TaskID, APP_READ_SENSORS_EVT, 500);
+}
+
+static void zclApp_SendPollReports(uint8 mask) {
+    uint8 pending = zclApp_PollReportMask & mask;
+    uint8 bound = zclApp_BoundReportMask & mask;
+
+    zclApp_PollReportMask &= ~mask;
+    zclApp_BoundReportMask &= ~mask;
+    // a failed read has nothing new to tell, the cached value would look like a fresh one
+    if ((pending | bound) & ~zclApp_PollDone) {
+        LOGW("Poll failed groups=0x%X, not reported\r\n", (pending | bound) & ~zclApp_PollDone);
+    }
+    zclApp_SendGroupReports(&zclApp_PollRequester, pending & zclApp_PollDone);
+    zclApp_SendGroupReports(&zclApp_BoundAddr, bound & zclApp_PollDone);
+}
+
+static void zclApp_SendGroupReports(afAddrType_t *dstAddr, uint8 groups) {
+    zclReport_t attrs[6];
+
+    if (groups & APP_POLL_INSTANTANEOUS) {
+        attrs[0] = (zclReport_t){ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE, ZCL_UINT16, (void *)&zclApp_CurrentValues.Voltage};
+        attrs[1] = (zclReport_t){ATTRID_ELECTRICAL_MEASUREMENT_RMS_CURRENT, ZCL_UINT16, (void *)&zclApp_CurrentValues.Current};
+        attrs[2] = (zclReport_t){ATTRID_ELECTRICAL_MEASUREMENT_ACTIVE_POWER, ZCL_INT16, (void *)&zclApp_CurrentValues.Power};
+        zclApp_SendReport(dstAddr, FIRST_ENDPOINT, ELECTRICAL, attrs, 3);
+    }
+    if (groups & APP_POLL_TEMPERATURE) {
+        attrs[0] = (zclReport_t){ATTRID_MS_TEMPERATURE_MEASURED_VALUE, ZCL_INT16, (void *)&zclApp_Temperature};
+        zclApp_SendReport(dstAddr, FIRST_ENDPOINT, TEMP, attrs, 1);
+    }
+    if (groups & APP_POLL_ENERGY) {
+        attrs[0] = (zclReport_t){ATTRID_SE_METERING_CURR_SUMM_DLVD, ZCL_UINT48, (void *)&zclApp_Energies.Energy_T0};
+        attrs[1] = (zclReport_t){ATTRID_SE_METERING_CURR_TIER1_SUMM_DLVD, ZCL_UINT48, (void *)&zclApp_Energies.Energy_T1};
+        attrs[2] = (zclReport_t){ATTRID_SE_METERING_CURR_TIER2_SUMM_DLVD, ZCL_UINT48, (void *)&zclApp_Energies.Energy_T2};
+        attrs[3] = (zclReport_t){ATTRID_SE_METERING_CURR_TIER3_SUMM_DLVD, ZCL_UINT48, (void *)&zclApp_Energies.Energy_T3};
+        attrs[4] = (zclReport_t){ATTRID_SE_METERING_CURR_TIER4_SUMM_DLVD, ZCL_UINT48, (void *)&zclApp_Energies.Energy_T4};
+        attrs[5] = (zclReport_t){ATTRID_SE_METERING_READING_SNAPSHOT_TIME, ZCL_UTC, (void *)&zclApp_EnergiesUtc};
+        zclApp_SendReport(dstAddr, SECOND_ENDPOINT, SE_METERING, attrs, 6);
+    }
+}
+
+static void zclApp_SendReport(afAddrType_t *dstAddr, uint8 endpoint, uint16 clusterId, zclReport_t *attrs, uint8 count) {
+    zclReportCmd_t *pReportCmd = zclMemStats_Alloc(sizeof(zclReportCmd_t) + count * sizeof(zclReport_t));
+    if (pReportCmd == NULL) {
+        return;
+    }
+    pReportCmd->numAttr = count;
+    osal_memcpy(pReportCmd->attrList, attrs, count * sizeof(zclReport_t));
+    if (zcl_SendReportCmd(endpoint, dstAddr, clusterId, pReportCmd, ZCL_FRAME_SERVER_CLIENT_DIR, TRUE, bdb_getZCLFrameCounter()) != ZSuccess) {
+        // no confirm follows a frame the stack didn't take
+        zclApp_ReportsDropped++;
+    }
+    osal_mem_free(pReportCmd);
+    // the coordinator often answers a report with reads or writes
+    zclCommissioning_FastPoll();
+}
+
+static void zclApp_CheckLoadLimit(void) {
+    uint8 state = zclApp_LoadLimit.State;
+    uint8 action = zclLoadLimit_Update(&zclApp_LoadLimit, &zclApp_Config.LoadLimit, zclApp_CurrentValues.Power,
+                                       zclApp_CurrentValues.Current, osal_GetSystemClock());
+
+    if (action == LOAD_LIMIT_ACTION_OFF) {
+        LOGW("Load limit exceeded, power=%d current=%d\r\n", zclApp_CurrentValues.Power, zclApp_CurrentValues.Current);
+        zclGeneral_SendOnOff_CmdOff(FIRST_ENDPOINT, &zclApp_BoundAddr, FALSE, bdb_getZCLFrameCounter());
+    } else if (action == LOAD_LIMIT_ACTION_ON) {
+        LOGI("Load back under limit, power=%d current=%d\r\n", zclApp_CurrentValues.Power, zclApp_CurrentValues.Current);
+        zclGeneral_SendOnOff_CmdOn(FIRST_ENDPOINT, &zclApp_BoundAddr, FALSE, bdb_getZCLFrameCounter());
+    }
+    if (action != LOAD_LIMIT_ACTION_NONE) {
+        // only switching is saved, a reboot while pending starts the hold time over
+        bool tripped = action == LOAD_LIMIT_ACTION_OFF;
+        uint8 status = osal_nv_write(NW_APP_LOAD_LIMIT_TRIPPED, 0, sizeof(tripped), &tripped);
+        LOGT("Load limit saved tripped=%d status=%d\r\n", tripped, status);
+    }
+    if (state != zclApp_LoadLimit.State) {
+        bdb_RepChangedAttrValue(FIRST_ENDPOINT, ELECTRICAL, ZCL_ATTRID_CUSTOM_LIMIT_STATE);
+    }
+
+    if (zclLoadLimit_NeedsFastPoll(&zclApp_LoadLimit) && zclApp_Config.LoadLimit.FastPollPeriod > 0) {
+        osal_start_timerEx(zclApp_TaskID, APP_LOAD_LIMIT_EVT, (uint32)zclApp_Config.LoadLimit.FastPollPeriod * 1000);
+    } else {
+        osal_stop_timerEx(zclApp_TaskID, APP_LOAD_LIMIT_EVT);
+    }
+}
+
+static void zclApp_CheckPowerQuality(uint8 events) {
+    powerQuality_t *pq = &zclApp_PowerQuality;
+    zclReport_t attrs[4];
+
+    if (events & POWER_QUALITY_EVENT_END) {
+        LOGI("Voltage event %d ended, voltage=%d duration=%ld\r\n", pq->LastType, pq->LastVoltage, pq->LastDuration);
+        attrs[0] = (zclReport_t){ZCL_ATTRID_CUSTOM_LAST_EVENT_TYPE, ZCL_DATATYPE_ENUM8, (void *)&pq->LastType};
+        attrs[1] = (zclReport_t){ZCL_ATTRID_CUSTOM_LAST_EVENT_VOLTAGE, ZCL_UINT16, (void *)&pq->LastVoltage};
+        attrs[2] = (zclReport_t){ZCL_ATTRID_CUSTOM_LAST_EVENT_DURATION, ZCL_UINT32, (void *)&pq->LastDuration};
+        zclApp_SendReport(&zclApp_BoundAddr, FIRST_ENDPOINT, ELECTRICAL, attrs, 3);
+    }
+    if (events & POWER_QUALITY_EVENT_START) {
+        uint8 alarmCode;
+        LOGW("Voltage event %d, voltage=%d\r\n", pq->State, pq->Extreme);
+        switch (pq->State) {
+        case POWER_QUALITY_SAG:
+            alarmCode = APP_ALARM_VOLTAGE_SAG;
+            attrs[0] = (zclReport_t){ZCL_ATTRID_CUSTOM_SAG_COUNT, ZCL_UINT16, (void *)&pq->SagCount};
+            break;
+        case POWER_QUALITY_SWELL:
+            alarmCode = APP_ALARM_VOLTAGE_SWELL;
+            attrs[0] = (zclReport_t){ZCL_ATTRID_CUSTOM_SWELL_COUNT, ZCL_UINT16, (void *)&pq->SwellCount};
+            break;
+        default:
+            alarmCode = APP_ALARM_EXTREME_UNDER_VOLTAGE;
+            attrs[0] = (zclReport_t){ZCL_ATTRID_CUSTOM_OUTAGE_COUNT, ZCL_UINT16, (void *)&pq->OutageCount};
+            break;
+        }
+        if (zclApp_Config.PowerQuality.AlarmsMask & BV(alarmCode)) {
+            zclGeneral_SendAlarm(FIRST_ENDPOINT, &zclApp_BoundAddr, alarmCode, ELECTRICAL, TRUE, bdb_getZCLFrameCounter());
+        }
+        zclApp_SendReport(&zclApp_BoundAddr, FIRST_ENDPOINT, ELECTRICAL, attrs, 1);
+    }
+}
+
+static void zclApp_StartVoltageWatch(void) {
+    if (zclApp_Config.PowerQuality.WatchPeriod > 0) {
+        osal_start_reload_timer(zclApp_TaskID, APP_VOLTAGE_WATCH_EVT, (uint32)zclApp_Config.PowerQuality.WatchPeriod * 1000);
+    } else {
+        osal_stop_timerEx(zclApp_TaskID, APP_VOLTAGE_WATCH_EVT);
+    }
+}
+
+static void zclApp_ReadThrough(afAddrType_t *srcAddr, uint16 clusterId) {
+    uint32 readTime;
+    uint8 group;
+
+    switch (clusterId) {
+    case ELECTRICAL:
+        readTime = zclApp_CurrentValuesTime;
+        group = APP_POLL_INSTANTANEOUS;
+        break;
+    case SE_METERING:
+        readTime = zclApp_EnergiesTime;
+        group = APP_POLL_ENERGY;
+        break;
+    case TEMP:
+        readTime = zclApp_TemperatureTime;
+        group = APP_POLL_TEMPERATURE;
+        break;
+    default:
+        return;
+    }
+
+    if (zclApp_Config.MaxAge == 0 || (readTime != 0 && osal_GetSystemClock() - readTime <= (uint32)zclApp_Config.MaxAge * 1000)) {
+        return;
+    }
+    // the cached value is returned now, the fresh one follows as a report to the reader
+    zclApp_PollRequester = *srcAddr;
+    if (osal_get_timeoutEx(zclApp_TaskID, APP_READ_SENSORS_EVT) != 0 && (zclApp_PollMask & group) && !(zclApp_PollDone & group)) {
+        // the running cycle reads the group after this request
+        zclApp_PollReportMask |= group;
+        return;
+    }
+    zclApp_PollReportWanted |= group;
+    // each attribute of a Read Attributes frame is authorized on its own, the first one polls
+    if (zclApp_PollQueued & group) {
+        return;
+    }
+    LOGI("Read-through cluster=0x%X, polling\r\n", clusterId);
+    zclApp_StartPoll(group);
+}
+
+static void zclApp_OnNetworkUp(void) {
+    uint16 delay = osal_rand() % APP_CONNECT_MAX_DELAY;
+
+    LOGI("Network up, polling in %d ms\r\n", delay);
+    // energy restored from the checkpoint until the first read, reading time tells its age
+    if (zclApp_EnergiesUtc != 0) {
+        zclApp_SendGroupReports(&zclApp_BoundAddr, APP_POLL_ENERGY);
+    }
+    // a whole segment rejoins at once after a router reboot, don't poll and report in sync
+    osal_start_timerEx(zclApp_TaskID, APP_CONNECT_EVT, delay + 1);
+}
+
+static void zclApp_RestoreCheckpoint(void) {
+    energyCheckpoint_t checkpoint;
+
+    osal_memset(&checkpoint, 0, sizeof(energyCheckpoint_t));
+    checkpoint.Utc = APP_CHECKPOINT_NONE;
+    if (osal_nv_item_init(NW_APP_ENERGY_CHECKPOINT, sizeof(energyCheckpoint_t), &checkpoint) != ZSUCCESS ||
+        osal_nv_read(NW_APP_ENERGY_CHECKPOINT, 0, sizeof(energyCheckpoint_t), &checkpoint) != ZSUCCESS ||
+        checkpoint.Utc == APP_CHECKPOINT_NONE) {
+        return;
+    }
+    zclApp_Energies = checkpoint.Energies;
+    zclApp_EnergiesUtc = checkpoint.Utc;
+    LOGI("Energy checkpoint T1=%ld utc=%ld\r\n", checkpoint.Energies.Energy_T1, checkpoint.Utc);
+}
+
+// a relay switched off before the reboot is still off, the limit has to switch it back on
+static void zclApp_RestoreLoadLimit(void) {
+    bool tripped = FALSE;
+
+    if (osal_nv_item_init(NW_APP_LOAD_LIMIT_TRIPPED, sizeof(tripped), &tripped) != ZSUCCESS ||
+        osal_nv_read(NW_APP_LOAD_LIMIT_TRIPPED, 0, sizeof(tripped), &tripped) != ZSUCCESS) {
+        return;
+    }
+    if (tripped == TRUE) {
+        LOGI("Load limit tripped before reboot\r\n");
+        zclApp_LoadLimit.State = LOAD_LIMIT_TRIPPED;
+    }
+}
+
+static void zclApp_SaveCheckpoint(void) {
+    energyCheckpoint_t checkpoint;
+    uint32 interval = (uint32)zclApp_Config.CheckpointInterval * 60 * 1000;
+
+    if (interval == 0 || osal_GetSystemClock() - zclApp_CheckpointTime < interval) {
+        return;
+    }
+    zclApp_CheckpointTime = osal_GetSystemClock();
+    if (osal_nv_read(NW_APP_ENERGY_CHECKPOINT, 0, sizeof(energyCheckpoint_t), &checkpoint) == ZSUCCESS &&
+        osal_memcmp(&checkpoint.Energies, &zclApp_Energies, sizeof(energy_t))) {
+        // no consumption, no flash wear
+        return;
+    }
+    checkpoint.Energies = zclApp_Energies;
+    checkpoint.Utc = zclApp_EnergiesUtc;
+    uint8 status = osal_nv_write(NW_APP_ENERGY_CHECKPOINT, 0, sizeof(energyCheckpoint_t), &checkpoint);
+    LOGT("Energy checkpoint status=%d\r\n", status);
+}
+
+// runs on a synced clock only, started by the first time sync
+static void zclApp_StartLoadProfileTimer(uint32 after) {
+    // first wall clock boundary after the given time
+    uint32 next = after / LOAD_PROFILE_INTERVAL_SEC * LOAD_PROFILE_INTERVAL_SEC + LOAD_PROFILE_INTERVAL_SEC;
+    uint32 now = osal_getClock();
+    uint32 delay = next > now ? next - now : 1;
+
+    osal_start_timerEx(zclApp_TaskID, APP_LOAD_PROFILE_EVT, delay * 1000);
+}
+
+static void zclApp_RecordLoadProfile(uint32 endTime) {
+    uint32 total = zclApp_Energies.Energy_T1 + zclApp_Energies.Energy_T2 + zclApp_Energies.Energy_T3 + zclApp_Energies.Energy_T4;
+
+    if (total == 0) {
+        LOGI("No energy readings yet, skip profile interval\r\n");
+        return;
+    }
+    if (zclApp_ProfileBaseline != 0) {
+        uint32 consumed = total >= zclApp_ProfileBaseline ? total - zclApp_ProfileBaseline : 0;
+        LOGT("Load profile endTime=%ld consumed=%ld\r\n", endTime, consumed);
+        zclLoadProfile_Push(endTime, consumed);
+    }
+    zclApp_ProfileBaseline = total;
+}
+
+// tariff registers of the last energy read, in the order consumption keeps them
+static uint32 *zclApp_Tiers(uint32 *tiers) {
+    tiers[0] = zclApp_Energies.Energy_T1;
+    tiers[1] = zclApp_Energies.Energy_T2;
+    tiers[2] = zclApp_Energies.Energy_T3;
+    tiers[3] = zclApp_Energies.Energy_T4;
+    return tiers;
+}
+
+#if EEPROM_LOG
+// four tariff registers, voltage, current, power and temperature
+#define APP_LOG_SNAPSHOT_SIZE (4 * sizeof(uint32) + 4 * sizeof(uint16))
+// fails to compile when a board sets EEPROM_LOG_RECORD_SIZE too small for the snapshot
+typedef char zclApp_LogSnapshotFits[EEPROM_LOG_PAYLOAD_SIZE >= APP_LOG_SNAPSHOT_SIZE ? 1 : -1];
+
+static void zclApp_LogSnapshot(void) {
+    uint8 payload[EEPROM_LOG_PAYLOAD_SIZE];
+    uint32 energies[] = {zclApp_Energies.Energy_T1, zclApp_Energies.Energy_T2, zclApp_Energies.Energy_T3, zclApp_Energies.Energy_T4};
+    uint16 values[] = {zclApp_CurrentValues.Voltage, zclApp_CurrentValues.Current, (uint16)zclApp_CurrentValues.Power, (uint16)zclApp_Temperature};
+    uint8 *p = payload;
+
+    osal_memset(payload, 0, sizeof(payload));
+    for (uint8 i = 0; i < sizeof(energies) / sizeof(energies[0]); i++) {
+        *p++ = BREAK_UINT32(energies[i], 0);
+        *p++ = BREAK_UINT32(energies[i], 1);
+        *p++ = BREAK_UINT32(energies[i], 2);
+        *p++ = BREAK_UINT32(energies[i], 3);
+    }
+    for (uint8 i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        *p++ = LO_UINT16(values[i]);
+        *p++ = HI_UINT16(values[i]);
+    }
+    int8 status = zclEepromLog_Append(osal_getClock(), payload);
+    LOGI("EEPROM log append status=%d count=%d\r\n", status, zclEepromLog_Count());
+}
+#endif
+
+static ZStatus_t zclApp_MeteringPlugin(zclIncoming_t *pInMsg) {
+    zclCommissioning_FastPoll();
+    if (zcl_ServerCmd(pInMsg->hdr.fc.direction) && pInMsg->hdr.commandID == COMMAND_SE_METERING_GET_PROFILE) {
+        return zclApp_ProcessGetProfile(pInMsg);
+    }
+    return ZFailure;
+}
+
+static ZStatus_t zclApp_PollPlugin(zclIncoming_t *pInMsg) {
+    zclCommissioning_FastPoll();
+    if (!zcl_ServerCmd(pInMsg->hdr.fc.direction) || pInMsg->hdr.commandID != COMMAND_MERCURY_POLL_NOW) {
+        return ZFailure;
+    }
+    uint8 mask = pInMsg->pDataLen > 0 ? pInMsg->pData[0] & APP_POLL_ALL : 0;
+    if (mask == 0) {
+        mask = APP_POLL_ALL;
+    }
+    LOGI("Poll now mask=0x%X from 0x%X\r\n", mask, pInMsg->msg->srcAddr.addr.shortAddr);
+
+    zclApp_PollRequester = pInMsg->msg->srcAddr;
+    zclApp_PollReportWanted |= mask;
+    zclApp_StartPoll(mask);
+    return ZSuccess;
+}
+
+static ZStatus_t zclApp_ProcessGetProfile(zclIncoming_t *pInMsg) {
+    if (pInMsg->pDataLen < 6) {
+        return ZCL_STATUS_MALFORMED_COMMAND;
+    }
+    uint8 channel = pInMsg->pData[0];
+    uint32 endTime = BUILD_UINT32(pInMsg->pData[1], pInMsg->pData[2], pInMsg->pData[3], pInMsg->pData[4]);
+    uint8 periods = pInMsg->pData[5];
+    uint8 status = SE_PROFILE_STATUS_SUCCESS;
+    uint8 delivered = 0;
+    uint32 rspEndTime = endTime;
+
+    uint8 *rsp = (uint8 *)zclMemStats_Alloc(7 + APP_PROFILE_MAX_PERIODS * 3);
+    if (rsp == NULL) {
+        return ZCL_STATUS_SOFTWARE_FAILURE;
+    }
+
+    if (channel > SE_PROFILE_CHANNEL_RECEIVED) {
+        status = SE_PROFILE_STATUS_UNDEFINED_CHANNEL;
+    } else if (channel != SE_PROFILE_CHANNEL_DELIVERED) {
+        status = SE_PROFILE_STATUS_UNSUPPORTED_CHANNEL;
+    } else {
+        if (periods > APP_PROFILE_MAX_PERIODS) {
+            periods = APP_PROFILE_MAX_PERIODS;
+            status = SE_PROFILE_STATUS_TOO_MANY_PERIODS;
+        }
+        delivered = zclLoadProfile_Read(endTime, periods, &rspEndTime, &rsp[7]);
+        if (delivered == 0) {
+            status = SE_PROFILE_STATUS_NO_INTERVALS;
+        }
+    }
+    LOGI("GetProfile channel=%d endTime=%ld periods=%d delivered=%d\r\n", channel, endTime, periods, delivered);
+
+    rsp[0] = BREAK_UINT32(rspEndTime, 0);
+    rsp[1] = BREAK_UINT32(rspEndTime, 1);
+    rsp[2] = BREAK_UINT32(rspEndTime, 2);
+    rsp[3] = BREAK_UINT32(rspEndTime, 3);
+    rsp[4] = status;
+    rsp[5] = APP_PROFILE_INTERVAL_PERIOD;
+    rsp[6] = delivered;
+
+    zcl_SendCommand(pInMsg->msg->endPoint, &pInMsg->msg->srcAddr, SE_METERING, COMMAND_SE_METERING_GET_PROFILE_RSP, TRUE,
+                    ZCL_FRAME_SERVER_CLIENT_DIR, TRUE, 0, pInMsg->hdr.transSeqNum, 7 + delivered * 3, rsp);
+    osal_mem_free(rsp);
+    return ZCL_STATUS_CMD_HAS_RSP;
 }
 
 static void zclApp_BasicResetCB(void) {
-    LREPMaster("BasicResetCB\r\n");
+    LOGT("BasicResetCB\r\n");
     zclApp_ResetAttributesToDefaultValues();
     zclApp_SaveAttributesToNV();
 }
 
 static ZStatus_t zclApp_ReadWriteAuthCB(afAddrType_t *srcAddr, zclAttrRec_t *pAttr, uint8 oper) {
-    LREPMaster("AUTH CB called\r\n");
-    osal_start_timerEx(zclApp_TaskID, APP_SAVE_ATTRS_EVT, 2000);
+    LOGT("AUTH CB called oper=%d\r\n", oper);
+    switch (oper) {
+    case ZCL_OPER_READ:
+        zclApp_ReadThrough(srcAddr, pAttr->clusterID);
+        break;
+    case ZCL_OPER_WRITE:
+        // batch a burst of writes into one save
+        osal_start_timerEx(zclApp_TaskID, APP_SAVE_ATTRS_EVT, 2000);
+        break;
+    default:
+        break;
+    }
     return ZSuccess;
 }
 
 static void zclApp_SaveAttributesToNV(void) {
-    uint8 writeStatus = osal_nv_write(NW_APP_CONFIG, 0, sizeof(application_config_t), &zclApp_Config);
-    LREP("Saving attributes to NV write=%d\r\n", writeStatus);
-    osal_start_reload_timer(zclApp_TaskID, APP_REPORT_EVT, zclApp_Config.MeasurementPeriod * 1000);
+    uint8 changed = 0;
+    bool periodChanged = zclApp_Config.MeasurementPeriod != zclApp_ConfigNV.MeasurementPeriod;
+    bool pollRateChanged = zclApp_Config.PollRate != zclApp_ConfigNV.PollRate;
+
+    for (uint8 i = 0; i < APP_NV_SECTIONS; i++) {
+        appNvSection_t const *section = &zclApp_NvSections[i];
+        if (osal_memcmp((uint8 *)&zclApp_Config + section->Offset, (uint8 *)&zclApp_ConfigNV + section->Offset, section->Size)) {
+            continue;
+        }
+        zclApp_WriteNvSection(i);
+        changed |= BV(i);
+    }
+    LOGI("Saving attributes to NV changed=0x%X writes=%ld\r\n", changed, zclApp_NvWrites);
+    // jitter is picked up by the next cycle, other fields don't affect timing
+    zclApp_ReportPhase.Jitter = zclApp_Config.ReportJitter;
+    if (periodChanged) {
+        zclApp_ReschedulePeriod();
+    }
+    if (changed & BV(APP_NV_SECTION_POWER_QUALITY)) {
+        zclApp_StartVoltageWatch();
+    }
+    if (pollRateChanged) {
+        zclCommissioning_SetPollRate(zclApp_Config.PollRate);
+    }
+}
+
+static void zclApp_WriteNvSection(uint8 index) {
+    appNvSection_t const *section = &zclApp_NvSections[index];
+    uint8 buf[APP_NV_SECTION_MAX_SIZE + 2];
+
+    // every item carries its own write count, the total is exported
+    zclApp_NvSectionWrites[index]++;
+    zclApp_NvWrites++;
+    osal_memcpy(buf, (uint8 *)&zclApp_Config + section->Offset, section->Size);
+    buf[section->Size] = LO_UINT16(zclApp_NvSectionWrites[index]);
+    buf[section->Size + 1] = HI_UINT16(zclApp_NvSectionWrites[index]);
+    uint8 status = osal_nv_write(section->Id, 0, section->Size + 2, buf);
+    LOGT("NV write id=0x%X status=%d\r\n", section->Id, status);
+    osal_memcpy((uint8 *)&zclApp_ConfigNV + section->Offset, (uint8 *)&zclApp_Config + section->Offset, section->Size);
 }
 
 static void zclApp_RestoreAttributesFromNV(void) {
-    uint8 status = osal_nv_item_init(NW_APP_CONFIG, sizeof(application_config_t), NULL);
-    LREP("Restoring attributes from NV  status=%d \r\n", status);
-    if (status == NV_ITEM_UNINIT) {
-        uint8 writeStatus = osal_nv_write(NW_APP_CONFIG, 0, sizeof(application_config_t), &zclApp_Config);
-        LREP("NV was empty, writing %d\r\n", writeStatus);
+    uint8 buf[APP_NV_SECTION_MAX_SIZE + 2];
+    uint16 legacyLen = osal_nv_item_len(NW_APP_CONFIG);
+
+    if (legacyLen != 0) {
+        // single item of older firmware, keep the common fields and split them below
+        LOGW("Migrating NV config size %d\r\n", legacyLen);
+        osal_nv_read(NW_APP_CONFIG, 0, MIN(legacyLen, sizeof(application_config_t)), &zclApp_Config);
+        osal_nv_delete(NW_APP_CONFIG, legacyLen);
     }
-    if (status == ZSUCCESS) {
-        LREPMaster("Reading from NV\r\n");
-        osal_nv_read(NW_APP_CONFIG, 0, sizeof(application_config_t), &zclApp_Config);
+
+    for (uint8 i = 0; i < APP_NV_SECTIONS; i++) {
+        appNvSection_t const *section = &zclApp_NvSections[i];
+        uint8 *fields = (uint8 *)&zclApp_Config + section->Offset;
+        uint16 len = osal_nv_item_len(section->Id);
+        bool rewrite = legacyLen != 0 || len != section->Size + 2;
+
+        if (len >= 2 && len <= sizeof(buf) && osal_nv_read(section->Id, 0, len, buf) == ZSUCCESS) {
+            if (legacyLen == 0) {
+                // item of another size was written by another firmware version, keep the common part
+                osal_memcpy(fields, buf, MIN(len - 2, section->Size));
+            }
+            zclApp_NvSectionWrites[i] = BUILD_UINT16(buf[len - 2], buf[len - 1]);
+        }
+        if (len != 0 && len != section->Size + 2) {
+            osal_nv_delete(section->Id, len);
+        }
+        uint8 status = osal_nv_item_init(section->Id, section->Size + 2, NULL);
+        LOGI("Restoring NV id=0x%X len=%d status=%d\r\n", section->Id, len, status);
+        zclApp_NvWrites += zclApp_NvSectionWrites[i];
+        if (rewrite) {
+            zclApp_WriteNvSection(i);
+        }
     }
+    osal_memcpy(&zclApp_ConfigNV, &zclApp_Config, sizeof(application_config_t));
 }
 
 /****************************************************************************
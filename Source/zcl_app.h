@@ -8,6 +8,10 @@ extern "C" {
 /*********************************************************************
  * INCLUDES
  */
+#include "latency.h"
+#include "load_limit.h"
+#include "power_quality.h"
+#include "time_sync.h"
 #include "version.h"
 #include "zcl.h"
 
@@ -19,6 +23,12 @@ extern "C" {
 #define APP_REPORT_EVT        0x0001
 #define APP_SAVE_ATTRS_EVT    0x0002
 #define APP_READ_SENSORS_EVT  0x0004
+#define APP_LOAD_PROFILE_EVT  0x0008
+#define APP_EEPROM_LOG_EVT    0x0010
+#define APP_LOAD_LIMIT_EVT    0x0020
+#define APP_VOLTAGE_WATCH_EVT 0x0040
+#define APP_TIME_SYNC_EVT     0x0080
+#define APP_CONNECT_EVT       0x0100
    
    
 #define FIRST_ENDPOINT        1
@@ -27,37 +37,151 @@ extern "C" {
 /*********************************************************************
  * MACROS
  */
-#define NW_APP_CONFIG 0x0402
+#define NW_APP_CONFIG 0x0402 // whole config of older firmware, migrated to the items below
+
+// config is split so a change rewrites only its own item
+#define NW_APP_CONFIG_METER           0x0404
+#define NW_APP_CONFIG_SCHEDULE        0x0405
+#define NW_APP_CONFIG_LOAD_LIMIT      0x0406
+#define NW_APP_CONFIG_POWER_QUALITY   0x0407
+#define NW_APP_CONFIG_REPORT          0x0408
+
+#define NW_APP_ENERGY_CHECKPOINT      0x0409
+#define NW_APP_LOAD_LIMIT_TRIPPED     0x040A // relay switched off by the load limit, survives a reboot
 
 #define R     ACCESS_CONTROL_READ
 #define RW    (R | ACCESS_CONTROL_WRITE | ACCESS_CONTROL_AUTH_WRITE)
 #define RR    (R | ACCESS_REPORTABLE)
 #define RWR   (RW | RR)
+#define RRT   (RR | ACCESS_CONTROL_AUTH_READ) // read-through, reading a stale value starts a poll
 
 #define BASIC         ZCL_CLUSTER_ID_GEN_BASIC
 #define GEN_ON_OFF    ZCL_CLUSTER_ID_GEN_ON_OFF
+#define ALARMS        ZCL_CLUSTER_ID_GEN_ALARMS
+#define TIME          ZCL_CLUSTER_ID_GEN_TIME
 #define POWER_CFG     ZCL_CLUSTER_ID_GEN_ON
 #define TEMP          ZCL_CLUSTER_ID_MS_TEMPERATURE_MEASUREMENT
 #define HUMIDITY      ZCL_CLUSTER_ID_MS_RELATIVE_HUMIDITY
 #define PRESSURE      ZCL_CLUSTER_ID_MS_PRESSURE_MEASUREMENT
 #define ELECTRICAL    ZCL_CLUSTER_ID_HA_ELECTRICAL_MEASUREMENT
 #define SE_METERING   ZCL_CLUSTER_ID_SE_METERING
+#define DIAGNOSTICS   ZCL_CLUSTER_ID_HA_DIAGNOSTIC
+#define MERCURY_POLL  0xFC00 // manufacturer specific, on-demand meter polling
 
 // Custom Attributes
 #define ZCL_ATTRID_CUSTOM_DEVICE_ADDRESS          0xF001
 #define ZCL_ATTRID_CUSTOM_MEASUREMENT_PERIOD      0xF002
+#define ZCL_ATTRID_CUSTOM_MAX_AGE                 0xF003
+#define ZCL_ATTRID_CUSTOM_REPORT_JITTER           0xF004
+#define ZCL_ATTRID_CUSTOM_CHECKPOINT_INTERVAL     0xF005
+#define ZCL_ATTRID_CUSTOM_NV_WRITES               0xF006
+#define ZCL_ATTRID_CUSTOM_POLL_RATE               0xF007
+
+// Electrical measurement cluster, local load limit
+#define ZCL_ATTRID_CUSTOM_POWER_LIMIT             0xF010
+#define ZCL_ATTRID_CUSTOM_CURRENT_LIMIT           0xF011
+#define ZCL_ATTRID_CUSTOM_LIMIT_HYSTERESIS        0xF012
+#define ZCL_ATTRID_CUSTOM_LIMIT_HOLD_TIME         0xF013
+#define ZCL_ATTRID_CUSTOM_FAST_POLL_PERIOD        0xF014
+#define ZCL_ATTRID_CUSTOM_LIMIT_STATE             0xF015
+
+// Electrical measurement cluster, voltage sag / swell / outage detection
+#define ZCL_ATTRID_CUSTOM_SAG_LEVEL               0xF020
+#define ZCL_ATTRID_CUSTOM_SWELL_LEVEL             0xF021
+#define ZCL_ATTRID_CUSTOM_VOLTAGE_WATCH_PERIOD    0xF022
+#define ZCL_ATTRID_CUSTOM_SAG_COUNT               0xF023
+#define ZCL_ATTRID_CUSTOM_SWELL_COUNT             0xF024
+#define ZCL_ATTRID_CUSTOM_OUTAGE_COUNT            0xF025
+#define ZCL_ATTRID_CUSTOM_LAST_EVENT_TYPE         0xF026
+#define ZCL_ATTRID_CUSTOM_LAST_EVENT_VOLTAGE      0xF027
+#define ZCL_ATTRID_CUSTOM_LAST_EVENT_DURATION     0xF028
+
+// Diagnostics cluster, poll latencies in microseconds, base + LATENCY_ATTR_*
+#define ZCL_ATTRID_CUSTOM_LATENCY_CURRENT_VALUES  0xF100
+#define ZCL_ATTRID_CUSTOM_LATENCY_ENERGY          0xF110
+#define ZCL_ATTRID_CUSTOM_LATENCY_DS18B20         0xF120
+
+// Diagnostics cluster, memory use in bytes
+#define ZCL_ATTRID_CUSTOM_HEAP_USED               0xF130
+#define ZCL_ATTRID_CUSTOM_HEAP_PEAK               0xF131
+#define ZCL_ATTRID_CUSTOM_ALLOC_FAILURES          0xF132
+#define ZCL_ATTRID_CUSTOM_STACK_PEAK              0xF133
+#define ZCL_ATTRID_CUSTOM_STACK_SIZE              0xF134
+
+// Diagnostics cluster, Time cluster sync
+#define ZCL_ATTRID_CUSTOM_TIME_LAST_SYNC          0xF140
+#define ZCL_ATTRID_CUSTOM_TIME_LAST_CORRECTION    0xF141
+#define ZCL_ATTRID_CUSTOM_TIME_SYNC_COUNT         0xF142
+
+// Diagnostics cluster, end device rejoins
+#define ZCL_ATTRID_CUSTOM_REJOIN_COUNT            0xF150
+#define ZCL_ATTRID_CUSTOM_REJOIN_CACHED_COUNT     0xF151
+#define ZCL_ATTRID_CUSTOM_REJOIN_MASK_COUNT       0xF152
+#define ZCL_ATTRID_CUSTOM_REJOIN_BACKOFF_COUNT    0xF153
+#define ZCL_ATTRID_CUSTOM_REJOIN_FAILURES         0xF154
+#define ZCL_ATTRID_CUSTOM_REJOIN_LAST_LATENCY     0xF155
+#define ZCL_ATTRID_CUSTOM_REJOIN_MAX_LATENCY      0xF156
+#define ZCL_ATTRID_CUSTOM_PARENT_CHANGES          0xF157
+
+// Diagnostics cluster, frames sent from the application endpoints
+#define ZCL_ATTRID_CUSTOM_REPORTS_SENT            0xF160 // confirmed by the next hop
+#define ZCL_ATTRID_CUSTOM_REPORTS_DROPPED         0xF161 // refused by the stack or not confirmed
+#define ZCL_ATTRID_CUSTOM_METER_ERRORS            0xF162 // meter replies failing CRC or length
+
+#define LATENCY_ATTR_FIRST_RX                     0x00
+#define LATENCY_ATTR_FRAME                        0x01
+#define LATENCY_ATTR_DECODE                       0x02
+#define LATENCY_ATTR_REPORT                       0x03
+#define LATENCY_ATTR_MIN                          0x04
+#define LATENCY_ATTR_MAX                          0x05
+#define LATENCY_ATTR_AVG                          0x06
   
 #define ATTRID_SE_METERING_CURR_SUMM_DLVD         0x0000
+#define ATTRID_SE_METERING_READING_SNAPSHOT_TIME  0x0007
 #define ATTRID_SE_METERING_CURR_TIER1_SUMM_DLVD   0x0100
 #define ATTRID_SE_METERING_CURR_TIER2_SUMM_DLVD   0x0102
 #define ATTRID_SE_METERING_CURR_TIER3_SUMM_DLVD   0x0104
 #define ATTRID_SE_METERING_CURR_TIER4_SUMM_DLVD   0x0106
+#define ATTRID_SE_METERING_CURR_DAY_CONS_DLVD     0x0401
+#define ATTRID_SE_METERING_PREV_DAY_CONS_DLVD     0x0403
+#define ATTRID_SE_METERING_CURR_MONTH_CONS_DLVD   0x0440
+#define ATTRID_SE_METERING_PREV_MONTH_CONS_DLVD   0x0442
+
+// Electrical measurement ACAlarmsMask bits, the bit number is the alarm code
+#define APP_ALARM_EXTREME_UNDER_VOLTAGE           0x07 // outage
+#define APP_ALARM_VOLTAGE_SAG                     0x08
+#define APP_ALARM_VOLTAGE_SWELL                   0x09
+
+// SE Metering commands
+#define COMMAND_SE_METERING_GET_PROFILE           0x00
+#define COMMAND_SE_METERING_GET_PROFILE_RSP       0x00
+
+#define SE_PROFILE_CHANNEL_DELIVERED              0x00
+#define SE_PROFILE_CHANNEL_RECEIVED               0x01
+
+#define SE_PROFILE_STATUS_SUCCESS                 0x00
+#define SE_PROFILE_STATUS_UNDEFINED_CHANNEL       0x01
+#define SE_PROFILE_STATUS_UNSUPPORTED_CHANNEL     0x02
+#define SE_PROFILE_STATUS_INVALID_END_TIME        0x03
+#define SE_PROFILE_STATUS_TOO_MANY_PERIODS        0x04
+#define SE_PROFILE_STATUS_NO_INTERVALS            0x05
+
+// Mercury poll cluster commands
+#define COMMAND_MERCURY_POLL_NOW                  0x00 // payload: uint8 APP_POLL_* mask, 0 - all
+
+// groups of values read in one poll cycle
+#define APP_POLL_INSTANTANEOUS                    0x01 // voltage, current, power
+#define APP_POLL_ENERGY                           0x02 // tariff summations
+#define APP_POLL_TEMPERATURE                      0x04
+#define APP_POLL_ALL                              (APP_POLL_INSTANTANEOUS | APP_POLL_ENERGY | APP_POLL_TEMPERATURE)
 
 
 #define ZCL_UINT8     ZCL_DATATYPE_UINT8
 #define ZCL_UINT16    ZCL_DATATYPE_UINT16
+#define ZCL_UINT24    ZCL_DATATYPE_UINT24
 #define ZCL_UINT32    ZCL_DATATYPE_UINT32
 #define ZCL_UINT48    ZCL_DATATYPE_UINT48
+#define ZCL_UTC       ZCL_DATATYPE_UTC
 #define ZCL_INT8      ZCL_DATATYPE_INT8
 #define ZCL_INT16     ZCL_DATATYPE_INT16
 #define ZCL_INT32     ZCL_DATATYPE_INT32
@@ -75,6 +199,12 @@ typedef struct {
     uint16  VoltageMultiplier;
     uint16  CurrentMultiplier;
     uint16  PowerMultiplier;
+    uint16  MaxAge;
+    loadLimitConfig_t LoadLimit;
+    powerQualityConfig_t PowerQuality;
+    uint8   ReportJitter;
+    uint16  CheckpointInterval;
+    uint16  PollRate; // new fields go last, RestoreAttributesFromNV keeps the common prefix
 } application_config_t;
 
 
@@ -111,8 +241,19 @@ extern const uint8 zclApp_PowerSource;
 
 extern application_config_t zclApp_Config;
 extern energy_t zclApp_Energies;
+extern uint32 zclApp_EnergiesUtc;
 extern current_values_t zclApp_CurrentValues;
 extern int16 zclApp_Temperature;
+extern loadLimit_t zclApp_LoadLimit;
+extern uint32 zclApp_NvWrites;
+extern uint32 zclApp_ReportsSent;
+extern uint32 zclApp_ReportsDropped;
+extern uint32 zclApp_MeterErrors;
+extern powerQuality_t zclApp_PowerQuality;
+
+extern latencyRequest_t zclApp_LatencyCurrentValues;
+extern latencyRequest_t zclApp_LatencyEnergy;
+extern latencyStat_t zclApp_LatencyDS18B20;
 
 // APP_TODO: Declare application specific attributes here
 
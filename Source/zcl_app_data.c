@@ -11,6 +11,10 @@
 #include "zcl_electrical_measurement.h"
 
 #include "zcl_app.h"
+#include "zcl_diagnostic.h"
+#include "commissioning.h"
+#include "consumption.h"
+#include "mem_stats.h"
 
 #include "version.h"
 
@@ -62,6 +66,22 @@ const uint8 zclApp_PowerSource = POWER_SOURCE_MAINS_1_PHASE;
 #define DEFAULT_CurrentDivisor 100
 #define DEFAULT_PowerDivisor 1
 #define DEFAULT_Multiplier 1
+// read-through off, a dashboard that wants it sets the age it can live with
+#define DEFAULT_MaxAge 0
+#define DEFAULT_ReportJitter 10
+#define DEFAULT_CheckpointInterval 60
+#define DEFAULT_PollRate 2000
+#define DEFAULT_PowerLimit 0
+#define DEFAULT_CurrentLimit 0
+#define DEFAULT_LimitHysteresis 10
+#define DEFAULT_LimitHoldTime 5
+#define DEFAULT_FastPollPeriod 5
+#define DEFAULT_SagLevel 2070   // -10% of 230 V
+#define DEFAULT_SwellLevel 2530 // +10% of 230 V
+#define DEFAULT_SagPeriod 0
+#define DEFAULT_SwellPeriod 0
+#define DEFAULT_VoltageWatchPeriod 0
+#define DEFAULT_AlarmsMask (BV(APP_ALARM_EXTREME_UNDER_VOLTAGE) | BV(APP_ALARM_VOLTAGE_SAG) | BV(APP_ALARM_VOLTAGE_SWELL))
 
 application_config_t zclApp_Config = {
     .DeviceAddress = DEFAULT_DeviceAddress,
@@ -72,6 +92,25 @@ application_config_t zclApp_Config = {
     .VoltageMultiplier = DEFAULT_Multiplier,
     .CurrentMultiplier = DEFAULT_Multiplier,
     .PowerMultiplier = DEFAULT_Multiplier,
+    .MaxAge = DEFAULT_MaxAge,
+    .ReportJitter = DEFAULT_ReportJitter,
+    .CheckpointInterval = DEFAULT_CheckpointInterval,
+    .PollRate = DEFAULT_PollRate,
+    .LoadLimit = {
+        .PowerLimit = DEFAULT_PowerLimit,
+        .CurrentLimit = DEFAULT_CurrentLimit,
+        .Hysteresis = DEFAULT_LimitHysteresis,
+        .HoldTime = DEFAULT_LimitHoldTime,
+        .FastPollPeriod = DEFAULT_FastPollPeriod,
+    },
+    .PowerQuality = {
+        .SagLevel = DEFAULT_SagLevel,
+        .SwellLevel = DEFAULT_SwellLevel,
+        .SagPeriod = DEFAULT_SagPeriod,
+        .SwellPeriod = DEFAULT_SwellPeriod,
+        .WatchPeriod = DEFAULT_VoltageWatchPeriod,
+        .AlarmsMask = DEFAULT_AlarmsMask,
+    },
 };
 
 current_values_t zclApp_CurrentValues = {
@@ -88,8 +127,24 @@ energy_t zclApp_Energies = {
     .Energy_T4 = 0
 };
 
+uint32 zclApp_EnergiesUtc = 0;
+
 int16 zclApp_Temperature = 0;
 
+loadLimit_t zclApp_LoadLimit = {.State = LOAD_LIMIT_NORMAL};
+
+powerQuality_t zclApp_PowerQuality = {.State = POWER_QUALITY_NORMAL};
+
+uint32 zclApp_NvWrites = 0;
+
+uint32 zclApp_ReportsSent = 0;
+uint32 zclApp_ReportsDropped = 0;
+uint32 zclApp_MeterErrors = 0;
+
+latencyRequest_t zclApp_LatencyCurrentValues;
+latencyRequest_t zclApp_LatencyEnergy;
+latencyStat_t zclApp_LatencyDS18B20;
+
 /*********************************************************************
  * ATTRIBUTE DEFINITIONS - Uses REAL cluster IDs
  */
@@ -106,9 +161,9 @@ CONST zclAttrRec_t zclApp_Attrs_FirstEP[] = {
     {BASIC, {ATTRID_BASIC_SW_BUILD_ID, ZCL_DATATYPE_CHAR_STR, R, (void *)zclApp_DateCode}},
     {BASIC, {ATTRID_CLUSTER_REVISION, ZCL_UINT16, R, (void *)&zclApp_clusterRevision_all}},
 
-    {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE, ZCL_UINT16, RR, (void *)&zclApp_CurrentValues.Voltage}},
-    {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_RMS_CURRENT, ZCL_UINT16, RR, (void *)&zclApp_CurrentValues.Current}},
-    {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_ACTIVE_POWER, ZCL_INT16, RR, (void *)&zclApp_CurrentValues.Power}},
+    {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE, ZCL_UINT16, RRT, (void *)&zclApp_CurrentValues.Voltage}},
+    {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_RMS_CURRENT, ZCL_UINT16, RRT, (void *)&zclApp_CurrentValues.Current}},
+    {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_ACTIVE_POWER, ZCL_INT16, RRT, (void *)&zclApp_CurrentValues.Power}},
 
     {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_AC_VOLTAGE_DIVISOR, ZCL_UINT16, R, (void *)&zclApp_Config.VoltageDivisor}},
     {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_AC_CURRENT_DIVISOR, ZCL_UINT16, R, (void *)&zclApp_Config.CurrentDivisor}},
@@ -116,16 +171,113 @@ CONST zclAttrRec_t zclApp_Attrs_FirstEP[] = {
     {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_AC_VOLTAGE_MULTIPLIER, ZCL_UINT16, R, (void *)&zclApp_Config.VoltageMultiplier}},
     {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_AC_CURRENT_MULTIPLIER, ZCL_UINT16, R, (void *)&zclApp_Config.CurrentMultiplier}},
     {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_AC_POWER_MULTIPLIER, ZCL_UINT16, R, (void *)&zclApp_Config.PowerMultiplier}},
+
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_POWER_LIMIT, ZCL_INT16, RW, (void *)&zclApp_Config.LoadLimit.PowerLimit}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_CURRENT_LIMIT, ZCL_UINT16, RW, (void *)&zclApp_Config.LoadLimit.CurrentLimit}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_LIMIT_HYSTERESIS, ZCL_UINT8, RW, (void *)&zclApp_Config.LoadLimit.Hysteresis}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_LIMIT_HOLD_TIME, ZCL_UINT16, RW, (void *)&zclApp_Config.LoadLimit.HoldTime}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_FAST_POLL_PERIOD, ZCL_UINT16, RW, (void *)&zclApp_Config.LoadLimit.FastPollPeriod}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_LIMIT_STATE, ZCL_DATATYPE_ENUM8, RR, (void *)&zclApp_LoadLimit.State}},
+
+    {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE_SAG_PERIOD, ZCL_UINT16, RW, (void *)&zclApp_Config.PowerQuality.SagPeriod}},
+    {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE_SWELL_PERIOD, ZCL_UINT16, RW, (void *)&zclApp_Config.PowerQuality.SwellPeriod}},
+    {ELECTRICAL, {ATTRID_ELECTRICAL_MEASUREMENT_AC_ALARMS_MASK, ZCL_DATATYPE_BITMAP16, RW, (void *)&zclApp_Config.PowerQuality.AlarmsMask}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_SAG_LEVEL, ZCL_UINT16, RW, (void *)&zclApp_Config.PowerQuality.SagLevel}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_SWELL_LEVEL, ZCL_UINT16, RW, (void *)&zclApp_Config.PowerQuality.SwellLevel}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_VOLTAGE_WATCH_PERIOD, ZCL_UINT16, RW, (void *)&zclApp_Config.PowerQuality.WatchPeriod}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_SAG_COUNT, ZCL_UINT16, RR, (void *)&zclApp_PowerQuality.SagCount}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_SWELL_COUNT, ZCL_UINT16, RR, (void *)&zclApp_PowerQuality.SwellCount}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_OUTAGE_COUNT, ZCL_UINT16, RR, (void *)&zclApp_PowerQuality.OutageCount}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_LAST_EVENT_TYPE, ZCL_DATATYPE_ENUM8, RR, (void *)&zclApp_PowerQuality.LastType}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_LAST_EVENT_VOLTAGE, ZCL_UINT16, RR, (void *)&zclApp_PowerQuality.LastVoltage}},
+    {ELECTRICAL, {ZCL_ATTRID_CUSTOM_LAST_EVENT_DURATION, ZCL_UINT32, RR, (void *)&zclApp_PowerQuality.LastDuration}},
     
-    {TEMP, {ATTRID_MS_TEMPERATURE_MEASURED_VALUE, ZCL_INT16, RR, (void *)&zclApp_Temperature}},
+    {TEMP, {ATTRID_MS_TEMPERATURE_MEASURED_VALUE, ZCL_INT16, RRT, (void *)&zclApp_Temperature}},
+
+    // stack counters, read through zclDiagnostic_ReadWriteAttrCB
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_NUMBER_OF_RESETS, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_PERSISTENT_MEMORY_WRITES, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_MAC_RX_BCAST, ZCL_UINT32, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_MAC_TX_BCAST, ZCL_UINT32, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_MAC_RX_UCAST, ZCL_UINT32, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_MAC_TX_UCAST, ZCL_UINT32, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_MAC_TX_UCAST_RETRY, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_MAC_TX_UCAST_FAIL, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_APS_RX_BCAST, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_APS_TX_BCAST, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_APS_RX_UCAST, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_APS_TX_UCAST_SUCCESS, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_APS_TX_UCAST_RETRY, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_APS_TX_UCAST_FAIL, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_ROUTE_DISC_INITIATED, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_NEIGHBOR_ADDED, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_NEIGHBOR_REMOVED, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_NEIGHBOR_STALE, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_JOIN_INDICATION, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_CHILD_MOVED, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_NWK_DECRYPT_FAILURES, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_APS_DECRYPT_FAILURES, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_PACKET_BUFFER_ALLOCATE_FAILURES, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_RELAYED_UCAST, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_AVERAGE_MAC_RETRY_PER_APS_MESSAGE_SENT, ZCL_UINT16, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_LAST_MESSAGE_LQI, ZCL_UINT8, R, NULL}},
+    {DIAGNOSTICS, {ATTRID_DIAGNOSTIC_LAST_MESSAGE_RSSI, ZCL_INT8, R, NULL}},
+
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_CURRENT_VALUES + LATENCY_ATTR_FIRST_RX, ZCL_UINT32, R, (void *)&zclApp_LatencyCurrentValues.FirstRx}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_CURRENT_VALUES + LATENCY_ATTR_FRAME, ZCL_UINT32, R, (void *)&zclApp_LatencyCurrentValues.Frame}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_CURRENT_VALUES + LATENCY_ATTR_DECODE, ZCL_UINT32, R, (void *)&zclApp_LatencyCurrentValues.Decode}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_CURRENT_VALUES + LATENCY_ATTR_REPORT, ZCL_UINT32, R, (void *)&zclApp_LatencyCurrentValues.Report}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_CURRENT_VALUES + LATENCY_ATTR_MIN, ZCL_UINT32, R, (void *)&zclApp_LatencyCurrentValues.Total.Min}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_CURRENT_VALUES + LATENCY_ATTR_MAX, ZCL_UINT32, R, (void *)&zclApp_LatencyCurrentValues.Total.Max}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_CURRENT_VALUES + LATENCY_ATTR_AVG, ZCL_UINT32, R, (void *)&zclApp_LatencyCurrentValues.Total.Avg}},
+
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_ENERGY + LATENCY_ATTR_FIRST_RX, ZCL_UINT32, R, (void *)&zclApp_LatencyEnergy.FirstRx}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_ENERGY + LATENCY_ATTR_FRAME, ZCL_UINT32, R, (void *)&zclApp_LatencyEnergy.Frame}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_ENERGY + LATENCY_ATTR_DECODE, ZCL_UINT32, R, (void *)&zclApp_LatencyEnergy.Decode}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_ENERGY + LATENCY_ATTR_REPORT, ZCL_UINT32, R, (void *)&zclApp_LatencyEnergy.Report}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_ENERGY + LATENCY_ATTR_MIN, ZCL_UINT32, R, (void *)&zclApp_LatencyEnergy.Total.Min}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_ENERGY + LATENCY_ATTR_MAX, ZCL_UINT32, R, (void *)&zclApp_LatencyEnergy.Total.Max}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_ENERGY + LATENCY_ATTR_AVG, ZCL_UINT32, R, (void *)&zclApp_LatencyEnergy.Total.Avg}},
+
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_DS18B20 + LATENCY_ATTR_MIN, ZCL_UINT32, R, (void *)&zclApp_LatencyDS18B20.Min}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_DS18B20 + LATENCY_ATTR_MAX, ZCL_UINT32, R, (void *)&zclApp_LatencyDS18B20.Max}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_LATENCY_DS18B20 + LATENCY_ATTR_AVG, ZCL_UINT32, R, (void *)&zclApp_LatencyDS18B20.Avg}},
+
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_HEAP_USED, ZCL_UINT16, R, (void *)&zclMemStats.HeapUsed}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_HEAP_PEAK, ZCL_UINT16, R, (void *)&zclMemStats.HeapPeak}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_ALLOC_FAILURES, ZCL_UINT16, R, (void *)&zclMemStats.AllocFailures}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_STACK_PEAK, ZCL_UINT16, R, (void *)&zclMemStats.StackPeak}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_STACK_SIZE, ZCL_UINT16, R, (void *)&zclMemStats.StackSize}},
+
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_TIME_LAST_SYNC, ZCL_UTC, R, (void *)&zclTimeSync.LastSync}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_TIME_LAST_CORRECTION, ZCL_INT32, R, (void *)&zclTimeSync.LastCorrection}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_TIME_SYNC_COUNT, ZCL_UINT16, R, (void *)&zclTimeSync.Count}},
+
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_REJOIN_COUNT, ZCL_UINT16, R, (void *)&zclCommissioning_Rejoin.Stats.Count}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_REJOIN_CACHED_COUNT, ZCL_UINT16, R, (void *)&zclCommissioning_Rejoin.Stats.CachedCount}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_REJOIN_MASK_COUNT, ZCL_UINT16, R, (void *)&zclCommissioning_Rejoin.Stats.MaskCount}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_REJOIN_BACKOFF_COUNT, ZCL_UINT16, R, (void *)&zclCommissioning_Rejoin.Stats.BackoffCount}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_REJOIN_FAILURES, ZCL_UINT16, R, (void *)&zclCommissioning_Rejoin.Stats.Failures}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_REJOIN_LAST_LATENCY, ZCL_UINT32, R, (void *)&zclCommissioning_Rejoin.Stats.LastLatency}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_REJOIN_MAX_LATENCY, ZCL_UINT32, R, (void *)&zclCommissioning_Rejoin.Stats.MaxLatency}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_PARENT_CHANGES, ZCL_UINT16, R, (void *)&zclCommissioning_Rejoin.Stats.ParentChanges}},
+
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_REPORTS_SENT, ZCL_UINT32, R, (void *)&zclApp_ReportsSent}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_REPORTS_DROPPED, ZCL_UINT32, R, (void *)&zclApp_ReportsDropped}},
+    {DIAGNOSTICS, {ZCL_ATTRID_CUSTOM_METER_ERRORS, ZCL_UINT32, R, (void *)&zclApp_MeterErrors}},
 };
 
 uint8 CONST zclApp_AttrsCount_FirstEP = (sizeof(zclApp_Attrs_FirstEP) / sizeof(zclApp_Attrs_FirstEP[0]));
 
-const cId_t zclApp_InClusterList_FirstEP[] = {ZCL_CLUSTER_ID_GEN_BASIC, ELECTRICAL, TEMP};
+const cId_t zclApp_InClusterList_FirstEP[] = {ZCL_CLUSTER_ID_GEN_BASIC, ELECTRICAL, TEMP, DIAGNOSTICS, ALARMS};
 
 #define APP_MAX_IN_CLUSTERS_FIRST_EP (sizeof(zclApp_InClusterList_FirstEP) / sizeof(zclApp_InClusterList_FirstEP[0]))
 
+// load limit switches a bound relay, clock is set from the coordinator
+const cId_t zclApp_OutClusterList_FirstEP[] = {GEN_ON_OFF, TIME};
+
+#define APP_MAX_OUT_CLUSTERS_FIRST_EP (sizeof(zclApp_OutClusterList_FirstEP) / sizeof(zclApp_OutClusterList_FirstEP[0]))
+
 SimpleDescriptionFormat_t zclApp_FirstEP = {
     FIRST_ENDPOINT,                         //  int Endpoint;
     ZCL_HA_PROFILE_ID,                      //  uint16 AppProfId[2];
@@ -134,25 +286,35 @@ SimpleDescriptionFormat_t zclApp_FirstEP = {
     APP_FLAGS,                              //  int   AppFlags:4;
     APP_MAX_IN_CLUSTERS_FIRST_EP,           //  byte  AppNumInClusters;
     (cId_t *)zclApp_InClusterList_FirstEP,  //  byte *pAppInClusterList;
-    0,                                      //  byte  AppNumOutClusters;
-    (cId_t *)NULL                           //  byte *pAppOutClusterList;
+    APP_MAX_OUT_CLUSTERS_FIRST_EP,          //  byte  AppNumOutClusters;
+    (cId_t *)zclApp_OutClusterList_FirstEP  //  byte *pAppOutClusterList;
 };
 
 CONST zclAttrRec_t zclApp_Attrs_SecondEP[] = {
 
-    {SE_METERING, {ATTRID_SE_METERING_CURR_SUMM_DLVD,       ZCL_UINT48, RR, (void *)&zclApp_Energies.Energy_T0}},
-    {SE_METERING, {ATTRID_SE_METERING_CURR_TIER1_SUMM_DLVD, ZCL_UINT48, RR, (void *)&zclApp_Energies.Energy_T1}},
-    {SE_METERING, {ATTRID_SE_METERING_CURR_TIER2_SUMM_DLVD, ZCL_UINT48, RR, (void *)&zclApp_Energies.Energy_T2}},
-    {SE_METERING, {ATTRID_SE_METERING_CURR_TIER3_SUMM_DLVD, ZCL_UINT48, RR, (void *)&zclApp_Energies.Energy_T3}},
-    {SE_METERING, {ATTRID_SE_METERING_CURR_TIER4_SUMM_DLVD, ZCL_UINT48, RR, (void *)&zclApp_Energies.Energy_T4}},
+    {SE_METERING, {ATTRID_SE_METERING_CURR_SUMM_DLVD,       ZCL_UINT48, RRT, (void *)&zclApp_Energies.Energy_T0}},
+    {SE_METERING, {ATTRID_SE_METERING_CURR_TIER1_SUMM_DLVD, ZCL_UINT48, RRT, (void *)&zclApp_Energies.Energy_T1}},
+    {SE_METERING, {ATTRID_SE_METERING_CURR_TIER2_SUMM_DLVD, ZCL_UINT48, RRT, (void *)&zclApp_Energies.Energy_T2}},
+    {SE_METERING, {ATTRID_SE_METERING_CURR_TIER3_SUMM_DLVD, ZCL_UINT48, RRT, (void *)&zclApp_Energies.Energy_T3}},
+    {SE_METERING, {ATTRID_SE_METERING_CURR_TIER4_SUMM_DLVD, ZCL_UINT48, RRT, (void *)&zclApp_Energies.Energy_T4}},
+    {SE_METERING, {ATTRID_SE_METERING_READING_SNAPSHOT_TIME, ZCL_UTC, R, (void *)&zclApp_EnergiesUtc}},
+    {SE_METERING, {ATTRID_SE_METERING_CURR_DAY_CONS_DLVD, ZCL_UINT24, RR, (void *)&zclConsumption.CurrentDay}},
+    {SE_METERING, {ATTRID_SE_METERING_PREV_DAY_CONS_DLVD, ZCL_UINT24, RR, (void *)&zclConsumption.PreviousDay}},
+    {SE_METERING, {ATTRID_SE_METERING_CURR_MONTH_CONS_DLVD, ZCL_UINT32, RR, (void *)&zclConsumption.CurrentMonth}},
+    {SE_METERING, {ATTRID_SE_METERING_PREV_MONTH_CONS_DLVD, ZCL_UINT32, RR, (void *)&zclConsumption.PreviousMonth}},
 
     {SE_METERING, {ZCL_ATTRID_CUSTOM_DEVICE_ADDRESS, ZCL_UINT32, RW, (void *)&zclApp_Config.DeviceAddress}},
     {SE_METERING, {ZCL_ATTRID_CUSTOM_MEASUREMENT_PERIOD, ZCL_UINT16, RW, (void *)&zclApp_Config.MeasurementPeriod}},
+    {SE_METERING, {ZCL_ATTRID_CUSTOM_MAX_AGE, ZCL_UINT16, RW, (void *)&zclApp_Config.MaxAge}},
+    {SE_METERING, {ZCL_ATTRID_CUSTOM_REPORT_JITTER, ZCL_UINT8, RW, (void *)&zclApp_Config.ReportJitter}},
+    {SE_METERING, {ZCL_ATTRID_CUSTOM_CHECKPOINT_INTERVAL, ZCL_UINT16, RW, (void *)&zclApp_Config.CheckpointInterval}},
+    {SE_METERING, {ZCL_ATTRID_CUSTOM_NV_WRITES, ZCL_UINT32, R, (void *)&zclApp_NvWrites}},
+    {SE_METERING, {ZCL_ATTRID_CUSTOM_POLL_RATE, ZCL_UINT16, RW, (void *)&zclApp_Config.PollRate}},
 };
 
 uint8 CONST zclApp_AttrsCount_SecondEP = (sizeof(zclApp_Attrs_SecondEP) / sizeof(zclApp_Attrs_SecondEP[0]));
 
-const cId_t zclApp_InClusterList_SecondEP[] = {SE_METERING};
+const cId_t zclApp_InClusterList_SecondEP[] = {SE_METERING, MERCURY_POLL};
 
 #define APP_MAX_IN_CLUSTERS_SECOND_EP (sizeof(zclApp_InClusterList_SecondEP) / sizeof(zclApp_InClusterList_SecondEP[0]))
 
@@ -178,4 +340,19 @@ void zclApp_ResetAttributesToDefaultValues(void) {
     zclApp_Config.VoltageMultiplier = DEFAULT_Multiplier;
     zclApp_Config.CurrentMultiplier = DEFAULT_Multiplier;
     zclApp_Config.PowerMultiplier = DEFAULT_Multiplier;
+    zclApp_Config.MaxAge = DEFAULT_MaxAge;
+    zclApp_Config.ReportJitter = DEFAULT_ReportJitter;
+    zclApp_Config.CheckpointInterval = DEFAULT_CheckpointInterval;
+    zclApp_Config.PollRate = DEFAULT_PollRate;
+    zclApp_Config.LoadLimit.PowerLimit = DEFAULT_PowerLimit;
+    zclApp_Config.LoadLimit.CurrentLimit = DEFAULT_CurrentLimit;
+    zclApp_Config.LoadLimit.Hysteresis = DEFAULT_LimitHysteresis;
+    zclApp_Config.LoadLimit.HoldTime = DEFAULT_LimitHoldTime;
+    zclApp_Config.LoadLimit.FastPollPeriod = DEFAULT_FastPollPeriod;
+    zclApp_Config.PowerQuality.SagLevel = DEFAULT_SagLevel;
+    zclApp_Config.PowerQuality.SwellLevel = DEFAULT_SwellLevel;
+    zclApp_Config.PowerQuality.SagPeriod = DEFAULT_SagPeriod;
+    zclApp_Config.PowerQuality.SwellPeriod = DEFAULT_SwellPeriod;
+    zclApp_Config.PowerQuality.WatchPeriod = DEFAULT_VoltageWatchPeriod;
+    zclApp_Config.PowerQuality.AlarmsMask = DEFAULT_AlarmsMask;
 }
\ No newline at end of file
@@ -8,9 +8,72 @@ const reporting = require('zigbee-herdsman-converters/lib/reporting');
 const {postfixWithEndpointName} = require('zigbee-herdsman-converters/lib/utils');
 
 const ACCESS_STATE = 0b001, ACCESS_WRITE = 0b010, ACCESS_READ = 0b100;
+const ZCL_DATATYPE_UINT8 = 0x20;
 const ZCL_DATATYPE_UINT16 = 0x21;
 const ZCL_DATATYPE_UINT32 = 0x23;
 const ZCL_DATATYPE_UINT48 = 0x25;
+const ZCL_DATATYPE_INT16 = 0x29;
+
+const LOAD_LIMIT_ATTRS = {
+    power_limit: {ID: 0xF010, type: ZCL_DATATYPE_INT16},
+    current_limit: {ID: 0xF011, type: ZCL_DATATYPE_UINT16},
+    limit_hysteresis: {ID: 0xF012, type: ZCL_DATATYPE_UINT8},
+    limit_hold_time: {ID: 0xF013, type: ZCL_DATATYPE_UINT16},
+    fast_poll_period: {ID: 0xF014, type: ZCL_DATATYPE_UINT16},
+};
+const LOAD_LIMIT_STATES = ['normal', 'pending_off', 'tripped', 'pending_on'];
+
+// day and month figures kept by the device, known to herdsman by name or only by ID
+const CONSUMPTION_ATTRS = {
+    energy_today: {ID: 0x0401, name: 'currentDayConsumpDelivered'},
+    energy_yesterday: {ID: 0x0403, name: 'previousDayConsumpDelivered'},
+    energy_this_month: {ID: 0x0440},
+    energy_last_month: {ID: 0x0442},
+};
+
+const POWER_QUALITY_ATTRS = {
+    sag_level: {ID: 0xF020, type: ZCL_DATATYPE_UINT16},
+    swell_level: {ID: 0xF021, type: ZCL_DATATYPE_UINT16},
+    voltage_watch_period: {ID: 0xF022, type: ZCL_DATATYPE_UINT16},
+    sag_period: {ID: 0x0516, type: ZCL_DATATYPE_UINT16},
+    swell_period: {ID: 0x0517, type: ZCL_DATATYPE_UINT16},
+};
+const POWER_QUALITY_COUNTERS = {
+    sag_count: 0xF023,
+    swell_count: 0xF024,
+    outage_count: 0xF025,
+};
+const POWER_QUALITY_EVENTS = ['none', 'sag', 'swell', 'outage'];
+const POWER_QUALITY_ALARMS = {0x07: 'outage', 0x08: 'sag', 0x09: 'swell'};
+
+// Diagnostics cluster on endpoint 1, read only, not reported
+const MEM_STATS_ATTRS = {
+    heap_used: 0xF130,
+    heap_peak: 0xF131,
+    alloc_failures: 0xF132,
+    stack_peak: 0xF133,
+    stack_size: 0xF134,
+};
+
+const POLL_MASKS = {all: 0x07, instantaneous: 0x01, energy: 0x02, temperature: 0x04};
+
+// manufacturer specific cluster on endpoint 2, the meter answers a poll with attribute reports
+const mercuryPollCluster = {
+    ID: 0xFC00,
+    attributes: {},
+    commands: {
+        pollNow: {ID: 0x00, parameters: [{name: 'mask', type: ZCL_DATATYPE_UINT8}]},
+    },
+    commandsResponse: {},
+};
+
+const registerPollCluster = (device) => {
+    if (device.customClusters && device.customClusters.mercuryPoll) return;
+    if (typeof device.addCustomCluster !== 'function') {
+        throw new Error('poll_now needs zigbee-herdsman with custom cluster support');
+    }
+    device.addCustomCluster('mercuryPoll', mercuryPollCluster);
+};
 
 const fz_local = {
     se_metering: {
@@ -52,26 +115,122 @@ const fz_local = {
                 energy_all += result.energy_t4;
             }
             
+            for (const [key, attr] of Object.entries(CONSUMPTION_ATTRS)) {
+                const name = attr.name && msg.data.hasOwnProperty(attr.name) ? attr.name : attr.ID;
+                if (msg.data.hasOwnProperty(name)) {
+                    result[key] = msg.data[name] / 100;
+                }
+            }
+            if (msg.data.hasOwnProperty('readingSnapShotTime')) {
+                // ZCL time counts from 2000-01-01
+                result.reading_time = new Date((msg.data['readingSnapShotTime'] + 946684800) * 1000).toISOString();
+            }
             if (msg.data.hasOwnProperty(0xF001)) {
                 result[postfixWithEndpointName('device_address', msg, model, meta)] = msg.data[0xF001];
             }
             if (msg.data.hasOwnProperty(0xF002)) {
                 result[postfixWithEndpointName('measurement_period', msg, model, meta)] = msg.data[0xF002];
             }
+            if (msg.data.hasOwnProperty(0xF003)) {
+                result[postfixWithEndpointName('max_age', msg, model, meta)] = msg.data[0xF003];
+            }
+            if (msg.data.hasOwnProperty(0xF005)) {
+                result[postfixWithEndpointName('checkpoint_interval', msg, model, meta)] = msg.data[0xF005];
+            }
+            if (msg.data.hasOwnProperty(0xF006)) {
+                result.nv_writes = msg.data[0xF006];
+            }
+            if (msg.data.hasOwnProperty(0xF007)) {
+                result[postfixWithEndpointName('poll_rate', msg, model, meta)] = msg.data[0xF007];
+            }
+            if (msg.data.hasOwnProperty(0xF004)) {
+                result[postfixWithEndpointName('report_jitter', msg, model, meta)] = msg.data[0xF004];
+            }
             result.energy_all = energy_all.toFixed(3);
             return result;
         },
     }, 
 };
 
+fz_local.load_limit = {
+    cluster: 'haElectricalMeasurement',
+    type: ['attributeReport', 'readResponse'],
+    convert: (model, msg, publish, options, meta) => {
+        const result = {};
+        for (const [key, attr] of Object.entries(LOAD_LIMIT_ATTRS)) {
+            if (msg.data.hasOwnProperty(attr.ID)) {
+                result[key] = msg.data[attr.ID];
+            }
+        }
+        if (msg.data.hasOwnProperty(0xF015)) {
+            result.limit_state = LOAD_LIMIT_STATES[msg.data[0xF015]];
+        }
+        return result;
+    },
+};
+
+fz_local.power_quality = {
+    cluster: 'haElectricalMeasurement',
+    type: ['attributeReport', 'readResponse'],
+    convert: (model, msg, publish, options, meta) => {
+        const result = {};
+        for (const [key, attr] of Object.entries(POWER_QUALITY_ATTRS)) {
+            if (msg.data.hasOwnProperty(attr.ID)) {
+                result[key] = key.endsWith('_level') ? msg.data[attr.ID] / 10 : msg.data[attr.ID];
+            }
+        }
+        for (const [key, ID] of Object.entries(POWER_QUALITY_COUNTERS)) {
+            if (msg.data.hasOwnProperty(ID)) {
+                result[key] = msg.data[ID];
+            }
+        }
+        if (msg.data.hasOwnProperty(0xF027)) {
+            result.last_event_voltage = msg.data[0xF027] / 10;
+        }
+        if (msg.data.hasOwnProperty(0xF028)) {
+            result.last_event_duration = msg.data[0xF028] / 1000;
+        }
+        if (msg.data.hasOwnProperty(0xF026)) {
+            result.last_event = POWER_QUALITY_EVENTS[msg.data[0xF026]];
+        }
+        return result;
+    },
+};
+
+fz_local.mem_stats = {
+    cluster: 'haDiagnostic',
+    type: ['attributeReport', 'readResponse'],
+    convert: (model, msg, publish, options, meta) => {
+        const result = {};
+        for (const [key, ID] of Object.entries(MEM_STATS_ATTRS)) {
+            if (msg.data.hasOwnProperty(ID)) {
+                result[key] = msg.data[ID];
+            }
+        }
+        return result;
+    },
+};
+
+fz_local.voltage_alarm = {
+    cluster: 'genAlarms',
+    type: ['commandAlarm'],
+    convert: (model, msg, publish, options, meta) => {
+        return {voltage_alarm: POWER_QUALITY_ALARMS[msg.data.alarmcode]};
+    },
+};
+
 const tz_local = {
     se_metering: {
-        key: ['device_address', 'measurement_period'],
+        key: ['device_address', 'measurement_period', 'max_age', 'report_jitter', 'checkpoint_interval', 'poll_rate'],
         convertSet: async (entity, key, value, meta) => {
             value *= 1;
             const payloads = {
                 device_address: ['seMetering', {0XF001: {value, type: ZCL_DATATYPE_UINT32}}],
                 measurement_period: ['seMetering', {0XF002: {value, type: ZCL_DATATYPE_UINT16}}],
+                max_age: ['seMetering', {0XF003: {value, type: ZCL_DATATYPE_UINT16}}],
+                report_jitter: ['seMetering', {0XF004: {value, type: ZCL_DATATYPE_UINT8}}],
+                checkpoint_interval: ['seMetering', {0XF005: {value, type: ZCL_DATATYPE_UINT16}}],
+                poll_rate: ['seMetering', {0XF007: {value, type: ZCL_DATATYPE_UINT16}}],
             };
             await entity.write(payloads[key][0], payloads[key][1]);
             return {
@@ -82,6 +241,10 @@ const tz_local = {
             const payloads = {
                 device_address: ['seMetering', 0XF001],
                 measurement_period: ['seMetering', 0XF002],
+                max_age: ['seMetering', 0XF003],
+                report_jitter: ['seMetering', 0XF004],
+                checkpoint_interval: ['seMetering', 0XF005],
+                poll_rate: ['seMetering', 0XF007],
             };
             await entity.read(payloads[key][0], [payloads[key][1]]);
         },
@@ -89,13 +252,61 @@ const tz_local = {
 };
 
 
+tz_local.load_limit = {
+    key: Object.keys(LOAD_LIMIT_ATTRS),
+    convertSet: async (entity, key, value, meta) => {
+        value *= 1;
+        const attr = LOAD_LIMIT_ATTRS[key];
+        await meta.device.getEndpoint(1).write('haElectricalMeasurement', {[attr.ID]: {value, type: attr.type}});
+        return {
+            state: {[key]: value},
+        };
+    },
+    convertGet: async (entity, key, meta) => {
+        await meta.device.getEndpoint(1).read('haElectricalMeasurement', [LOAD_LIMIT_ATTRS[key].ID]);
+    },
+};
+
+tz_local.power_quality = {
+    key: Object.keys(POWER_QUALITY_ATTRS),
+    convertSet: async (entity, key, value, meta) => {
+        value *= 1;
+        const attr = POWER_QUALITY_ATTRS[key];
+        const raw = key.endsWith('_level') ? Math.round(value * 10) : value;
+        await meta.device.getEndpoint(1).write('haElectricalMeasurement', {[attr.ID]: {value: raw, type: attr.type}});
+        return {
+            state: {[key]: value},
+        };
+    },
+    convertGet: async (entity, key, meta) => {
+        await meta.device.getEndpoint(1).read('haElectricalMeasurement', [POWER_QUALITY_ATTRS[key].ID]);
+    },
+};
+
+tz_local.mem_stats = {
+    key: Object.keys(MEM_STATS_ATTRS),
+    convertGet: async (entity, key, meta) => {
+        await meta.device.getEndpoint(1).read('haDiagnostic', [MEM_STATS_ATTRS[key]]);
+    },
+};
+
+tz_local.poll_now = {
+    key: ['poll_now'],
+    convertSet: async (entity, key, value, meta) => {
+        const mask = POLL_MASKS.hasOwnProperty(value) ? POLL_MASKS[value] : value * 1;
+        registerPollCluster(meta.device);
+        await meta.device.getEndpoint(2).command('mercuryPoll', 'pollNow', {mask}, {disableDefaultResponse: true});
+    },
+};
+
 const device = {
     zigbeeModel: ['Mercury_Counter'],
     model: 'Mercury_Counter',
     description: 'Zigbee Mercury Counter',
     vendor: 'Bacchus',
-    fromZigbee: [fz.electrical_measurement, fz_local.se_metering, fz.temperature],
-    toZigbee: [tz_local.se_metering],
+    fromZigbee: [fz.electrical_measurement, fz_local.se_metering, fz_local.load_limit, fz_local.power_quality,
+        fz_local.voltage_alarm, fz_local.mem_stats, fz.temperature],
+    toZigbee: [tz_local.se_metering, tz_local.load_limit, tz_local.power_quality, tz_local.mem_stats, tz_local.poll_now],
     meta: {multiEndpoint: true},
     endpoint: (device) => {
         return {
@@ -103,16 +314,26 @@ const device = {
         };
     },
 configure: async (device, coordinatorEndpoint, logger) => {
+        if (typeof device.addCustomCluster === 'function') registerPollCluster(device);
         const first_endpoint = device.getEndpoint(1);
         const second_endpoint = device.getEndpoint(2);
-        await reporting.bind(first_endpoint, coordinatorEndpoint, ['genBasic', 'haElectricalMeasurement', 'msTemperatureMeasurement']);
+        await reporting.bind(first_endpoint, coordinatorEndpoint, ['genBasic', 'haElectricalMeasurement', 'msTemperatureMeasurement', 'genAlarms']);
         await reporting.bind(second_endpoint, coordinatorEndpoint, ['seMetering']);
 
         await second_endpoint.read('seMetering', [0xF001]); // device_address
         await second_endpoint.read('seMetering', [0xF002]); // measurement_period
+        await second_endpoint.read('seMetering', [0xF003]); // max_age
+        await second_endpoint.read('seMetering', [0xF004]); // report_jitter
+        await second_endpoint.read('seMetering', [0xF005]); // checkpoint_interval
+        await second_endpoint.read('seMetering', [0xF006]); // nv_writes
+        await second_endpoint.read('seMetering', [0xF007]); // poll_rate
+        await second_endpoint.read('seMetering', Object.values(CONSUMPTION_ATTRS).map((attr) => attr.ID));
         await first_endpoint.read('haElectricalMeasurement', ['acVoltageMultiplier', 'acVoltageDivisor']);
         await first_endpoint.read('haElectricalMeasurement', ['acCurrentMultiplier', 'acCurrentDivisor']);
         await first_endpoint.read('haElectricalMeasurement', ['acPowerMultiplier', 'acPowerDivisor']);
+        await first_endpoint.read('haElectricalMeasurement', Object.values(LOAD_LIMIT_ATTRS).map((attr) => attr.ID).concat([0xF015]));
+        await first_endpoint.read('haElectricalMeasurement', Object.values(POWER_QUALITY_ATTRS).map((attr) => attr.ID));
+        await first_endpoint.read('haDiagnostic', Object.values(MEM_STATS_ATTRS));
 
         await reporting.rmsVoltage(first_endpoint);
         await reporting.rmsCurrent(first_endpoint);
@@ -136,9 +357,46 @@ configure: async (device, coordinatorEndpoint, logger) => {
         e.numeric('energy_t3', ACCESS_STATE).withUnit('kWh').withDescription('Energy on tariff 3'), 
         e.numeric('energy_t4', ACCESS_STATE).withUnit('kWh').withDescription('Energy on tariff 4'), 
         e.numeric('energy_all', ACCESS_STATE).withUnit('kWh').withDescription('Full Energy'), 
+        e.numeric('energy_today', ACCESS_STATE).withUnit('kWh').withDescription('Energy since local midnight'),
+        e.numeric('energy_yesterday', ACCESS_STATE).withUnit('kWh').withDescription('Energy of the previous day'),
+        e.numeric('energy_this_month', ACCESS_STATE).withUnit('kWh').withDescription('Energy since the first day of the month'),
+        e.numeric('energy_last_month', ACCESS_STATE).withUnit('kWh').withDescription('Energy of the previous month'),
+        e.numeric('nv_writes', ACCESS_STATE).withDescription('Config writes to flash since first start'),
+        e.text('reading_time', ACCESS_STATE).withDescription('Time the energy values were read from the meter'),
 
         e.text('device_address', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withDescription('Device Address').withEndpoint('l2'), 
-        e.numeric('measurement_period', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('sec').withDescription('Measurement Period').withValueMin(0).withValueMax(600).withEndpoint('l2')
+        e.numeric('measurement_period', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('sec').withDescription('Measurement Period').withValueMin(0).withValueMax(600).withEndpoint('l2'),
+        e.numeric('max_age', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('sec').withDescription('Reading a value older than this polls the meter and reports the fresh value to the reader, 0 - off').withValueMin(0).withValueMax(3600).withEndpoint('l2'),
+        e.numeric('report_jitter', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('%').withDescription('Random shift of every report around its slot, percent of the period').withValueMin(0).withValueMax(45).withEndpoint('l2'),
+        e.numeric('checkpoint_interval', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('min').withDescription('Energy registers are saved to flash this often, restored after reboot, 0 - off').withValueMin(0).withValueMax(1440).withEndpoint('l2'),
+        e.numeric('poll_rate', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('ms').withDescription('Parent poll rate of end device builds between fast poll windows, 0 - don\'t poll').withValueMin(0).withValueMax(65000).withEndpoint('l2'),
+        e.enum('poll_now', ACCESS_WRITE, Object.keys(POLL_MASKS)).withDescription('Read the meter now, values arrive as reports'),
+
+        e.numeric('power_limit', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('W').withDescription('Bound relay is switched off above this power, 0 - off').withValueMin(0).withValueMax(32767),
+        e.numeric('current_limit', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withDescription('Bound relay is switched off above this current (raw RMS current units), 0 - off').withValueMin(0).withValueMax(65535),
+        e.numeric('limit_hysteresis', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('%').withDescription('Relay is switched back on below limit minus hysteresis').withValueMin(0).withValueMax(100),
+        e.numeric('limit_hold_time', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('sec').withDescription('Time over or under the limit before switching').withValueMin(0).withValueMax(3600),
+        e.numeric('fast_poll_period', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('sec').withDescription('Poll period while close to the limit').withValueMin(1).withValueMax(60),
+        e.enum('limit_state', ACCESS_STATE, LOAD_LIMIT_STATES).withDescription('Load limit state'),
+
+        e.numeric('sag_level', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('V').withDescription('Voltage sag below this level, 0 - off').withValueMin(0).withValueMax(300),
+        e.numeric('swell_level', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('V').withDescription('Voltage swell above this level, 0 - off').withValueMin(0).withValueMax(300),
+        e.numeric('sag_period', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('sec').withDescription('Sag shorter than this is ignored').withValueMin(0).withValueMax(3600),
+        e.numeric('swell_period', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('sec').withDescription('Swell shorter than this is ignored').withValueMin(0).withValueMax(3600),
+        e.numeric('voltage_watch_period', ACCESS_STATE | ACCESS_WRITE | ACCESS_READ).withUnit('sec').withDescription('Voltage only read period, 0 - off').withValueMin(0).withValueMax(3600),
+        e.numeric('sag_count', ACCESS_STATE).withDescription('Voltage sags since start'),
+        e.numeric('swell_count', ACCESS_STATE).withDescription('Voltage swells since start'),
+        e.numeric('outage_count', ACCESS_STATE).withDescription('Meter outages since start'),
+        e.enum('last_event', ACCESS_STATE, POWER_QUALITY_EVENTS).withDescription('Last finished voltage event'),
+        e.numeric('last_event_voltage', ACCESS_STATE).withUnit('V').withDescription('Lowest voltage of the last sag, highest of the last swell'),
+        e.numeric('last_event_duration', ACCESS_STATE).withUnit('sec').withDescription('Duration of the last voltage event'),
+        e.enum('voltage_alarm', ACCESS_STATE, Object.values(POWER_QUALITY_ALARMS)).withDescription('Last voltage alarm'),
+
+        e.numeric('heap_used', ACCESS_STATE | ACCESS_READ).withUnit('B').withDescription('Heap in use when last sampled'),
+        e.numeric('heap_peak', ACCESS_STATE | ACCESS_READ).withUnit('B').withDescription('Largest heap use seen by the periodic samples and application allocations, peaks between samples are missed'),
+        e.numeric('alloc_failures', ACCESS_STATE | ACCESS_READ).withDescription('Failed application heap allocations since start, allocations of the Zigbee stack are not counted'),
+        e.numeric('stack_peak', ACCESS_STATE | ACCESS_READ).withUnit('B').withDescription('Deepest stack use since start'),
+        e.numeric('stack_size', ACCESS_STATE | ACCESS_READ).withUnit('B').withDescription('Stack size')
     ],
 icon: 'data:image/png;base64,/9j/4AAQSkZJRgABAQEAYABgAAD/4QBmRXhpZgAATU0AKgAAAAgABAEaAAUAAAABAAAAPgEbAAUAAAABAAAARgEoAAMAAAABAAIAAAExAAIAAAAQAAAATgAAAAAAAABgAAAAAQAAAGAAAAABUGFpbnQuTkVUIDUuMS43AP/bAEMAAgEBAQEBAgEBAQICAgICBAMCAgICBQQEAwQGBQYGBgUGBgYHCQgGBwkHBgYICwgJCgoKCgoGCAsMCwoMCQoKCv/bAEMBAgICAgICBQMDBQoHBgcKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCgoKCv/AABEIAgACAAMBEgACEQEDEQH/xAAfAAABBQEBAQEBAQAAAAAAAAAAAQIDBAUGBwgJCgv/xAC1EAACAQMDAgQDBQUEBAAAAX0BAgMABBEFEiExQQYTUWEHInEUMoGRoQgjQrHBFVLR8CQzYnKCCQoWFxgZGiUmJygpKjQ1Njc4OTpDREVGR0hJSlNUVVZXWFlaY2RlZmdoaWpzdHV2d3h5eoOEhYaHiImKkpOUlZaXmJmaoqOkpaanqKmqsrO0tba3uLm6wsPExcbHyMnK0tPU1dbX2Nna4eLj5OXm5+jp6vHy8/T19vf4+fr/xAAfAQADAQEBAQEBAQEBAAAAAAAAAQIDBAUGBwgJCgv/xAC1EQACAQIEBAMEBwUEBAABAncAAQIDEQQFITEGEkFRB2FxEyIygQgUQpGhscEJIzNS8BVictEKFiQ04SXxFxgZGiYnKCkqNTY3ODk6Q0RFRkdISUpTVFVWV1hZWmNkZWZnaGlqc3R1dnd4eXqCg4SFhoeIiYqSk5SVlpeYmZqio6Slpqeoqaqys7S1tre4ubrCw8TFxsfIycrS09TV1tfY2dri4+Tl5ufo6ery8/T19vf4+fr/2gAMAwEAAhEDEQA/AP38ooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKq6hq1hpkJlv72OAYzmVwP50Wb0QN2LVeT+PP2i/Euha+dJ8FfDuHWLVIwW1GfWFt0diOiKEZiB3PFaxoVWTzxPV2fHSvnyb9pf9oCV98Hwf0MJ/CD4gcHH/fmtFhar7C9ok9Fc+gt7f3K+eD+0p+0NhiPhFovHp4iP/wAYp/VKvl94vaeR9D727oa+dm/aZ/aFVcn4PaSfYeJMf+0Kf1Ot5feP2nkfRIc9xXzqf2mP2hBGZP8AhT2nDjgf26W/XyaPqdfy+8TqpdD6L3j2r5nvP2s/2hrOEyTfA2xCgZMjeJo1UD1JaIACj6nX8vvJ9rE+l/MPp+tfAvxk/wCC2Hg/4DOLP4i2XhxL92Aj0rTvFcc9yx7jYsX9aFgq7dtPvE60Eru/3H315gzyK/OC0/4L3+GdRQi0+F8wYruUnUU5H0K1r/ZmKtfQyeOoJ2dz9IAwPQ1+fNn/AMF3fCLRr5nwSus4+Zv7XQZ/DbU/2di/5R/XcP3P0GLYr8/2/wCC7vgmPLTfBW7AHf8AtaPA+pK8Unl+L/lE8fh07as+/wDf7frXw/4F/wCCxs/xKuFsfA37L3iHVJnPymxug6Y92KAfrS/s/FfymkcTTnsn9x9wBxnkV8wf8N1fGeaDzIf2S9WQ/wB2XW4M1P1Ov5feV7WJ9Qbl9a+Yn/be+Nsasw/Za1I47HWrf/Cj6lX7r7x+1j5s+nd6+tfK037fHxogi80/sj642Dggaxbfn0o+pV/L7x+1j/K/uPqnf6D9a+TT/wAFC/jEp2j9kPxCf9oanb4FP6lX8vvJdWN9n9x9Zbj6D86+Tj/wUO+L3JP7IfiOPHZr6DP6ZpfU6/l94e2j5/cfWJcD0/OvkG4/4KR/F+OTyv8Ahj/xLg9HN9EB/wCg0fUq/dfeL28ez+4+vg4I5r4yj/4KZ/G5pnVv2M/EGxZAodNSjOR68pVLAYiXb7w+sQX2X9x9mGVQcV8fH/gpV8UcN5n7JPiRGXt9pjO72Hy1X9n4jy+8PrMOz+4+wfNX2/OvjeX/AIKb/E+JVP8AwyJ4sOeuJI+P/HaX1Gt5feHt49n9x9keYvYg/jXxqn/BTv4lA8/si+Lf++k/+JpPA111X3g68V0f3H2WGyMjH518br/wU8+JWCR+yJ4tOB2Kf/E1P1Kv3X3h7ePZ/cfY5lUHFfGaf8FQvibPkr+x/wCKkcHhJXUBvxC1ay/ENX0+8PrFPz+4+yxMpNfG8X/BTn4oFs3H7H/iZVPTZcqSPr+74oeX4jy+8PrFPz+4+yfMTswr41uf+Cl/xLlDJF+yf4rjAXO9Z1z+sVH9n4ryD6zT7P7j7KMqg4xXwH4u/bj+ImvfPd/AX4pEOh/c2OqxxDH4RZo+oV1vb7w+s0+z+4++/OToTz9a+GYf+Cl3xNttFg0aD9lL4gxrFEEE5uI2lIA6sTFyaPqNa/T7w+s0+z+4+5hLuGQOvTmvzzvv29viZdapBrU/7PfxXeWOVWjjTVU25BzyggAI9qbwFZLp94e3T+y/uP0MEqn04OOtfFx/4KofEsp5i/sW+MXGOG3/AP2us/qWIe1vvD6xDqn9x9peYD0H618Wn/gqp8R4k3Sfsa+LF9cv/wDa6PqGK8g+sUvP7j7S3n0/Wvisf8FXvHbqx/4Y/wDFylE3dB8w9vl6+1UsBibdPvH7aD7/AHH2oZMDOOnqa+H1/wCCq/jjWV2Rfsq+ObUnoVgVcfiy0/qGI8vvB14Lo/uPt/zR6Z47V+fWo/t/+ItU1WO/v/g38WFMc6uIoZo1TIPTAXpR9RreX3i+s0+z+4/QYSqR1/WvhnWv+CqniaYPYf8ADN3xBtWztMtrZxsR+O3FH1Gt3X3i+sw7P7j7lEvP3eOxz1r8+NM/4KK3+leJoPE1x8Hvi/dvA+77LNAjQyDuNqij6jW8vvH9Zp9n9x+hG8+n618Uz/8ABYPykDj9k3x97507/wCtU/UcV2X3h9Ypef3H2vvPoPzr4kH/AAWNGf8Ak0vx7/4Af/WpfUcV2X3h9Ypef3H20ZAOuPzr4pP/AAWDibB/4ZS8edOn2Dn+VH1HFdl94fWKXn9x9qiZTnpx6GviG6/4K4G+LQR/s1fEe2JPHk6MjY/EsKr6lV6h9Zp9mfb/AJqkfL17A1+f1/8A8FGRd6rDq1z8LvjSvkzhkijsIFjbHZgHGRT+pTD6xTfR/cfoB5vquPxr4mvv+CrUd6HgT9nr4n2xxndbaFASPpmWl9TqD9tDz+4+2TKQM7frzXwp4c/4KI2Fj4ji8Sz/AAt+Nt20ZINnc6FA0LgjphZePrSeEqB7aHn9x92B8jOP1r5KX/gqt4eCj/jGj4mDA6f8I2o/9q1P1Wr2D20Oz+4+t6+Sj/wVU0hvufs1fEce50FP/jtL6rX7F88T60JIHAzXyFqP/BWnwpo2nzavrfwC8e2VpboWnubrRkRUA7kmTpR9VrdUTKpGK3Pr0tgZIr4Ntf8AgvX+zjqduLrTfB/iCSNiQjG0h7HHP77itI4DEz2iZ/WqEd2feO/HUV8OW3/Bdn9msQbr74feKi4+80FvBtP0/e0PL8YtOQf1qg9eY+5a+H1/4LxfsslgG8CeLgM8n7LCcflJUvAYxK/ICxND+Y+4Mj3/ACr4pv8A/guz+yBZSKseieKJlK5d4rCP5D6YaQZ/Cp+p4v8AkK+sUe59rZzXyF4C/wCCyHwI+KF09n8PfhR491h4yNxsdHjZB9W8zAPtnNH1TEreJUasJbM+va+bx/wUIE03l2/7PHjoDP8Ay002AfznH8qPqtfsPnifSFfOZ/b3vRg/8M6+Nvu5/wCPW1/+SKn6tX7BzxPoyvnn/hvC7I+T9nrxmxxnP2W2/wDkij6vWW6DnifQ1fPa/t13rRhj+z34yB/69rb/AOSKPq9XsHPE+hK+fT+3Reg/8m/eMPxtbb/5Io+q12PnifQVfPg/bsnJ5+AHjLHtZ25/9r0LC17hzxPoOvmfxb/wUn8L+BNHl17xd8G/F1jawJmWSSxhbH4LNn8gar6rX7BzxPpivAfAX7fXw6+I+laX4p8M2Ms+kamPlut2148HByh5yDxSeFr9iHWhF2Z78Pesfwn400Hxrpf9reHr7zow+1wRhlPoR2rCUakHZo0T5lobFFAwooACQOppsgzge4zQB4N+2/8AtbJ+zn4dtND0C9t18Q60SNNScA7VX7zY/ir84v8Agt3+0ytl/wAFK/hH8GbzUxHosUVnPrQU42rNdskmT/uIenoK7cKqTfvIXLJnuGr/ALTX7VGrONTfz7nzQDEz2YcHvkA4xxXgfxp/4KCWOqzm68GwqtskzqkdvxtUHCgf8BxXpyeHXQXJJ7ntM37Q/wC1XETJFp58sDobADB96+Ntf/4KA+ObKENFdOZWbcn73A2jsRU81EXskfYiftG/tXNGqro4B285sV6/Q1+f+u/8FPviXp1wpjvpChciZvNycegz0p81B9A9mffX/DS/7WgIC6fuX+IjThz+Rr86Jf8AgrT8Q7VRp66psJbako6/jSvQ7B7M/Qu5/az/AGpbVGdtFYLFwZBpx/POK/PzW/8Agrp43h80LqJkbyydhYgZ2rx074NO9HsHsz6r/ag/4Ku/GL9nzwDd+ItQubGTUFTZbWj2YJMrZChh9fpXwV4c+J99+0l4X8YalrXhkeItYvdZg0/w9HdzLHHY7UMs9y7MCcL5qKMDJJ9jUzjCatEajGPxHn/xw/4KHf8ABQD9qW6lh8cfGbXBYSsf+JRpD/YrVAexCAZGP7xNes6X+wj4c1eKK7+IvxluLESNuks9JMEoH+zmQDjtnrWfsWP9z2PkXTfDPiWDX7eK58SRGaa6jVoTNuZyXGST0/M1+hfw8/ZI/Yr8CMh1O11G+uQV/fXEsTEsGznDPgcelbQpKKuKdWLjyo8Gk8O2PxNntLGH4s23hxLO0ZJry4lYLLhuvB9K+vtW8AfsY2TJZ3vha4JRRkBoM8jPTfXQ6loWOGVJSkfCHxQ+GfjbwT4it9K8I/tEabrMF1YpcLfDVJIVQtnKHrjGPwzX3z4b+Bf7GnjHV7TQbDwpei6u7mK2t5Bb28m1pHCgbSxDdRway5pdzaGHj2POf2Rvgfp/wN0TTvFnxb0qy8a+J9VhjuoItauJLqzsYpDuhVIshXcrg72BPPSvn6b9vjX7b9pzUNS1+4b+zrPXZWsdNjb/AFUaMwiQ9gFTaABxip9pDqzb2EV0P1I0X9sb4+6DYppuh/DfT7W0jG2KK00by41HoAABXxDP/wAFXNckgkmm1CMP1jJQLn6DvR7Sl3H7JH3a37a/7TZZBF4Ht8Fv4tOb/Gvz3vf+CtHjO3UNJfW8wL5QpH/MVn+67B7JH6CP+2x+00rHzPA1mVz8wNif8etfnin/AAV28a/PCptV/eEuxj7deMEUXpdhqm47H6Gn9tn9pdZNp+Hdocj5R/Z7Zx+dfnvF/wAFgfGIBgkih3MuRIqngY+tL912C0z9B0/bh/aOCYk+G9mR0O2zb/Gvz5X/AIK++Mol2SaZblnf5HyOB7irTo22C0j9AIv25f2iL0NDL8MbNI+zi2YZ/HNfAMn/AAV78QXBEjWcaqf+WfmYH6Cnej2C0j9Ak/bi+P8AbEL/AMKwtG38rm1evz//AOHuGrSvtEIXK4zkDbx2PU0Xo9gtI/QIft4fHbdsPwwtchckm1evz/T/AIKra1M29rlU3YCqGDZ/SpbpdEFpH3037fnxwjAZ/hZaH5882r8V8B3P/BVfWxMWe+RI+4cgj8MGlemFpH30f+ChnxktDl/hJZ/8CtnFfEfwZ/b++IXxw+K2i/Cjwobea/1i9WCGKXIAHdiQOFAyT7A0KnfYTbjufSfxE/4LY+K/BN9N4f0z4eaTeapGSpgETna3oQOfw618n/tM/H3R9Q+It94U8E+HdKtbe0lNte6pbR4lu5o3y0hYg4Xcvygg9KcaUZOzZLnK2h9FWP8AwVT/AOChPj1EfwH8GtHjhuF8yFzon8Gf780iKOSOp9OK81/Z98R23iGBZNUaS5S1kCFnXiWMDKl13KOAI/u47/LXTDDw7ke1kj2HVPj9/wAFmPEFt9rtbHw9pMBjEnnm606NNp6DJc88Efga9B0S6s7zTG1G4uSyxxMRAyqUdgOFIXhs7jgnGKbwquL2jfQ+dfiN+0z/AMFUvAtwYvE/xd0S2d2cSvaaranYV2cErDgE7+AeuD6VD+0vaSW0sup29mzJGWWV4ZNmCVwCQwOOuccj5T6VDoRir3KU23seL+M/+CpH7d/h5ZTf/Gu6kkjcpLFb36rtIB6lU6ce1eCfE3WNOlSYWflfaY4wrFHVkznG8cAnPIwa55mmrPQLv/gsl+1thRe/ETX2AJBMOuThT/3z2r5wutNvr6xnlklS0NzHmzubiQQwvzgMueWB7YHNZLnWxpGCa95H0bZf8FnP2kYABqfjfX5E3fcGuXGGH1zXG/s2/wDBKv4+/tVeIrDRvhzpM2rG5R3utbuJZLTTYAi7mDStCwY46Acn070nKS3aDkpHs/gv/gth8QTdOPFOr+IXQLtTytWmP1PB9K8h/aM/4JY/tbfskpJ4m1z4cahJpsGd+raJP9tgUL1Y+UN4A7l02j1pwqpj9mz7y+B3/BVX4ceNb+2tvE/xL8XaZDKFE1xPqDBI2xyoznd2P4Gvz++BHxC8L6nJHH4mjhGAnzIQUYEfe4BJOcD8a6oTT6EVINI/eT4I+OvhF8VNGgvfD/7Y4V2OHS9u4gVPod8Yx1FfA37M3jDwvc6VbtHdQRNbzn7QsMHIVirfP8uMZJ5NaexjPqYXSP1k074Xai1sn9m/HHSdSB5jy1u+fcbcV8La5f6SdCEpuFtJk/d24aYs2doLBflKrwQeCOtDw8kh3Pp79qLx78YP2b9Fh8Uv4S0zWtPY/vLgKyOmecnGRivn/wAAftFeKPHX7NvxW+AvjHVpby803wZPrHh5rk7nR4FDSIufvZUqQCfWueVNxd2NJydiC4/4Ki65HKwk+EdnuByQXbI/Svh7S/8AgoTDB4S0+71HRtPa5ltisgkZQWKsVJxilemaezPt3/h6PqrHn4RWpP8ADtdv8K+Fz/wUv0GxnCT+H9O8w8KMjA/ShukhezPuVv8AgqTqoiG74Swd/wDlo/8AhXwqf+CmHhOeWQL4b099vBO4ZYn+HG3j60uakHsz7rX/AIKj6k58sfByE7OuJGr4St/+CmPgd2kRvB1vEgY4IZcNn+go5l3D2Z91v/wVL1VRlPg/Bj2kJNfC9v8A8FK/BN3bC3/4RC1SRWyCGUge/FHMu4cltj7nT/gqnqaKWPwjgxnn52r4bH/BRzwgfMI8L2pj3BQxkUEn244FHMu4+WR90L/wVbv3AUfB634HByf8K+F7j/gpR4ThDwjwdaMEQBMzrk/jinzLuL2dz7nh/wCCq18GZZPhDBhgflDnj8MV8Lf8PIvBE0Jl/wCEQttx4KySpu/SjmXcPZn3G/8AwVdeMoD8JIcAYwZDxXwnqf8AwUq+H8ciTjwVZyFVzI0bqQh9PejmXcPZn3Wf+CsDKTI/wlh24xzMQP5V8Lx/8FGPh7eqzzeBbPCkE5dfm9qiUodQ9mfdC/8ABWG2XbBJ8LrcO/Qeac1+dnxm/bt0DUfAd+fDPhuxtboR7o5kYF/90Y6fWlzUw9mfW37Wf/BdnxF8KfCI074W/CXSJfEN8zJayX8rPFCBwZGUYzg9uK/P620mw+KOj+FfElywvNc1bTGmubVYy620W87d+eFZsZ5p3kX7OJifGr9tT9t/9p3UzrHxj+K+rahYtL/yC7E/ZrGAHovkoACcZGXLnk89q9j8M/sOp4yVX8d/GDQdCt5V/drDMZJYV/EAZ/lTUpXFKnCxn/CHQPFPxN+HVh4O8BatbW2vTyRJaGaYIoO5sgnn+Ve0+Cf2Nfgb4N0yGx8P/tFW8NzGP3d2uosJC3XsOPwrvVVqB57oe9seE/tEfBf9s39naz0278SeIFvU1WR47MaHJ55DRjLhsoK958Rfso/CbxNZR6Z4q/abhuorV3kggm1iVwsjfePzHjPtWLqV76G3sqC3R8Zz61+2XIv+iWerbR/z1tkG72yVr64/4YL+A82nyzaL8d7G4vFBMFtPrksSb2H3WcKSuPaplVrpXbKjToN6I5j9izSrDwfap8Rf2zND1TxVdzkSaX4UubhYLNIedss4jUNKXx9wtt+XPXr4x8bv2lZvAf7Qt/8ACyIQfYPDmqQ6NG9vIZIWitgkMhRmwxDOkpyR1bNY/WbdTX2Mex+pXhz/AIKqeCfBOjQ+HPCPwP0zTLGCMJDaWBEUSAdtqjHHT1r4zv8A9s74TiATWXgHTDChxGrRgvsAHJxUyqKWrLjSSR9t/wDD4KyQokvwohwG/huyP6V8EXH/AAUG+H+mxS+Z8NNPRlIC/u1yQelLnh5leyR99D/gsZpAds/ClABwD9r/APrV+et7/wAFG/AFo2F+GlgzOPmBjHB/KjmgZ+yR+hSf8Fi9JIUH4WADGcC6PP6V+djf8FIPhnuHm/C6wLbCMmMYzQ5UxeyR+i7f8FlNABCf8KrTPTH2v/61fnan/BQf4XzWYul+GWmKZM4OwZHvRzUw9kj9Ef8Ah8fozZYfDIAAZI+0dP0r81vif+1rZ/E/4dS2Hw08BRRatLqUFjb21mPnuXl/hUDvgE0lJPRD9kkfpp4H/wCCoWp/GFpLTw74OSyt2O3zzNucEd+mCPpXyj/wT+tZng1GTXbBoZrVViktpFwYpOdykdiMVabTJcIo+nvFfi/xT4/8xNYu3mXJKozfKRg0tosYuNgQKpVsfkau7NXbkO//AGZ9PtdK8FvZ2iLHBHqMrxRDpHvw+Pbkmk/Z0kEvhXUVB/1eqMvI/wCmaH+taQbOCR9efsXX7PHr+n7zjMMijPruB/pWL+xZqJXxxqum54k00OAfUPXn46LNcPdbn0zRXnHUFFADXByDn6Ukp4xnHvikpKTsgP5xv+C6d5Ldf8FhLOCS8+ZdF0xJIhID5aCSd+nbk9a5z/gsRftf/wDBaa/D3zBobTTk+bAPCTELyOV/+vXbRTjKxvH4SjcXp+6WCp1KqMA1SudxO0A5H3siuqfxA9jH8YTxraGRYUOQdrY56dKz/GHnLbuQeFH3fWpIPG/G/iCaymkiECMqk545JrM+Icc0dxK8u4IxJGwc/SrjsByep3s9yRIIyCw4BXGKoaheyKWbzD8vADHOKYD5NYlecOTljncT3GP0rPe7iZQxOM9WApcyA1/hZ4y1nRvF7z2d3KF3vJ5QmITJwORnngDJ74rkIpdX0y7e80+YoecuDjcPSk32BpM908QfELxPrsCRi9e28uTzAYJCQ2R0rxb/AISrxoyKUvnx1AXHFLXuLkieoPqWt/2kl/qni/VWjEgws05VefTmvLJ9c8Xaggtr+8uHjyDliO3vRr3C8VpY9n1XTvEGu3I1T/hNtTiludziKNiCAABjrXktv46+JFvEDDrEkbeYSrIAePxpXa1uKTi1ZI+rvgL8R/Fvwte1vdM1HUbi6tbxLqG8mkO6OSPkEHn0r5V/4Wf8WrfJTXJ1DAjKADP5Cqdb3LEx0Ljagdb+L95q0kCwiS5d/KU5A59657wxa6vDq51O5XYqIcux5Zie/rWUL63NLpnrravp32ZGubW3LIvylkya4V9RlklV0kJAHIarA6q8vtDuJGVbOFBjqEwDXM/aZ44keQHYT3Ga0A1JpdBSJVWxAkJ+dgmc1mXOpRSuwiRguQGYcAUCbsWo47KQFvKULn7ueOvf04rP82RXVYzvkZiG/ukdqA5kWbmCyO6SLT1KheMMcrUEzzxKXeZFkH316YFAcyJ1Fq0QlFumV5zjpVN7zMIMMQJL4JVid4PTjtQHMibzEkZIU8okcfMOtU3HnSFIt25Ou1e/vQHMi48sW0SCDaUcBlQ9feoLKH+JjjHULkc/1oDmRYN1bBgSuQD0fNVrmVS21/lUev8AFQHMj6n/AOCTVnY2f7QetfF24tXa38EeC9Q1Rxv/AHgneNoYwuflIO9u/GKf+w+0/gf9jz42/GBInSW4XT9CspVzhhPMzSLu7bUAOccV003yLUxq++9Dk9G19vt6X94vmzMS88ROfOyc/Njr1rL8PTWk0sizxlJoWGwjop2j9fYcUkvfuQvdR9Ffs++JdO0zULdrm0Ds858i2Zi0TAjJO0kZC8Dn1FcP4G8TzfYBYQYVIF23EhnIyGIJGPTgEj6VvGSRE1zM+wo/iX4V03Q47S5u4fLUlp0EhUo38J2gcckDGa+SfHnxwk0zTnaFVWRoQT5bkcLnBwffnFaSm7XCKdrG3+0x+0fp1+81vLDN9okzE7Wz4ebaPlLANlidzDDZHzV8SfGj4t6z4o1vyJbt441+TEfDAEYyWGCePeuKpWuacjP04/YN/wCCHOo/tX/Dfw/+1z8fPigvhz4e6g8uoSWltbr59zp8WQsjzbwEMrE7QqkhRk8nFe9/8EYviJ48+Nn/AATH/wCFkfH3xZfXnhjS9XNhpGgQsAmoWGnhYVgUAAKZLssmP4tgyeK5pTm9jaEWecfF79kD9kb4G6hqHiz4HeEnsoIpszfEHxZbvfal5JO0R6ekiN5cI+6MIFzkq27NeveJvhldftDeJl+LPii/t4/DWn66NJvrHSAMxiNElMNvkgLGA+N+GkYhzwAKI81tWbOXKrM6H4N/tJ/FTSfCOn+FPDlj4h1Lw9BEALrXrJZbhk448sTFlBHGQmfUV2/gDwV4En8bQeGtA1rTczwlNO8tzsuJlVikIDE5V9u0Ek5bNaKNJ7mLdze1bUrHxZpCahb+HntBfW+VlilE5EbLlliJxuBHVCFI6Fa6X4IeGrfW9XstFvd0uj+LLq4065tbgsW0zU4MsHU+jHHPUhhzxUTdGAryPyQ/4K9f8E0dO+DfhtP2uv2a/DbQ2RmD+ONBs7byhEJCf9MEY4XBwXUYABJHTB+3v24/iDoX7Nms698LPi34d1G/0e6g825toWQTXkDh08jLnaVLGPJOODntUynJK6GtfiPxt+B/7VPi7wLJGy6tIYRGFe3eXzF3A5UsG6gema8j+NkPhDwx8Z/FPhr4X6m8/h2z1iSLSJDKrnyRglCy8MUcvHuHDeWGHDU44iaIlCLP0Z+DP7dM3jyCPw7rU8ri4z86EOizbcfNk8dBnHrXwP8AAvxNfzeLLWFiNiuA6ocDB68djx1rtpV51NDOUeVH6bfCfxz/AGv8Zm0221VI5df8P6ppr/JgyiSyk+VcHgkoox19q8S+EPiqfQvj94M+0zsIjrkKINyldjnaVUknJO7qa0qJOLQ4dz5V1rT9Pfw1bS3s5W6tdRntLiMSf6vYExx16kj8Ko/F+4tdH8b+LNFVV/4l3iy8SKM5w6mVwR6ZBGM1wSkovU6opyV0c5r11pCM0ERcTK2S4bOBXPTXMVzOYpQhdeuz/PNROSTFsXp3V1DzSPkYAUNjHvWSbiZV8kt3yoI5qOeIFv7XHHD5vms+2TCYb7o9aoNcyOCpYICMHaMUc8QL8FzIFeRLlueAM9vWqtnI88ggUE7UO07cU1JMG7GnZXAaJoHkcn72AMkmlKnToVmSPaxxuYtz0qhcyJYZY3kEEhJIPA3YyPSs65ulZsQHGTnPegZdjtkCtL5+1933if8AOKy/tEsab5V3AnIGetAGhMkKAKshCMMthsjNZaXLPuaPIWQ4ZT/T0oAs3COp3o7kAZ9c1Va4lRGiWQjt1oAluZ1isGR523EcgiqV1I7xDzDk45oA9w+AfxuNtp8qeMdZa0gtreKC0FlB1VVAGQOeAD+deJ6F4tPh+KSB7BpAz5Uhuaz9pJDtA95+Jf7Q2vya0D8PvF19LZeUoxNAU+c/WvD5viAr3HnjSQpx1MgB/lQqj6sa5Eey+APjT8XJvEUc+seKWWJELKi/xH0rxlviPfpIrWlvsIYFiZMgj0qufzY+aPY9j1P4p/tG6h4hdbTW3MTtuCGZV2gn3ridM/aO0e12PfeC/tLIoV83G3p/wGjn82S2n0PpH4HeLvGBSK98eeJZBcJdI8dsw3IuDn5lHJ6V4baftc+GIpDLP4AlcyY34vAMY6dKOfzFp2Oe+O/iMeLv2ifEes29wJF1HxFcXE04j2ZdpCz7Vz8q7ug7ZrhdR8Qf2l4vm8SJbBPtN1JMIlfJQM2QP1rBq8rgelXLafDbf6PqlxvHJBkyPcEd64YeJXlYSbSN55XOK2U1YDXuruJrnH2icEMMHzMfzrnzqhllLMGIzwM5o54gat9cJneZW+9gMHyKwL+UvGkUcjDa2WANHPEDUW3W6YJFcvGCeTnNZ/8AaJ3K7NhlXjHFHPEDVFvbwwHzLuTC5wN1c/dahezXxt4gPI2hg5PIPpRzxA+l/wDgllPcan+318JPDgtori3n8e2kskNwcgmOGcg+/ap/+CN1o+rf8FKvhDai3Ejr4qMkEZbG9ltpvlPpnPX2q6KvJsUmrH6P/s7W8K/EP4i3EY2q3i28CYHfz5D/AC4/Cnfs0TS3evePL6UKTN4uu2Yx4IB85vTp1reatK5g3eR7FZhXmjyOTkD8jRY8TRN6H+hoTuOZ3f7Nsgbw1q6bsldZZfyijql+y9dGXRvEHIKx+ImB+nkxVrF8r1OKo1zn09+yBcfZ/i0Iy+PN06ZcevINZv7Md2LP40aUXbHnCaP8CuRXNi03E0hJWsfYFFeQdgUUAMnPGAecGm3QON4OMDk+3+RU04pTA/mI/wCCrOoX2tf8FoPEwvXeZba7tLe2JQnbEtsX4555dulYf/BQq6u9S/4LTeOm1EiJoNeiQJv3fKNPixj069K9OEbTN4/Cjp5ZUSyVNxU9DNIPve3Nch8cPiHbfDjwBP4hkRWdI9kSSHhnI4PNXJtzB7FPxrqUcTm2S4425bkH8cnpXCeG/wBlL9rbxfdab4y+IGleIrPTNQtlu4LWyhEM4jdN0bKJOACCDyOhp2l2IOQ+I15GN7YXcTtxtJ3fjXpN3+yB8R5YyNZ8CeKZVj5A8yPefcjaQT71UYza0E5RW582Xzgh9kZ2ZwAo5HvXueq/sY+MA+3T/hT4rO1cxvKsR+b3wOfpV+zqC54HhMdnNOqqQAAvTHIPvXuOlfsr/EHT5JXk+EHiyZRu8o+THsz788is/Z1A5jxOLSZruNg0IBPWMj7vvmvfV+BPiqCEhvgt4u8txkCKyR8n8KPZ1BOVjwKPw5csjRrbnKAnC9+K9tuPgr42MiJF8GvGibs7/wDiWpjFHs6guc8ZuNDe2t1jQFiVGSecV6+nwS8aFDEvwk8YoxXgf2SCOvTpR7OoS5XPHYtObzDDFEAB/C5x+Of6V7DJ8CfGMMmYPhf41PyZ3Nop6/nQ4TWrQcx5FDaTiMxhBtzxlhk/TNety/AfxW1sAPh34xA2hnR9DYn8OeKVn2DmPIf7N1FyFihOA3zGU16re/BDxAHVW+HnjNUVucaAx/rRyzeyGp2PKljnjiLTQfJ/EQwNek3XwY8UJcFrD4d+LVVsDE3h5x0696fs6g/aHmvmXLqQ0zGPOOO3+yP8a9L1D4KeK5IIltvBniWMliZWOhvu/wCBVpylcx53cMzLjyiFAGF2nP8AwKvRIPgrrrq4vfDXiR3VfkT+xHUtkdeTRyoTdzz1SkVz5UkijavHHX3r0N/g5fLg2+h+IXVVBVptEkz7jijlEef/ALm6eIuSygYJ7NXocfwvnsRMI9M11C4Uwq2gyFM9w3ek1YDgYrAGFXgAU+ac84PBrubvwDOtqI47HVTIVyX/ALGlGPXr1pdAPPLzTrmKU5jxvyTz15613Fr8Oh9sK6jp2qhQRsZtNc8Hv04pe92A4m3trkReWRgsMDPavQD4Y0m38+2uLLUiyn90V0lx/Tmj3uwHmVxDM825kB2/Lgn9a7fVPCOmgFo7fVSDjCjSpARn/gNHvdgPobQU1LwH/wAEpNNgntUjfxn8SJbtnjlVneO3gCYwOiHI61geM/iNp+ufsufD34ZaT4S1VF8LfahdzsFJlklkDblTqoAAHzc1vzGXvdjhfCNre3EKW8VtGXZxskydy9se1P8ADOs3GnM8Vrod6VZgdlw7AHHPIUU1KwNSfQ7+0tdU0rRZJWJ/dzIUDrksTkNlvwx+FYqeL9euNPaySys0jeQO2+0ZyvXgE0/aE8sjlfi1q12tjLdyzciLIDkkIP6mrHiCw8T6vE0NxPCwVduV087VH9aynUqPRIuMOp8u69dy3urSvcHHzsGwPyr6A+CvjDxN+z58ePDfxaTwFo+sjw9rCXcml6no26C9QZDRvlMfMrEDPQkHtXO4Svc0R+zf/BKPwPqNz/wRf+G3gPSdNazu9Tjt5gJYynz3ly7yzHvgyzSNkdeDX0t8Df2l/gv+2F8E/DHxX+C+iw2Wk6zoItb3QLXEb6bPGh3wGJceWYiGIOBjHWqtN9DROKPNNL+EeseAptJ8FXV67+EYdRW71UWi/KzxM8atx8yjaWyF5ZSfauy8Tan40l12PR/E0skkM06z2l7bWLNbFSgQ+W6A4yqjIb8OapJpakVJps85+OvhLx5rd3oVz8PoPK1vw+uJINKBhhdFlkeNokPzYVR8nDHDEE8Gvo8WPm6q3iaw0WeeztZBPDqM8htrSL5doE0koXdtBYqFz15pkcxzf7KutfEv4xXngrxp42gMN5f+JLi4htLe38tbewtIGiMh9N8rkf7QIrgP2iv27/CHwW0C88GfBHVtOvNek0xbee+hCra6fbckQwjqka5Z2c/M7HPYVjNcxR4Z/wAFVPiJ+zj8TfGvxQHxU+LEnhXS7jTk8O2niuYpHZ2M0qspjkkkO0hghwvG7bgdK/J7/goP+1bq3x91aH4VeHPEtxe+FdB1GWZJmjAGoXLZ33DAfebczfMxYkAYI5Bd+WNkB6Z8N/8AgiR8K/HFrJ460T/gpP8ADbWPB9wwTS7/AMN6fJeXcj4BKyRCYCPGccHNfGfhb4f2byrNBc/ZpySRKsHc5yTg+/61rFKQH6W6L/wRx/ZZ+EGkw+LPG/7ZF5pYu5FGjarrfh23trO7ZV+dI4BcvPM2SOML2rlf2RPh1+yj8S9Y8M2fxI+C9+l1b6TbRXOsaf8AECaHbOsuDIltJGYFViF3DG492OK0hDld0yJaqx7Vof8AwT3/AGfPEXjrSrbQf+ChPhhvEsWqW11o+kLokkccyhtyxmRpcK5Ix657V0/in9j39mPXfAU3xB8M+K/HenwaDrkUFyba0sryMF5cx42XKyvyPTjrWrbbuKPuxsfJf7a3/BGP9q/wP4z1b4i/BxLf4h+Gdd1p18zTybW+tNTkmbzYDayMTIiuTiVXO85+TjNfQHxR0Hx7+zb8b9f8a/C79sy98N6Z4oht7rVfB/jf4bXt5pjKEXZJiJmAO7c2+JklB5L44PPUgm73NYVeRWsfk7rvhnW/DGrXnhrxFo09jqGnXUtre2lxGVlgmjYq8bg8h1YMpB5BBB6V98/tPftVfsa/tK/GHWtN/aP+GPhS+lfSIrG2+Lfw7uWt76K9VATceWzFb6MN8jeZh2wc5Nc805MfPc/O6S0ndRMh4HTBrvde8L+GItZubbSfEOnyWv2lxaym4C749x2sQSdpIwcZOM47VHIw5jzsQ3LTIFIxjnPSu4Hg/SWQzN4n0oYbIX7YvNHKw5jltHJivGSVSW7YPT3rrLXwlpcl4ir4j0s9wRerk+1NKUWJu5gagsm8vLFuGOMnOBXS3HhfTbiJpLXxDYsp+8PtajFXeXYRxT2s7XCgQ5XttNdjpnga4kJafWtNVR9xvtq5IqkpNbFJ2OOurG4VM8DH3ecV1eo+FfJfyvt1mw7EXa5p8ruHMcYtvcr87RFQfmArqH8M3mFInsjlsAfbYxjj60+VBzHN+RcY3SbMHtxmugTwtdXDr/pFlgrxtvozz+dPlQcxzrWsszbEQEDpxXUp4N1CHb5ktmvH3lvo/wD4qlyoOY5ldJVMTMQSegVK7A+GXiAtpL2y3DrtvI//AIqsuRBzHFzWKCIu+G9ivSut/wCEQikRyLu24OGzdx//ABVJwtsHMcS9hCY97QqceuK6+XwkggeGa5t2I+6Fu4h/7NU8rDmOIMcGH82IgFcjaBXXP4Id5d4aNg4wv+kJj+dS0w5jkY9hQxmMZA5JHWupk8A33kGRTFg9P3qZ/nQk2HMcssXzYVVUs3LEYrp/+EA1FiJCoK/9dE/xquVhzHLTIwba0wBU9ua6pvh5qOxmWHknjDA/yo5GHMcr8ynarE/SupfwJqzNuFo/yj7yx5zRysOY5WRJllLEjHpnrWz4l8M3+mRG6v4XRQuQwXt+FTdFGF5imXEmRTZLq3+VFQ84O4r27H9KLpgTsEXDImeMdKLeNZEEolypPBHSgD6w/wCCIllJcf8ABT/4UD7I8pi1K8mEadTi0kw2c5GCevbNX/8Aghxowv8A/gpT4HKSOptdN1a5kdclVRLbljjnjI/OunD9TOppG598/snv58Hii5kd3eTxLcEMxJyN79T60fsgvHL4N1i+gbIl164dHHcbm5/UV0VTCLu7ntNg6CeIHnJzjk5HPYcnoa+m/wDgnb4O8MXvhjW/GV7osE2oRaotpBPLGGMcYiRuM9Mlz0rDn5DR6nnn7Gn7PnxT1PT/ABFfap4futNsLzWvtNjc6lbmJbiLylG5FPJGQRn2r7g1BooVJZwB5RA9+KI13KexzzpJyvc+bfg1PJpXxk0HzSdyan5L9upxVLw3eGx+Kun32cLHr6En2Mq1pWXPEzvys+4aK8U7wooAhvDtiZs9FP8AI03U3SOymeQDasLFs9CAKKfxgfyv/tm6gniX/gs349vJQSw8SsPn4wV0+MZ/ID86pftLz2Uv/BX/AOIU9zFIQviC5IIlyd32SNV6/wCya9KnrM3j8CNH9p/wPb+JPCehXUdmtzFBrtrLfWrgsksBkUOCM+hPHeu31O6S5g06IqGAmTcpGcjcK2lFKVxS0ieP/t1ftyfHL4jftu+O7Tw/4muNH0v/AISBNP0nS7ZisVlbW8EUSRoDyo+Vmx05A7ZryH9py8jn/bT8a3k0Z/eeLGw68HJC/wBaylUmpWKSThc7C7/aI/aUt7Xz3+LEkkcacBbkjIGODx15rmfE1rEuhLLFGGLoCSeMDv8AqK15nYyTu2WNZ/a4/aH0+0kE/wASL3y0bCNHckfNnpXlHjW+R7JmPTzV4xWMqk11GeqaT+1t+0nqFv5w+Kl8fNGdhucKP0rxnQfFkFkYUeYkIMsNuc1HtJ9yZJI9wb9rD9pEFYU+JVyCqYBSY4zXkH/CeaajlhI/PbZR7Sfcwk5vY9htv2vf2loGEkvjot8jKVMhyxPGea8cg8Z2TvuZ3YA9xR7Sfcj992PX0/ax/aTuYRbP42J2/dIdQc+vNeUL4x0rJDzOmT8u2PNaqTauH77sexwfta/tNyMqT+Nt46DZMoK/X5a8j0bx7plneC4nBkAG502kb6d2Ne1vqj2f/hqT9qDT3WabxY+1kCtudTj68VwGsfHTwzfWEdp/ZJiZo9pkGfmPvmnzyNLy/lOxP7ZP7RsV2I38YZDHb2IJ9eleOzeKreRladlKPnaR1UfhScmyXKV/hPZLb9tX9oWymLW/jESAOwHmBSOnvXhv/CSQW3yw3CugbJ/dHtRdi5pfynu7/t1ftELw/iRCVXaCIlB+ucV4ND4mt5ZGnZ3wFwSF7U+eRpzS/lPdZv28/wBoaCAxL4oj+YDLNGCwx6EjivCpdbs5VM0VwJAxAXzOMf8A16mVSSWgc0v5T3Of9vn4/fK0fiBApGFxEOSPUHpXgkuqRRQGR2iIwVXPzEnPc9vrWftancOaX8p7+v7e/wAeZci11uI4jyyvEDhvXpXz/Y67FZRMTfRbSMMVGSM9KPaTKTlb4T3hP2+P2jo5kM2oWs69g1sN2fX2rxHTfFFo9x5shjbn94SxBxR7WY7vqj3Uft3ftIR2y+fNasFydy2S5PsfavJZPiD4eurb7HFCY85256HHvR7Wp3Eeozft/wDx8clN9luZsjNopI9vavDb/VbJLhlwiKx+63XP17fWj2s+4a9rnuaf8FCPjdggxafINhXLWqjn1rwaS+tZLXaLoKynIVRjIo9rMLv+U91H/BQj44RAhbPTlLqFDJaAEHuenP414E2qwtGrG9iVs8r5nIo9rU7ju/5T6Ak/b++L4kQLpemuWHJ+yAkn8q+fk1C0dQxvFJz1D80e1mF5fyn0FH/wUB+KYiUy6Lpec5G6wAyK+fxqUK5Hnpszjk96ftpivL+U+hP+HhfxVWMqdG0nJ7fZBj8eOa+dv7RiQs7SKRnjmodepfcd5fyn0VJ/wUQ+Iy4VdF0kf7tp27jnPbNfOY1S3cBtwDbchvSj29TuJ36o+2v2Y/8Ags78Zf2dPGB1+HQ7S60y8t2t9W06IGMTq42lgcHa4Xgcc96+I0vYmkCtMCSeCG5p/WWKyP3k/ZL/AOCif7Pn7Rttp9p8Lf2jJvB2sxSot34U1G+8u7OeuFZgsoPqADnNfg4+oK0QjjkjVlbht2GB9Qeo+o5pqvcLI/Xf/go5/wAFcNH+GfxH1n4KaZ4p8ZeKb7TnVJLq6uoBaRnnbt+c5yQQRtG3rzX5CXupPc3Rku7jzHZy8jNJncT1J9aftgsj2r40/t1fG/4z6hcNf68um21w2ZrWxUfvD/tHA3fQ8e1eIvcQu+8NHu9qy9pIZ6HH8ePHMKqsnii9JCjGVjGCOnROntXnfn/NuyucY60ueTC6W57B4d/ao8faQ5f+1/PHUieND/7LXjsl0q5d3XhfWmqtRdR80D6Y0n9vrxpZxov9l2JbgMwRQTjnPC+vNfNcVzbKqyJICOpUHvVfWKq6ktJn01d/8FF/iFHAYY9JDJuO5Bc8H04xj1ySD+FfNLTojNFIqq+c4Jo+sVe4WR9FSf8ABQnxXqbi41fw3HO4IyzzEkY6dugr51juYCNiBM9+aTr1Huwsj22f9q7wtcXL3c/wi02SSQAM0iqSwxjd93rXioeFlw+3r2NJVag04x3PcdL/AGpfAEcIhk+C2kykvkK2ASPrtNeHCdBISZCoxgFMdKftag+aB7uf2qPhcbrD/ALSCD94ADj9K8JE394jaemcVftJhzRPdj+038ITIJH+BOmDbyoCDk14SbmFGDwkDnnaaXtJhzRPeY/2jfgvNHvuPgRpa4yQA3UenSvCjMsoyJMevFHtJhzRPcE/aK+CL27NN8BNOXBGMODn9K8VgaAoEdlOFI6etP2sw51/Ke1TfHb4FShVb4E2AYj5mMnCD8ua8Yt3RJF2AZAwMij2sw54/wAp67f/ABx/Z6SdEl+BluSTgeXJgfXNeOXM6XXiABgoAVQOAe1HtZhzRPaI/jR+zoq/u/gRCgBxlbjFeUIrkYAQnP8AcHSj2kxOrTjuevL8Xv2a52Uv8IIgScfNOa8njhtTGCIlLKc8rxmj2kyfbUj0eb4qfsxuCZvg46k+tz/9avOAsQcM8SADuFBNTzyI9vTPSl+JP7MUowfhK2dnUTdf1rzqWzi2i5kijQsOFCgkexpqckHt6Z38vxJ/ZcbcX+Es2R0CXOK83ktLXiRbPcScn5R1o9pMPb0z0OP4gfspSSbX+Ft6N/G77QDtPr96vOWtLRfkFpGADnlBmlzyD29M9JPxA/ZT34/4VnqWABgLe56/8Crzc2VmwYfYlwWCkHoaOeQ1Xp3PS7rxZ+yOYBMPA2rq5PKreMMfrXl82nW4JWezi/dnoF4qvaTL9tSPTovEf7Isspx4b1cheMm7P9TXmMdrao6PJaRY7cA8U1OXLcXtIPY9i8LaV+zp8QPEmn+CPAXw917Uda1m6W102xt53MksrHCqADznnkVP+wFbWsv7fHwZ22Y8tvG0ZmWL5cgQyMOnI5ArWg3NO4c8Tt/BP7K3hDRvjRYtrtmxR7iEfYp0GIyJlVgV4Ldxg16zr1rqyftAwSWgLp/bErZZPvEXuRkda64U4ON2hVJyi9D4k+M3hSxtUvruwgt4fs13IbcxLhShbhSPp27VT+KUPiG/1a6S7tpGEl3K+4ghM7ugFcVeydjWDbjdnF6MZpd1vD9wDIGavafp8ulwlZGG5zk4PSuco+y/+CGGiTx/8FAfD098ZltpPCPiF5fszYkZY7aPjgj5Tv569BxW3/wQmtItT/bk0+JWT7TafCzxdPatJ91JvLtgrH8M124eK5bmNZvlsfZ/7HUMUHwpuJIhhZNTnIPtmpP2OY5YvgzF5ygMbycHBznmrqfGRTS5T7//AOCeuoywfDzXraByANeVi3sYYxj9Kj/4J+qg8A665IBOtjn6RLWU0hn0Xrc3mvG6sT8nJz/n1pdWVyITsAyuOnUcVhFJSJlufM16xtvFUtyGwYdTLg+6uD/T9aj8RErrmoD0vZT/AOPGu+MVKGpyy3Pu+1uUureO4j6SIGHPqM1l+Bb5NR8HaRfIcibT4WJ99i14L3PQNmikBT11saVdYbBFs/Ttx1pviJguiXZbgfZZOfT5DRT+MD+Ur9o6f7d/wVY+IO+6a4I8SzneSPm/0ZOPyxWd8ZZ7m7/4Ki+PpLp4pJ4dfuwxB29IEGR69hXqG8fhR6nLcP8AbbIZOBNHx/wIVUu7wLNDMrZxKp4+oqov3hTV4nzB+1dAR+2P4xgiYIR4m3DnABMcR/nmj9sKFW/bC8alJQCviFWOD3McZI/UUpJ81yotezsaXiTC+H0iaQFhlSFIxVLxQ7L4YRgPmP3WHrWkrWMl1PLfGluYrKRmmyA3ORmneL1J0aUbgx3DJz1xXNNNsZD4e0KxvTFcT2QO5hwr9RVHR9Wv7K4tYoLZSm8AFc9c1pymUmb2r+F/D1vf4jiKrhjgMetdJoHgjxN8RPFFt4U0OFJb66DmAyHaoUDJzkGn7NyOSo30OOi0SyJBS1Zh0GD1r0+X9m3x9aTtp817pEM8bfvBJc7GQ47jbVwpxKg5Hl9nZWMV+rGy4HXLHj6161Yfs0fERo2kN/ogx126oMfh8tdEaCety7u55fbaPpc6vN5OGA+Ye3tXpsv7LXxlu2EkD6CCev8AxNgv/stb+wpqO4KTvueYp4c06SORHg+VVzEzS/pXpR/ZF+N8yGNhorDOSU1cE/8AoNR7KJfNPujycadbW0QdoI8K5H+s5r064/ZG+OCwvHHo+mydlxqi8+/IrKpSVw5n1Z5d9g0/JYIUwd3Izu/XmvR7r9kX47MqFvDluxUcKl+nNc0qT6C5l3PPF0/T4I2uYlyA211YkAj14rvW/ZZ+OqhoD4TTHdo9Rh2/+hUcsuw+Zdzzf+zNLRwhDqGf7p/x7CvRn/Zl+PQjMDeBNx35VlvITkf990csuwc1+p51d2MOGfYRG3BGcY9q7qf9m349mbb/AMIHMwP/AE9wcfgZKXLLsF2eeNodqxjkjZl8x9qoCMk9uewr0uD9nv42WhTzPh7NJ5asrL58HzZ/i+/xijlZaeh5sfD0e1pUEp/vMpBr0rRP2f8A42xTAJ8P7sbTkkyR/wBGzRyPsO55+3heKQRoWklMnyxRRsAR35zx2+tepWvwQ+NtvrTvL4GuDIy4D+SuAM9uetHI+wXR5TPoEErNYO828feBOT9M969SX4I/F5dUmuZ/A86yHopQdPXrWc4SvsFzySTw6qTKxeXKnHzHkj/CvVbD4PfGH7dPt8D3OzZjc9tkN9DUck+wXPK18JQXFuZkkn3FuWCdR7V6vovwd+K8q3P/ABR14Nucq8DD8hinyT7Bc8hi0CGWNg07EIMqGUZPvXrGmfCn4lvZTk/D65RhkFJLRslvUcdMUuSS6Bc8f/sWC4+RSeOTgYr1Ky+GPxIfSZkTwTcgHJbFiwOfypcrC55Y2gRbxln5GSnp+Fenp8NviKnh6WI+BbzYy8SNZNvPsDinyT7BzeZ5bFo5nU/6QxHpgV6TceBPHP8Awj6s/hKdcgZK27Fjj8KHCdtgv5nmo0GCFCwncBeMuOTXol94G8ajQFP/AAik5UYJItGLfyrPkl2C6POm0OBlB8wk9fu816Lrng3xRFosKv4WkHTI+ysGP14qlGXYpNWPOZ9EGQVbqOD616BrfhjxIIbeFNCcRAAbUtWyH9c46U+WQ+ZHnv8AYuWEImQMBkfJgn9a7jXvCetJaxvP4em3qMFo7djx74FPkn2IujhzoR4Iumz39K2X8N69uwmj3Iwcn/R35/SmqcnugujFn0Ty1EpuCykYwBmt6PRNTiQmTR5zkEfPAwAyPpVexYrow00gojDzMfQ4raXTLxEMZ0yYkDqIWx/Kl7BlpqxjPpcztvuJwzepbNbd1p8yHalkR7+Swo9i0h8yML+yDnKTRg9zk1qm0k5V40Jx0bip5J9g5kZi6PM3S5Q/QmteCxl+6IFQ7c5zxRyT7EtpmSNEuI2LLdrk9RzxWots0Y3y9++aOSfYRkLpFyjjO0H/AHj+lacsUkZEjAEN6npS5ZBdGdFp84Risg47g1fEkMTfKQ3qKLMCitrdqpVpiA3AJbpV6WeKQbCB64z0pCuiimnao+14pyCfVq0bC4V5VIyD94lB2oHz6EB0fVocB5WXI+UmQ1q3l9apJGjS5Ah4LUA5NoxbAyDV1E4O4cEmmpeb9e3RyAqTwaCLM6i1WNoMRK249ycVhvruoRXDRKcBeAzDA/OgynT5mdDbIdrQlwCOuBXPReIr8oJHkVcjkgZouifq8jpl+yxBSCnX73PH41zllr0sjFRINobK55zW94i9gdRGFa3b7SyqrtnKDkfnXPv4juZ0Lh1yOpzwT6VE2rB9Xb2NmWNW2sZN6KMIS3Nc1P4mvwvzRqO2AayuhfVZ9zo2NuZF8zAOPmwa5d/EV2ih3C88kBs8etMr6rKx0sgKrgcKRn5u4rmpPE9yxDNGBtXahZsjHvSuhfVrHQuQFZpATu4J9awIfEF0su1rdctxkHtTD2J0CwRCTYvA9+1EFzG+2QqDkA89qtfAZyi4Sseyf8E+5zp/7fnwZeMMzDxiAFGMNm1uPXg84/Sof2E7lo/27vhHPGs2P+EtQMIGKyEeTJ90grj6k1vhtn/XY1hsfV89xPL8aQ8blJZLyZvOIztP2snAz/Oql7La2/xfkk3skUMl06LKu9vlmcjp7V3bGlY+KPiO7td3YdNu25cNknP325qt8QS7wyO8mWM5IUADbkZP1rGq42N6fwnDXMoRyN38XHNQ3bM8mWIPpxXDNos+4v8Aghi7R/tdahfB9gg+DfilmVDy4PkKTj+IjsMj6VF/wRCjun/aI8S3nlymOw+DPiO43xg8LmFefxrqw790xlufcP7HkQT4I2ih/vTTc+vznmj9kON/+FEafzje0u0j138VVT4wjufeP/BPvc3hDxDCznC62hGRx/qVqv8A8E8ZJZPDfiSAktt1G3fP+9Cw/mprOZjN++fTmqo2bQlzjb6+4pdXfi1BBxgZyPpWC3NZNHzF4rXb4j1NR2vZf/QjT/F6hPFeqp/0+yY/M16FLY5Z2ufYfwYk834V6C7Hn+zY8Z+lR/BB1k+Evh9j306PH4CvDxHxs6Kdzr+9Hf8ACsVsamd4qJHh6+OM4spuP+ANSeL2aPwzqEynlLGY4IJB+RvSnT+MD+Tb4hwXUf8AwUw8dyyXHnbtf1GR2Vfm2gKOh6Y6fh71V8cXMMP/AAUq+IoQGbzfEOpqrquVHCnAzz1r1DePwo9S1NitqJFIBUZAx6VDrR/cISCRtDMB39aa0YSdkfOf7ZH2a6/a58Y3cZGJNYiZSq4yPKj5/Hg0z9sBd37T3iG7wUWaeydc9D/o0Q/pVOSEotq5D4lnVPDA2jHy43dcU3WJI38N+WxGVbOT6Y6VLdyb3PM/FsE66TKhkwQASD15/nUnipbaSwnlilYNhflkPH4GkAeFEs7ixtGlMm7JIJ53Nnr7Ung5hDptvIs+5g5zgg7ee3rWhjLY96/ZAsxN8fdOkknU+VZ3brux8pEZIzmpf2QLR7346WcW4kHT7nDKm4kmPGMfjXRh+XmdzDRy1POv2/bfV/8AhrHW4tLv5oYZdPtHCRXLBd3lnJAB74rU/b5BH7Tc8lwRv/sm3SQDGBhT6fWuSu+SV0bwUDwmKHxQfu69dr6j7Y/+NaluWXC56Vhzylrc2XLbYoPb+MFjynia6GfS+k/xrZQCRNr4IHtS5pdx+72MVJPH0K7YvFV9/wABvpP8av3dxBbzpCQB5gypHpS9pLuGnYoLe/EUHK+MdQH+9qMmf51M+p2cb4V9wIyMDpSc59w07EY1j4mRybk8Yakcd/7Sk/xo/te1PJDevTr7UuefcNOw4eIPitsEY8cauMdMarL/APFVKtzCApaQKzDcAW7Uc8+4adhV8W/GSFleL4gawu3pjVJf8aPtMbkJ9oXk4H1o5p9xNRfQenjr41xnd/wsLWCe5GqSD+tRrfwiRoBjcoySTx70uafcXLEtp8Tvj3GMRfEvWFHodRc/1rOj1W2uD8sm33NHNPuHJE1ovi7+0Lb/ADRfE3WMj/p+Y/zqmLlYxukZQR2zT5p9w5Ymgvxv/aSRzIPibrGc5z9pH+FUZrtYYjLNIcdcDvS5pdw5ImlD8fP2mUkM0fxO1cP03GZSf1FYU2rWaPtBYnvntTVSaDlidDH+0N+1HEzSL8TtU3sOXKwkn35Q1z8eq2pkWMh/m6ZSn7SYcsTpIv2kf2oIXZ4/iRfZY5+a3g/+IrnP7VtCpzIitnaAQetL20w5YnSJ+09+1JbkqnxCuxnqTZ27H/0CuWOq2mQyzpycdT1HWk602HLE6lP2pf2oLdGjj8eXBD/3tPg4/wDHK5hb6CRBOZgUJwuDU+1qByxOrh/av/aeht2tv+Et3q39/TICR/47XLfbIURpDcKFDbQCO9Uq0w5YnXR/tZ/tNQ25tk16BkI6PpiHH61yX9qW+4kXClR2NNVZthyROtb9rv8AaUFuLV9QspI+6tpCZz6/erloLpZw2yRCVODtFPnYcsTrD+2J+0k1p9kkOlMgPGdEGfzD1x9xcX63kcMVvuhYfO+RwfSk6rQcsTs5f2y/2jLi3WCW00TCj5SNDIP/AKNrjxcqGKK5YjtR7VhyROzuv2z/AI/XcKx3emaH8vRotGZM/XEtcRd6zp9r5kcjMGQjoPXpR7aYcsTsP+GvfjEeZtB0mQ/9eDD+bmuOjvEYn/SF49TzS9tMOWJ2sX7YHxXUYbwnpTDPIFq4/ka4z7XGG/1yn2zR7aYcsTuI/wBsT4koxZ/AekMSMf6iQVxaXULuFLoB6FqPbTDkidmf2wviAPmb4d6OcesMtcVNewRQeaxX3w1HtphyROyP7YHjJsl/hlopJ7lZB/MVxb31mkXnzNhCOCecGj20w5YnZn9r7xOBsn+Fmiv6Z3nH6VxM+pafHMUFyg+XkAdKPbSH7KEup3A/a71VwFn+E2jH2G4Y/wDHa4hb+2+zrctIvlk4DAZyaft5h7GHc7VP2sfmLTfBvSG9P3jcf+OVyC3Vq7iNGBLDK8DpR7Vj9mjsB+1NYSvuf4LaV7/vD/8AEVzEMKuMhBnHpUyrTS90FCK3PQvh9+0D4U8XfEDRPC2ofBLTI49S1W2tXcS5xvlUf8865HwPvs/iT4VuojtdPFWmkMB/09Rj+prWjWlN2aJqU0lcn+MenW3hz4u+IdIsbFLaG31qRIYI1wqIcMqj8GFdD+1Vp7af+0N4ksgo+e/EoyMnmJcfyrScHzEJe7oee3Ggz3sH2xuADjB64rSluSsCCFVK7OGK8mocGkK6vY5eK2a31lbZ1ClW4PrUxUPrhl3jO7IYtjIPQ1Iz0/8AZX+GEvxo+KyfDm20m3vNQ1aeCz0mG+R1ie4lkCqGdCCi8ctzgHOK7f8A4Jn3T2n7X/hWczE+Xr8Dx/PkBhHMR098H8BXXhacak7SM60nCk5I7/xX/wAEh/jNd63cX9h448FafC8pZNPinnmWH1USMcsM55PrX2xd6lI9w+X3KvLHdjAHFe7PLsMoXR4sMfWc9T4PH/BIT9oEDavxJ8HhR90CSQH8zX3ZBfXN0FextpZ0YbhMrBI/++nIB9OKn+zsMP8AtGufC7/8EhP2hhGZF8c+E34xtW4Kj9a+4ZtR1WJpU1SWXTolXCvZxfamlY9mOFESg47MTT/s7DIazCuz4Su/+CRv7RKxbY/EPht3z8y/bRX3jc69eWUwbWNKuLUlFDOWEiAkA/eX+oH0o/s/DB9frnwDc/8ABI79qYLusr3wu5zkCTVQuf0PHtX6CLqErFLhXV4SciRJNysPSl/Z2FkT/aWJi9dj8wPjJ+wp8eP2dPDY8cfEjTtFbTXYIstjfebhicDIwPUfnX2f/wAFR5ftP7J+mIpPzXkzPgnnEqY/lXDisDh6NNyW53YfGzrSSaPzEtWX7fFDEo5Y5AFRxW7Q36SIxGJCDz2zXjnoHaac0LR4B5xghl6Gq+miRoRGfu7yQ1UvgZyYj40ey/sQPbp+2t8L7yeVEFt4oiaSFZfLeYFWXarYPPzZ6dqy/wBkaKZv2uvhskE8qOPFVvieJQWTk9M1vhthw2R9XatLZQ/Eqe5vV8yOFbxlSTODlpPvEdaqa95lr48vvLuigSK7/ezrkDmTqK7ZbGlU+M/Hs2ZGLvv6lSF/DH04pPHMc8cxkdACzNgF8nFcszen8JwksgeTgr05+am3KMJ2KRqM9cVzSg2Wfd//AAQ5+0P8TfiZKusGNY/gfrMbQqQMo8y9z0wVqH/gilqMuneI/i5crpaTGL4J30KiZWCkyXBxgha6sOnFWMZbn3B+yIhT4F6QBzzIf/HqP2R/MPwE0aRoiGZJDt9PmNVU+MS3Pt7/AIJ4zRpaeKrRnOVns2491nH/ALL+tVv+CeEgMvi2JcbmFk2Ce3+k1Ezml8Z9WakjJDBI6nAXgt36U/VZB/ZkMMgydoK8/SudNJnRJXsfMnjpPK8b6pHnP+lOak+IybPiDqqely1d9KSsck4s+s/gPJ5nwj8P8YxYKP1Ipn7Pjeb8INAb/pz/AEy1eNifiZ00tVc7fv8AhSZ+bHtWC2Nb62M3xcCfDmojHXT5sH/gDU/xOC2gXxHaxl6n/ZNOG9xn8j3iySD/AIeQ+MrWynLRnxNqR8zqWG3kE/72eal8RTKP+Cj/AIvkWFS58SaoZAFwB6AD0wM16lP37G8fhR61r1uFshuHQYIHWpvFG77HvXhjk4FOS5XYJK8bHzL+2Uoj/aN1aNmynk2DL8vQ/Zo+9S/tn28a/tBXV8luzLLpWny53cH9yoPH1FISlaNjL1wtHoCb4g6EDeoHPTr9abqkz6jodvJjJcgYBxjjpQQlY4PxVbj+yJGhHzPIqsxGNq/0q14yhMegzxkBFU/Oc0DMfwffeTpUDxW7bkkIwTx160eErOOTQvP2ZVZ2BG/BPPaq5jJq59GfsP3iXH7QMDjahXTLgjK8E7R09DVH9iVpF+O1tLbxlNunzHYGySOOuCK6MO7yZlONtTA/4KHxRx/tLpJG6lZNLty20HAOGB69an/4KOwi3/aAs7rzNyTaXAR14O5sjqawxMdS4bHhtscysGPRj1psY23DZ/vGuNaI3WxcjIVhk4H0zQob747UwM7WBYJeqt2jFgBtZXxtGfSrVzp9ve3AmnBJA4FLlQGa8Gkbl8gOBk58sEZ596130yzliWLydqg9jzS5UBzzR6dtC75s9AM/xf41sDw3Y7goRgAODu5B9afKgMmO2sb+YAMwKJwfRf8AGtlNBsYM+UpG4YbmoAyIrCxQb1veQQQSfer8nhmwwp3P8h4wxGRQBQuLeCVfONzmPcQSOuQc/wBa1Rols1uYw5C5zjOcGgDFaHTbSQM1wWPccHFan/CNWjqzNI2SeKAKf2W3vFaaOZAV77uhrSTRraON4dmUflgDjmgCtcvAbYxyuT5aqHKjOanXRY4g6LKdrlcA9sUAZEyWdzMwuJZUBbcV2Y+bHv7YrUn0SG4lZpZXKk5Crxz60AZ1tMpljM0k7tltmY9takOlLG6SSTl2QtyRQBl3CWa+YZLxstImAU7mtGTRo5WkeSVmLsu0HtilyoDGFvbtEQbtQPObG5Oc1rQ+HIIOk5bEhYbh68UcqAzLe3hFookn3Rhx0U8c1pJ4fljgW2S/+UODkp15o5UBUlgWW1lNpe5UTdAuQKuvoqFXjhu3QlmYFRwCfajlQGPFDbuzqt5CMhcDZ0/HvWovhcZJaYcrjGOnNFkgGaWhWaT9+jh3Bwq+1XbLTJrWaSa4nVw7fKFXG0UwMXxPcNbTKRKykr8o7ZBNbN9oWn6jMs10CSn3fSk1cDM8NWFwkP2mdmJlG75u1byW8SoFUcAcYo5UBhaj4euLm4e687IOOMdcVPqlxIl75UV5IAYslVGQBUAZ0mj3MM5cDfudBnPQZ5NTWUt7LdRBpZMHIIHpjrQBEdHnhDXBfzB5RBCjkH296saNLc3F8YJJWI56/WgCrFpd/M0QwQWizK5H3TuH9K1dVludPVAjnG/EnI6UAZjaHdbGXz/4Vxk5/iPakk1S9BJVxzHnIGcGmldgWXgu4tPFtDGryKACxPXmnWl5cNC32j+FN2cflVcqAgbRb3e3lxqqKNyEnknjj+dX9Fu5ry3DzqQ4YggijlQ07Fc6XfRWoAtULCcsUzx9KdfandR3sturLtbaqfKOB3Jo5UPmI9N026truK5dkbbHtcAk4+lSw3d1MbcLKEMiZPy0cqDmNeOUKoO3GfaqdnfxXUhgTgpywJ60nFBe5seHZFXxhoNyXCGLxBYvubOBtuENQaeVGs6Y5YYTUrcsfYSKf6Vph4++Or8J6P8AtpW8kf7R2qM0iZljglyvBPyEf0rX/bu04J8dJb1CCH0+FnOMFcM4rtn8RlH4EeQXW0W8KSPzt4ZecUmoeWYYXFuCSMKUBrOXwmT+IwX2tq5jiBJU4UY+4PT3pr7o9YJZWB3DFYFnvX/BPi7GnftT+Gbt1+UeIdPiYqP4pZjDn2/1lc1+yzq914a+K9t4gCPK2k63o2ov5R5C2+pQTMDjsVQg+2a7MG7VDDEP900fqDqNlKtwwukHlRzr5yTHaNgfkH8dufbd710+u6JHPfXA3Kd0jK+8ZDcnNfT3lKC2PnNITMdop3m82U5Cjhl4C0sXhnV9PVU0jUVWFfu2tzGXQfQ5DIPZaq3kx2Q5LbevTcFHyjGRQY/EsZ2vo9pJnjfHORn/AL6UkfnQ0+wJJEcscsrPKWZmb75zk/jS/Y/Et1+7nis7VQeDHulfH/AgAKVmO6KdhbvFeS2NvalYXtjLJx8qOG2ocdATk8d8Vuadprw232ctIcuWkkY5dyeuT/L0pwg7kTtY+cf+ClAum/ZagWYZMN1Ko44B8xTWp/wUy0nb+yneXRJU297uII65rzsxi1SZ34Dl9okflyzxrOSSSwboKjXEl4WU8bx1+tfNnuHV6HcL9nVrjuelQ6dMYIWQH5mcEAj3zmrXwHNWV5o9R/Zelmj/AGpvh89tceU//CTW2x5DwvzHpyMVT/ZyaaD9ojwLqbR+Z5fiO2dVPf58f1rbDFQjofV3i29tIvFWpzmR9xjuiLkHnbmTnHNVfFjLca9qS+WEH2W4JI6cM/ArulsVJcx8eePCy3DR2zhiuTJk9+Pz+tN8YWsvmu5Vl2sc5HbiuSZrB6WOQuRGHYsCCecCpZLRw5L5OTxWZofaf/BHCRrPVfjBOTI+74NztGoQfKwuG6k0f8EhYYUuvjWZPLynwXzGSucMbuQEH8AK3omMtz7x/ZTLD4FaGSSCbds57/Maf+y0oX4GaCGHH2Y/+hUVPjFHc+xP+Cei51rxMOn7m2z+Dyf4/rUf/BPmYr4r8Sw7htawgb8RK3+NRMxnFc59aaquy0gJP8XU0uuFntYAo4yOtcr+I3aPnL4mgj4iaoSP+W2f/HRT/iwuz4jaov8Atpj/AL5BrupHJM+pv2cX3fBnQP8Ar2I+nzNUf7NDCT4K6Ie4jYH/AL6NeRifjZvQ+A77+P8ACj+P8KyXwmi+Io+JgzeH78KefsUuOP8AYP507xAI30i7jlHym1k3H0G080Q+KxR/I/4uS10//gpJ4vNmHVZPE9+oSX7yZj5JPfnJ+hFYH7R2qeLtO/4KC+OLf4coLrUIvFF59le7XajrsO4f0/CvUj7uxvH4UfQ3itrS3s1T7QuGXkDrXhOreKP2r47FX1HwbpzhRx5QySPTG6m3d3YPYwf2xUE3xTguAxDTeHrJh83oGX+n61lftJ33iAax4Yv/ABNpHl3t14TtzdxAHEcis24fqPypEDdNt/tel2luDjawLEJ7dvWs/Q/El5Bp6p5PDRnAPbjtVwSa1JbaZn/EbSpYdFupXLmLafuAVJ4yku5NIuXltdqzWpWKPPTj09aiWgrs4vwTDLceH2lt4mk8mdmJ7AenvT/BCLFoEjRspkNwwYqxxjAPeoi2xHvn7FzKvxwsJFnjjaWxmEmFOW+XOAPwrN/ZIvYbL48aFFMSqzrMjZHzL+6bHNd2G+IzqbGn/wAFL9Jmt/ibo9+8IxHaIjMV2lgHYZP5Va/4Kel4PGekguSJbQkk92WYc/kxrDE7scD5oAJunU9mNPusLqcgXoX/AKVxLY2WxPCpK8tRGSEJFMHsPWM54NSRcLuHUigm7HIpK88U5SSOaAuxPL96dQF2NCDPJqXYvpSsguyF0XHTvUrIpHSiyC7ICoKlRxmnrG7Z2gHB7miyC7IQNvGelPZMSBWHfnBosilsMp0kbIfak0rDGMNwxmlwx4WpAYw2nGacYpD1xQA0JkZzTwCowaAG+X7048UAIihTk80p4OPagBHUMcjiloARUCnJ5p6qCMkUANAycU8KAcgUAIEHc06gBNi+lI7EHg0ABQZ4NKpyMmgBvlLuL4GSMcqOlPpWQDDAp2nAyvQ7afRZARrbwqdwiQH1VcVJRZAMmt4nh+dcgHODTzzGwNFkBhS6hp9uhEloqMx4UEMRW0lnayEyPboWPVtoyaLIDCjvNIUlpVkO4AEbMDiugNpakANbIceq0wMO3vNOkmAR3LuQFULito6fbMcpbIMHqBigDEuLvTVR5YrQzEOEk+UZx+Vbg0+JclIVXLZOOMmgDGj1HSpCIxwy9tnQVsHTLckE2seR3xQBi+boMEjTx3G1v4+O2a2P7Is9242URPutVFJhdoqToYBFcpMqhZEYF+AMMvNO1+LydMlfHSMj6Dr/ACU1VHSegVZPlPcf2+FCfGazZZEO7Soi2wkq3zn2561P+3RaxHx7oepJGG+06LGYy/oCD2+tdUtWZQbcEeGzQszB1wkvzfIR/D6j0q3PaC5jjVYtsnTc0mTjtUtXCyucrNLEurq1wjsZT8oU8Y+tWb20C6r5M0zKR0iRMY96nkiM7D4S/E3TvhZ4i1LWdZ0ya6S80iW1hgjUBXlIOzec5wGOfzrmPKW4UW08IOFLDzOc1pCTp/CD1Vj16P8A4KU/te2wEdt8U4JlSNRmfR42OQADk555zzXj2yIWhP2cEhlXOO1XKtVluzD6tRbvyntkX/BTz9sbovi7SZPQzaEh/k1Y/wCy/wDslfFH9qnxq/gX4T+GorqW2sZL3V9SuJfJs9LtI+ZLmeY/KiAZ4PJI4Bo9tif5mP6vR7HRxf8ABUX9ruMhZ9e0J1Ay2NHA/wDZ60Pit+w7J8K9IW8PhvV7+3IVotdvkFtb3wOQGto3Ks8RKsQ5X5gcg4pPE4qH2io4SnN+7G5Vtv8Agq5+1VDKRcQ+G5Fz8v8AxL2XI/B68osvhMbi/NveaM8eZgIyVIGc8KeT19RU/XcT/MdMctpS3Vj2qP8A4K3ftJwxqJPCvhlnxxuicbvyNedaZ8JvCo8yHU9HMFwhKsHlKkHt1oWNxS+0VUyuile1zZ/aB/4KEfGv9on4dyfC/wAVeHtE0+xllSe5mslfzZNvRPmPSuc1b4S+CreUsbWYse4lOf51E8RXq6SZyxpUqUtEeQ+UJJ18k7vm5I7V6Lf+BPAtkFnjikWRRkp5hIrHkkOVSK2Od02KSbCtjOeM1sYsYgTBbqqAfLxyadnHQ5py5pHWfs/xzp8fPBESxSOf+EltPkiILMPNXIAOM9fWqfwpu1svjD4QlmmRI08R2bFnzhf3qc8VvT93Y1h8J9Z+OvJfWdaV8q5iusc7doDMelReO7C3XWNZurh90S2t2VZOXYZPJz74rqnJpFHx544vZVlYSytlj83BIJwKj8azE3BLxFS3bOQCAOlc0m2y4bnMXOoOT3GB3HWobhsNtZCxPQn0qTU+2/8AgklLHaWvxt8zyj9q+D8ZiEj7S5F2+/ae5AxkcdeCar/8ErbuSDRPjTJ5UitH8JLba0RwZB9rkyp4PC/e/E1vS/r8DGW59/8A7LyEfA7QMN1tCenqT/hR+zIzL8DvD+1sf6GOf+BH/Gip8aJWh9a/sBXEH/CeeI4Bn/kFI+36TKP/AGal/wCCesRn+JfiC2SLLHQflOO/2iI1ExNJu7Pr7WADawqr7sMO2O1XLmxjeOPzuTxnHHOK5X8RTbZ82fF9TB8RtRDpyzofwKVZ+OqKvxRv0UcCOMf+Oj/Gu6kcsz6Q/Zfk8z4K6PxjAkH/AI+aZ+yzIG+DOlqOivKB+DmvLxSSmzfD/Aei/wAf4UD75+lc8fhNPtFTXULaVdAHG62cZ9Plan6vhtOnj9YXx/3yainfmuUfyJfFqNj/AMFNfFvzHafF96CM/wDTM9Km+MsXl/8ABT/xTFHh8eLb1vLBwQSjg16NN3qG8fhR65rzhLMGNgD5f8Pem6+/+iArH+Vbz+IHseG/tZwyXXiDw/qNzACsmiAbwxxnzGxnH4fhVn9qOC4uIPDMj3QLfYJl+UcYWT/7IUWZB5/5IGlQrbKsgY/dAxz3NO0p7oafBHLGDtOAenFVG6QaGd4oG3T7iMM0skceAVbAFT+LYLm4slSOJyrI4dQQBkUxXRwfhdpEsLpTMcwz5ZG5H596k8KwwyR3BGVUsHYKc9aizIPWf2XL4J8b/DGpTklXunjfeMlsxtgAn3qv+zm8cXxs8KIFb5NU++7DaMggfqRW1FtTMptOx3v/AAVAgkkv/DdwyncbCXBzkn54z171r/8ABTrSH/4Qjw14heTCrJcQYxjLYjb+SmnivdjZlQPkyTLXwb15NKH3XOQOseRXn7GyasXFT0Xj6VJH/qs+tANqwY5wB27UqdfwoIHICByKWgAwfSnKwAwTQA6ig0ugo5wTjp1oJewxwAeBRMyRgvI6qqjLMTwKdmSNO0HJx+NIRNKv7qHcD0OetQ1K5atYRt38Wfxpsnnschfzo5ZDDgegpuJhyyg/jSsx2Y8At90Z+lMR2OcRnr/CaOV9hbDiFBwwGfemsZs5Fsx/DNHKwuh+3/Z/SiOW5aQk2rY9dposwuhr4xxSt9okbAtW59qLMNxhIHU097e5C/Pakc8ZI5pbDswTlRilRWQ7mQgc9vSgQYPpTg4fIFADQpbgGnIpXOaAG+ST1P61JQBG67UAHX2pzKScgUANpdjelAAmN4z096NjelAA4yx2jj2pyggc0ACj5eRS0AAAHQUUAFGO1ABkjoaBz0NABk+pooAkoByu4dKACkyPQ/lTAz/EyhtHuSwwFgYhge+DUniEK2j3Kk8mB8/Taf8AGlSb5xVXeJ7x+2NavJd+Db95Dufw5GVboM7YqT9ry5trnw14Duyo3/2DEXkGBu+ROMjk16LT3OeN1E8VvzcK0cm0ElhkZI/lyKt3y286LcXsR8wEYZWwAal6rQd2clrMUw1n7QQcBgpGSQPxNWtWjkXWfOKuiNjkLuUmpswuwtrExxO7K+BIAHY4HPatE26mKJo/lXz1QgZAx1ycd/emmluF2RW1qqpsZAu3mTzOR9QOuKtWsMsbO1uMF5CN3XI6Y5p3Q7s/W7/g3u+Mfwa+D/7K3xP/AOFn6TYiC6mGpa3qE8G4ywQyRw29s/HMG+Quy9yvIr5R/wCCWf7QHw48Jf8ACSfAX4nQQwad4qs5bYztHlxbyqvKjoxR4w/rgnHNbU6cWtWTOdXn12PoX/gqZrfwT8a+NbX4nfDv4rDXbfV/Eo0mF/OBEwiTMl4+77iGSQxpGOAqA9K5/wAZfCS58LW3/CNv4P1XWvDs7O+mppLm406V2486PYrEOw5KE5XnIFceLw0qlrH12S4/L8Nf2ul0e1fsxfsG/sH6r8L/ABla/tgfEKy0nxpoIeLSns/EUfkPmAPG4dMiQlmBwOmcV8ufFEeFPCGgyx3Gmz2TpGRBYTzEOMY5ZTyvTofSqoUZU9yM2xGCqpyo1DxT4/yeH9D8T27x6i0sjQmO8k2hVkeJjHuB/wBoYbPbaB3rzb4k+JbrX9WbyrlWMasCVl/iZ84wfbFXO3MfPfXJKmoPUyfEGs3lxvVsKu7AIbkCsma2u4pPnlJZG2q+Mjb6H/GkkcVWbmytd3c8cY3guu35VV9ox7+pqC7+0LISUL4OGAoszG0mVllluR8rbAWzjOaWzedHLfZ8gKV6+tDRlJSTNfwvcXlv458Oy2yO5bWLfLKvAPmx/lVjwY89vrel3h4+z6lA+A/XDr/hQtzrou59N/Ee+1aPU9Xu7e6VJI9OnCSzrnfwegyc1p/EG4J1bVZoLCWQzaTMwWAAOo25yQf6V0S+E0PirxPqGv8AnCSTThnpheVXIHT+daXinEd0+1NqE54bjOB+tclRPoVE5BL3VDlnszkHHOauXe5mYI+KztIo+uv+CV/iHXYbP4wiLzrWc/DOCGFLeYo0kYuZPMZv7wwRnJ+lX/8Agmcl+um/Fa7tZgxPwogRotinKfanHzdxjnB+ua7KFyJaO5+gv7NayyfBHQQQFH2LoOM/Maf+zcwPwU8PMpH/AB5ZH/fRp1HaYlqfXH/BOdzF8VtbjL48zQm2vnkYkQ5H5V4fpes6xoUc0uianNavNCY5HhkKllPVSRzionFT6gfevjz9rT4JeGfGTfDOz8Y2upeJ1tmuP7FsJfMZYxwWdgNqDPfJ+lfm58FLsj9uBl8xmWTwjISXJJxuXueTV0cLHlvc56tZ03Y+uvFXirUfF/iObxBqUaJJclSFjzhQOg59sVmnPmgMeRya1a5DHn5tz67/AGTc/wDCmNPDZyLmbr2+em/sku8nwcsy3UXcwP515GL+M7MP8B6cPvn6UD75+lcsfhNPtEN9H5kEijr5Z/kakm5O0DqDwPoaa0KP5E/2gEt7f/gqd4stJ5Chj8Z3oJcYB+Run51oftb2Y0//AIK++K9PmRUZPGl7w3XaVlxn/vkV20FzSubx+FHomu5EHLEADkkVLrwQRBwzY/i5zxXXJNTB7Hkn7RVjFLoHhy8EAkCm6jBB+6Mo2P1rS+O9q0vgPSLoMxFvqsy4K8fNEpFBB5ZZA/2XEWgAwyh1DDPX/PNWdMMb2SMI9gLqAxUdQeepGaCZblDxXZWl5YyiVmXdAzYWUED6cVsavEtzC9uH2DyyvmJGF4P1yKCTyrwrbQPcTxKsiKQAjhPvYPpmrGjxH+17uSJdwU5QIPugsR070Clsdp8MrZtL8VaJrcbYEOuQOGJwABMvJPOPpVzSG8q0S6S3QNCVdlTI5BBHHQCqjpJM53uey/8ABTezt/8AhU3hq6SZpAdakhAAyoLQsS35r+tXv+Cktk13+zb4c12HIij16JtvoXt5Mj86rGL2tnE2gfFcR/eJIDnMAP5imWjBorcj+KFQfyrge5ZqRPmPbjpTIzhCRSAlU4NC7QoZqAJRHkZyfwFODAgbTQA3y/f9KcnLkE5oAB8wynI9aRzxkcfSgBl0sj27xxfeK8DOKC/948Z5xQNK59lf8Erv2ePh74u0DWvjH4w0a11O8stYOm6bb38YkSArFFI0gUggs3mbeem2uq/4JH6rOfhf4t0gsNieIEuVx1BkgVDx/wBsxXoYeEJbieh9N674Z8DaRo11qkXw+0WQ2ttLMsR0qFd2xSwXOw4zjGap+KviV4Ct9R1DwbqWvxQXsFnEbuGUFfLSfciOT3UncMjkY966Jxpx0SBO6PK/DXx9+HPiTU7vTl+Cekxi2mhUP5EDb0kihcPjyuPml24/2c98Dl/DPwwsPAfiGK41/wAaae0N1plvdRXMUMhgljt/LZgJApUsVhYgAkkDmudqXNsrAehXvxI+H0Hhu81+3+DGkStbQrJHALWEebkIcZ8rj7/oelcPban4MTwvP4aPjKNJ7zTi1tJNYzKEKCMAOSoCnMMuBnJ/CrsuwXkalx+0B8M0vvD9mvwP0gtr+pXllGTDCPLkggmm/wCeXzbhCfTGc84rkW8BeHJtd8H3p8XW9vJpGv3mrva3FjOjrEbO5t5BIpUGPHnsw3bd23A9aLeQa9TsPE/x28DeHdH0zU1+BmjMNQvbe3ceTEPK80xDdnyucGQjtnZ2zxyfiLwPpHivwzpXgqy8cWkWq3UUL2kd1ZTp5bQS+YzSAqDFyABu4OD1oa02A19A/aV8Harp1pdD4D6HFJKJDLH5MZMe0An/AJZ8/eFZvhj9lPxR4iitPFnhfxtpUml3V3NJC7RyrujZmGMEcEMFzntUcr7AegfCP4seCviR8QrnwTN8INGs/Js/PguVtYm80+XFIy48sYwJVHWsXwX8OIvgb8WbTxP4v8ZafHFB4cuZTaLBKXZYoo1nkZgDwAkYx171cEk/eQm7HtWvfCf4W+J9Kn0PXfh9o9xa3CmOeP8As6Ndy8gjIXI+tWfBnjLQfGuirregXMkkLOyOJoyjxuPvKynlSKJRg+gudn5aftjfBiH4G/G7WPAWh3cj2MKwXenx9WFtKCQp9wVcfQCvTf8AgqHZhf2jvtBX/XaDbEe+C9eZVSVRmsdUfMEWQ33etSHisxgcgZC5qnrRPkRxK23zJVUt6A0APa8gkl8uKVSwHIBFZH2UfapLU26RssYaOReoPPJ9elAG7HKD8h4PoazI72drJb6CEySLEDsxgE0AaNzcRQqVLjdnpn9a5y5uJZ7yJmmUyyqxUoTsUDt70AdBBcqx+8OnArJtZJJ7ORpCMxggMjH5j60AbfmrvCY57gdhWNqU6to+MnhF53HPUf40AarzEORgjnuK564RQ8kkdkjRxyBXYynOPpQBvrOwbO3OOnPWsiwlNvbSlckRuwXucCgDYu7+3t4xJNIFyPlU/eI+lc1qOupYzrGubicxgux/hz0A9KAN+HUbacbre5DE9UA5H4Vz1neSXE26W3eCYqWjI/iA680AdTFcxlRluPWqFrIbmyWZxglc4FAFu51ARovlMOvPzDiuQlS2Om25Mx/1p8/5uQcUAdSdUnDbQwORx83WuX0mJjcwB5CQFbaQevNAHUX7vc6TcMx+YQOASfUDrUal5LJ127gylSO3IPX8qdOD5rkOLZ9E/tZ28Mvw9+Hd3PE0ZufD0EsBMGBICicdeKrftHzTat8HvhheTThw3hpDDIyDpsj716kv4SMrW0PJtRsplhjjlfbKxLOHUkoB93njr+lT3Uc3lxmYKy8jeWP61hD4QOR1pbldSjh8sAnlcE8n9auaxaxvdxNA7SSDoSuVHaqAsnTby4s0tNPnbfLPtCeaMfdz61ck1Gz0i0tp2kwYJWaYEAHATBxnryRzQkpOw2rR5iKXwv4u0d2TU7WOPcT5bSy859cDJr7k8GfsEfAfxZ8KvB/jDxxfeJLzV9d8NWup3ksesNAsckylikaJxtGB1rshgKlRaWOOWNoxdnc+FNP/ALUtJob2Kf542GMSbGTnjaQcjmvu25/4JvfsyzHMV14qQ9j/AG3k/qKawGJT6feL69Q8/wCvmfL3hj9qf47+GLWbSrPxZdCKU7WVLpl84Du4RlVsD1B9819On/gml+z48bLD4k8Vx7lIz/aEbEd+68VpLB4m2lhrHUH3PlHxB8WfG/ihmkv7hHV1JJZgWOa+nrv/AIJkfCIRlbP4keLY+wBlhbH/AJDrP6lig+u0O58T6nqmsIcJb4XIKl4N3I78V9i3f/BLv4dzHbF8XfEykf344D/7KKh4HEN7F/W8OfGFvquvFizK3JzsKHn2zX2Drf8AwTF8O6B4U1nxLpHxc1aWXRtNlvmjvLSIKyxjJTIHepeCrxV2NYnDt2R8aXV7qUV4UvFEZfDIDx/Sp9W1mfX7yS9kt1JJCiIrwuMcD0PWueXuOzOmMYyV0XINOK20Mq/KC2WiBJz+NXVs4fLV281QqgpgZJPp7UnFnNXt0LPhmwElxbyIGxBdRmTGM/ezjBq5pURt7E5LZVkZm8tc5Dc8/Q0lFhhtj6g8dlV1W/FnfKW/sGZ1mjTJYbBnGTyvv79KqeL76MB3aFWaTw9IV2oc58vqMdK3l8JufJXiyDefLAGAcjPB6CneJT5zhFKyDaCXzjnArne5UTmLiParSKpGSPlNSlYiWjlkYe55/CkUfV3/AATwnuIbT4jadp1usj3Pw1ieeYzKoSNbpiVx1bOTxUH/AAT21r7JF8RLS2EiNcfDaBUYnAO26fcQO/UVvR3Iqaqx+kn7NsMa/BTw8yHP+gLz9Sf8Ki/ZllI+B3h5if8AlyUfhlqKvxCh7sbHoQl/dEbenvTGZFhYjrioA5f4QyKv7cungced4NuuPcbai+HK/Zf25/DzrwZPC98g/AJXVRaUDjxHxH1lvIkBI524psrsLlV9etElc5z66/ZBct8HrZT/AA3sw/Uf41D+x1I7/CCIsemoTgce614uL+I9LD/AesD75+lA++fpXNH4TT7Q2QjKqQOTRKTvTHrTKP5Kv297A2X/AAWH8XhVIkHjm5DbvQtKAPpzitX/AIKkWi2//BX/AMYrBGY5V8bNuJ43ZnbGPzFd9D3UmaxlZHXaqIZraM7iMLzReqwiUdCCvU46V1vXUHLQ4j4wQNc/DRHLgtDrSnYBnhofQdOn6VqfEGAN8O78OAWW6tpOWPXLD+tSRzHkOkoltZ+YVQJ5hJZicbT3HXvV62tECyM7q8YdMFUPzH0welAm7hd2lvJDJER5oZNxXdj8Ae9aepSWsYwwdvNX5SVxt/GgR5Fa2sdv4yuIY495fJJZANi59e5q7JJp+keLJzHGyv5pXaNzAg+5quUhu51ulWTHS7qJirssLYKtnjGan8K6nZzwNbWsxZcFWlxkJkcgnuaaWpDSW56f+2jeya1+wdpeuSyM6x6lpO5mJ4DKsROfq/Ws740w6t47/YEm8HaVC0lwbvT1hZVLBjHexFiAPRVzV4hWp+7qxxlFHxst/wCXbREkBtvT09q1x+zl8WiB5fhDUJhzh4bSQg/pXnKNRrVFe1prczRrjDsauf8ADPXxiD+WfAOr7j0UafLn+VDjNdAVWk3a5BHr+8BCvX9KJvgb8U4QS3g3VBjqPsMv+FLXsaXp9yc6+o+QZ47qKz5vhR8SLQ7W8M6gp7qbOTP5Yo17Ben3L/8AwkUSnBZge9ZT/Dvx7EwSXRr9CfWCQAfpRr2C9PubDeIF2kkcewrB1Lwp4r029NjcWlykinBDRnH54o1H7ptHX4ypx6d652bQvEaEh1cbTzk9KmUbhdRPp7/gn/8AtleGv2dPF9/p3xASZdE1uOJZ7mKJnNrKjHa+0fwkM2fpXy59g1qMlC+T7NW9OrKnsiG0z9TfiL8Zf2LfijqP9v6j+0NpVpM6wjzUvkAaKLOEIcc5JBOemzI5r8r1g1hm2IMk9B3NXLFyv8JUVGx+qGt/F79kPxFoOmeF7/8AaQ0ZrHTrZ4kjiniDTb0kjZ923IBDZYdGwOgr8sDba0r+WR83pkc/rS+ty/lHaJ+ml7rv7F+q6nFqd5+0VoasFcTCCSKMICXK+Vj/AFQy7ZC5z3r8zl0zxI9t9sSzdot2N6YYZ/A0fW5fyhaJ+o158Qv2RtX1f+3tX/aO0B7qYs19cl4FD4XbhWOfLGCdwGd3evy5Sx8SiHz1spdhPDbRg0fWpfyhaJ+n3h/xN+yHoer2OuSftLaPNd2UqNNdS3cZebZJuGHOTHyTnruB96/MF7fxFGgkNvJt9Qoo+ty/lD3T9fPC/wC1B+y54W0VdBt/j/oMqCeaVXk1FAQJZHfHAHY9K/IOaDxFAds+nyLnpuQ0fX5fyBaJ+tev/G/9knxFaW9hd/tDaRtjt7uESSayjSMlwhSTLOWIAzwPbHSvyQdtciIV9PcZ/wCmZoeOcvsiaiz9d/h1+0X+yX8JPCU2lWX7QXhy5hEzTyiK5izk4yI44xgZx26kk96/IjzdZDhBZNu9o2P8hS+uPsLlh3PpT9tv9pvw38dvi/d+L/CiMNPtbRLPTmlO1plQEtIQRxnOAPavmh7nVXYB7Evt6q1uxNc85qcrlpxSsdlBqSS4Ly49i1cV/aOopL5ZtxuAzjmpuh3idzcy2l1A0MkuQRx3wfWuIXWr1Xw8JIx1GaLle6dWtlJIpil1MBHXDOkQ37fTJrlf7cuSeYD7ZJouhOx28TQQRrDCqhVXC7fSuKTxDdkbUj6dgTRdCOkj065iTyxcW5EbsYg0ZPX/AGs8Vzg1+4JGIGHoeaAOpFgTpX2JpY/MXrsPDc5xmuX/AOEgnT78b4/KgDpf7Mf+zJLWRo2kb7qkngZyBmuaHiNzgbX/AO+6AN2TTp5GLyaPGS2CxFyQCfXFYo8SEcENx/00pN2A6XT7No0lN2qoZJM7VbPB61zg8TZOG8zHfEgpcwGhe+HrC9kZTeeTcRNgtnhl/hPvWe/iKKU7pomb0zg0cwGrBaTWKZn1WO5YRmOGMAAjPesqPX7dG3xRMpHcAUcwHU2tqYrZIi2cKAa5tvFIyC8smT3o5gHi2gk04QeWd6XO1yY/vDceaF8WQvgea2CMn5O9UA3T4lt7y280MqlnXheBgjH51IPEUMmMOevePNJuwHSQ2yRwkGQ4dW2kcfT+tZEGrrIQBM302n0NbU5aAfSHxSE1/wDs9fCXdguPC6RoseAF+VevvkUviyOa4/Z3+GCEBvL0Nh3BHI6/SvQ+KmjH4ptHAXumsNNtxFAm0D5mJ61t3lhAugRoVC+Ufv46ntWMVyuxE3yM8817TUa5jjTpkbTsGBg9CK1vE0JmuYIbiONHPzEsvHuavlQ1qc/4ogVvDrzxWyu0aTF4+33Ov6CtXxLpRk0mRSXXzIGCktnOVIxihrk94uatRZ+l/ge9mi+CPgSW2jNwyeDNLgjTzNm4NEOc8+tZnwylXV/2Zvh9qj/Oh8M6U0u1TllUKDjH0r6DCq1DmPnKvxs3otX1CK3nuNW0xoGhszcoI5lkWRQQMg8Y5I61Hc21nPZX39htdTebp8yXBnZ2GNoMaqZATkEcgH3rYzNO01HU4b5bHU9Da3Mqt5UyzCRHYbjjsQdqk46VHp50q71KwuPDmp3MsoZA8bzs6xoykMWDDCnt68002hNJkR125l2XP9izmxkUMLwMvCn+PbnOKg0/UdPi8LRaHJeL9vjsGs3twDuMwyqgccjjr0xT5pC5Ilq5u7621EafbaZPdSeUJCIWUbV3bAfmI59varMV1p8Xiq5SfUII5UtrZCskoGGzIWX6glfzqW33KSjbYZ4mnhf4V+LJYkytz4UlMQcc4YL6d6g1UNefCvVGjYZm8PMjqD9wgcrWVa/s2aUrKotD8mbG33MyEsQlxIPlbGfmP+FW7Oyl8+9iwMpfSqvzejnNfOVviPoKUvcOntl+WOQwtlYsks2STir+n6fNNaRoIwCqgszNTZz1ncW0iR7aVfs64CrufJ+XufrV9LR5LWaNI0+aIsGUZ2ge3ekPDbHu3im8liignlnMIPhx/mJJI+RuhX8Kj8QzxppukyXFsXV9AlwEOf8Alke/ernL3Tc+UvFBhd/kZWbccFe4yasa7FG8hVLc7mwRkdBtrBe8yonLz4ywDYwDxjPOKtTWW/MrAqAPz96vlRR9D/sPatHZ3Pi6ylDeZcfD6NID9nDKwFyWfJ6rxjkVX/YnOp6d4k8RTwGMofAnllJZMFlaYjKjvWlLSRD3P04/ZsdB8EPDxUgj7COh92qP9mjyv+FHeHwCcmz449C3+NKr8Qj0CNy8DAqenpSwsBFn061IHJ+EZDD+294MbnEui3qZ9flWotCmSP8AbT8AuWPzWF2AMdcJzW9L4TjxPxo+t2YNMrA/jSO6ecqgYyOBWr2Oc+t/2NMf8KbjJ/6CM3J+tR/saSlvhEYT/BqUo/PmvGxkffPSofAeuD75+lC9R/u1yJWiafaGyZ3rnp2+tEozgZ5z/Wgo/la/4LHWY0r/AILHeM7aT7x8ZwSOVGCAxRsD863P+C9GnT6d/wAFj/FKuo2y65YSYUc4KRE/zruo/Ai1sN1GANGs0mThs9PererRhLUqJdwDMBg+jYrtfwg9jmddjS58G6zCzAtHDHKiMP7sg7/Q1ftVik0vVbGYH57Bz8q5PBBqCDye2sfMWZNuQHQllGBW7bWq+e8aYIdQwOOcDpmqSTAo6jpZMbeWQAY8DdJ8ufrjitjV42FvsU8Bd2MZyfcU7IDx7U/C66r4jkt3Rtjtg5AXd78H+hrc8UQNB4jN08Tu5RduQQR+A6UzMveB/BsOnC5mSQfMpCq4Py+9V4/E+r2JPlabDsYYGXJyMfr9RQZ1E2tC/b+IvGmhRR6ZpmrhILeTdDHIiyKuc5OD7kflWAviW4YjfbRgscHDngenNC0MuSR3Fl8YfijpwLWevwFd2D/xL4yPr9K4NtbMSo8mmJgdCCTn607j5ZHp9n+0L8W7aNrtPEViG3FQ8emAZYdvavNF8QGOJUgtyVznBYjn6UXDlmeoN+1J8ZTGWh1nSyAAGP8AZmD/AOhV5c/iZo5Cz2gGASoIzkmnzMXJLuesxftW/GKOTEk2kMyqdxfSW+7jrkPivJv+EmKIizQOqsThnHP096OZi5JHsA/ay+JkUubnRPD84IB/48WO7jvh+K8hi1+xmY3Kb9irkkDCsKOZj5JHsLftdeLXcC8+HvhuQgcqbdwT+prx2fXNPE5CoWJHzFsE/hilzG12ezQ/tZajKiPN8JPDMmATIuGUsPxU14uNUtY4w9skzSqchGYAEfSjmJk3Y9ii/agsbmNvtPwK8OSLk4XeDkfjETXkD6tpMkiRyXGxFB3bGwemev1p8xN2erz/ALQvgTULcxXf7OPhxwThmATcv/kGvKIb3S0XzGaRuch8dfrUvVlpux6pN8ZvhDnZcfsxeHpWT5d26M8fXyxXliX1r9nMaSAc5BA5zRoF2esW3xQ+Bd5Y+af2cdFiAkJ8qNosE+4215E16rlESdkY53hSQP060Duz1dvFn7OMlgUn/Zw04R5JKJ5Q6/jXkkF1bpLuuL0jPAZtwH/66Auz1sal+yneWaw3f7PsMcJwBGgjBAP415c2o25YLJeOeB5jZ4AFAXZ6jd2v7ItxYbr34LSIhC7VjUZ59cNkV5pBqUDAhp9/yA5pWQXZ6TeeHv2NbmKNLj4Q3QPGwxyOpH/fL150s8Zy73g2qNwUcHP1pOMX0C7PQbzwF+xNctE114A1ZWC8eXczrg56cOc158bkyRkoyZPIDyZ4/Gjkh2C7O6vPhN+xNdToZ/C2tQyBcDy7mfB/WuDjn3ndBdFm/wBojA+lHJDsF2drP8D/ANi+61ASSJr8MgXiNTNt/HK4rjUv3DM01yGG3AIO4/mKOSHYLtHWz/s9fsaSXJdta15ZATiEMQuPXlK5D7dNGdwdWJX74fB3dv0o5Idh88jpLf8AZs/Y+ur91XxxrMYxlomGVB9PuVz0OoXbHekhdsfNufFUqcH0H7SSNxP2Vv2RJNQ8y2+IGp5aQK0LIpVAffy6w49SuFnLqzAfxbW4OKfsqfYPaTNV/wBkP9l1b0pB8WLoRN1ieCI7fx2isu31OUSmVZWLDtuxn9ay9jT7B7SYt9+xR8ALq5ZdO+PKQqf4XgibA/MVC88cxOVXax3K0nJPtTVGjfVB7SZE/wCwl8ITMFs/2hbNgepltIhj/wAfp4NmpykBVh1JUdar2OH7D9pIhf8AYS8AFS9v8etIZTwhaGMZPoTvpzLCSyPaoYywJkZAevt3rN0KLewvaTKrfsC6FKWW0+NmgyYHBEQ5/DdVh47LyVV7KLnr+6OG/Cj2FLsHtJlNf+Ce7sqsvxU0M7jwPs5P8jVqe305j59tbJg9cw7eaXsKXYPaTKr/APBO7XCdtv8AEDRWJ6A2z8j14NWo7K0BE4t4wxHTaKPYUuwe0mZ//DvLxXaXqtP4v0eaMtho40cGtGJUD/uwyHf/AMs5SD/Oj2FLsHtJkUv7AmtNFutNV0vd2/eHj9K1FvZoUM32u4EgwfkuHHB/Gq9jT7F88jl5/wBgv4kQSeda69o/ljgAzkEn0+7XUT3968wFvql6jMOcX0gx/wCPUnRpPoHPI5O1/Yi+KcN2jXk+mTQP8zLBeYIAyOpWur/tTW0/dtr98FQbWJvXY49Rk01SprZBzyPV/i7+zzqfw5+A3wxutRmhe3u9LuVtFguBLtEbhWVyOjAkZFcdomu6lqWn2+jajr97NBbFmt7ae7do4yxyxUE4UtgZx1qrtaCu07nMazoNrYaA89xbrtTqQgIArqvEGiWt5ostnMqYkzgJxkVK3E7Sep4zrVxa3YUwwsdmQySdv/rVs+JfDUGnIq20Ry/y7nGeK0BaHPa1ZI2nIYfvbf3SlgcevpmtbVNGnl0iGKNHLg/IypuOf6Ck1dDbbjys+7f2N/H3gq2/Zg8F+HvEHjPS7fUdN0ZbS7tLm/jiliZD8uUZuOBn8a/Pnxr4PufHniS68U6/Yot1cIiy+TYqqYWNUAA+ijPvXdTx06cOXlujhngac3fmsfqmmv8Aga7BMXizS2JOSF1GIj/0I81+SyfCDTS422+G7MLZAR+Qq/7Rl/IT/Zsf5z9cobjQ5wBb6razAn5ttwpz+RxX5FTfCYRtiDUJU+igUf2jL+QP7Nj/ADn68nTrGY+ZujZycg+YCw9CK/IGX4ca1bLvsvFV0mDz5crj+RFH9pS/kD+zY/zn6+rotmznbCoOec7c5PU/WvyGh8O/EO0wlr8T9bg/upFqdwo/SUY/Kn/aUv5CHl9n8R+tviPR7WLwrq1vFEqq2mzYCjgkqSScV+Sd0/xmktpNPHxh8TzwOhSaKbX7xkdTwQymYgj6ionmEpQa5BxwLjK9yWGwBu9SjjhDF9TuBGVbIYbzzn09PWm+HbTxBb6dFpWoW0bi1BSKVWIJQHjmuBzU3eUbHbG8FZnYaPb3UdpHI7FV2gYJ9P51e0a3+0abFPsG4Dadq9KTaexM3CUbokhtkmge4SQhmgYJtq9Babo5II5lLeWwIbk7se1SRQbTsepX8sUXhDw9PdgyrJoThfLbG0+UwOcmoLGUH4eeHZ2fkafOjEpn/lm3ah6o6T5k1+eSKYn5go4HH+z60zXlRndgDtY5VgOuBjFS0lqiomBLOYhl5d5UghfUelRTsqSgxgcc8jvSuyj3T9kDVfsvjLUS9sGFx4KmVC3O0+dxz2xVP9lO5j/4TuO2kUlJPB1yCEH8fmjbn5h6mtaPxES3P1M/Zjcp8C9ADDJNqQD/AMCP+FQ/sszlvgNoPOT9mOAe3zH/ABp1fiEejwqfKIL9Qe1JDuZcOBwp6H2qAONbdbfti/DG5UYEovY/rmEn+lWNagjT9pz4UXeORqlymc/3rdv8K3pbHPWScj6zkUm4Vx0FSbG+UpyccitTHlifVP7Fb+Z8K5xn7upvn/vkU/8AYy0nUdM+F0z6haPELjUWkh3qQWTaMHBryMZ8Z2Yf4D2Feo/3aF6j/drj6Gi+IR/vfl/OlY4wx6CkUfzG/wDBxVZXMP8AwV51eW3U4mk04lVHJJSMfhnH6Vrf8HNejPp//BS3VdWhcxyS6XaSJKrgbWEQIP1AHFd1JpQRcddEcvrWoWltYMGVd4J3c4FfG15+0F8TLm5xJrKzh/vqYuVOcc12KUbbjkmtz6k8N+J9Pv8AXv7MWYb5rWZE287m2HjPf6V4F8B/izrWr/F/Q7fVLlSXvmiCxjg5VhyPqapamZ7FZRILqSHoXjbcdnH1qrpuq2enanN/aEg2oHjOQR82etNprcmTsya9EZASLOQACVU4P61DJeaRIqn+1gSWyflNIm5y2vWqtrELiSRSwGMjlvrzzWh4hS0vL5JklOFGAQmPl9aBXQqWq+bJPKsZOQxwuMdu1X9OlsEia4kfYCuDz94UEzSkjCurB5ZC0CKBuycoFrRu5bON9sTSMueHIJ/XtTszLk8zGl02FndpLbIZdo/djP1rVjutPnlA8w/980WZLTRly6TDc42QRKf4R1+X/GtY3Vmu2EEBAflyuMfjRZjXNczDoluwJFigCtgkR4P/AOqtNr+wZmVrxQC3GKLMrUxH0rTnYiawTg8M6jj8TWt9o0y5/ci5TlsEZ6/nRZhqY/8Awj2mAmOKyTeRjCpjI9z0NbSwB5QuRkeposw1MkeH9PdTC9lGoPVkBwfyNbkGn2hQKWjGPQ0WYamFbeGtImfLW6g5yDyCPbJ6V0yWlvsEjSAnGSB3/OkFmzJh8H6IuI5rWTy8YfM56H09a3YrCLbuUkAnOA+P50BZmR/wh3h9rcxLAxxtAG/HFa91bc4hlOT0G+gOaS0sYE3gbQISWjidABwA4J/HFXjBL0ERVu+OCPpQLmkuhizeDbBYF2I2RwuV6H+la00BSIy3Clgy8nPJ+lAvaM5ubwnAhBEkh4+YDPH410Edp5sIkjdwvZXNA03JHNSeF7dUxEXUsOQCOfzrpvsXkDKuu5uvbb+Ip2Y9TB03wmlx8oeSPPGPLFdXpUQjl2yIwyfSkEU+plQ/CaVk81dRY9/mUYrv4CYkjQMAeo4oNzgJvhHN9o8z7WhUnoYsiu/nZmLfMM9+2aAPOz8JbtYCDqaBR93Ccg+/HSu3kkUbgVGD944PFAHBS/CjUC4nGpDH8I28iu5WYead7DHegDhZvhVqMLCZb2MZ7scZ/A13Fxc7yVGdpGAQucU7MLo82vvB+s2uQswIByd3pXXaxCW+WXDZ4OE5I/GizIlucQ+hahES+/qM8r29a6T7LcKwLv8AKFwqEfdP+HtRqI5r+xdSiQKWXk4YiuhntDwXQ4PJ+tIDm5NH1ORhC3mlY0xHsznr3Pauja3RhuBYEr82wd/woC9jmDpurEeSA+5VJAV8fiTnk106WzFSfMGcYGCBQHO+xzlxp+uh1JDLlQSxIwfwBrqGhjcFySzjgg+lA9WcibDXJh5bh2T+FWPP6V2VraySyndGyntjBpSdlcEtTk4dO12OMNyQDyjAE16FNZRRW481Rux3FZe1uWeb+VrhwBHKu7gjYOPzrrZ7eDezKmO1aRlzK5MpNM5GQasBuMDO3c7OT7cdPrXSmGJYyZQSM9hVE877HN/b9XChlhfI6nYOK6SK1QMVeA7f4dvUfjQHO+xzRudWLGNVb1ZnTla6KSEEnzMh2HOW/wAKA532OcN/qmfKCBQvVmXlie4rekghDHfOACenUn86A532MjT9a1OzuAUbBb+Fo+D+ta8NtbiQFFYknCuuM/rQWndDJPEmqzReXFBnjczqSefbPau30YQPpyRyEbguMtj/AAoGeX6jd3t7Htlj3CJ+fU/412njGOIW5EcalVcFhsA/lQBg6VbmazjaOALxxuOCK0NNUvp0asRgZwoHI59aDKo9SlJZujGMk8Hpu4rVSCIIMxfnTuyLozYrZyvk+WOO5U5X8elXRb4cKjnGM8tRdhdFCTTgZCfLB2jOcdavzxRSjbtJI7A4ouwujJfTkdtzKDnplM4rTMWyPCKSRzgCldhdGcmjBgQ0YAP91ck/hWt8wQhlOT26EU7sLmS+i2yqQyZJb5iRtOf8K0pCuQcfKvXPJaldivZGKmh2zEj7HwOikD+tabbWbzMkHPGRjijcjm8yrbae8WIYYnXP3QI9o/StCFwTiSYsDwCP4alrUWrehHBpMzxszuCNjclcitu2vUmtvsht8MYyAVUYNKzN4aI1tNQzfDHSF8/cYYp1OTt/5ZPTdJbHg2ytXkwC84JAz/yyar2Nj5t8QrGi+QCwY5yCOg46VL4geFAUwxJB2qy8/WobTKjucnqEIUuBJkDG0f8A16lmRklBBYMTnkUij2b9lMaevjKFZrJ5T/wiVzsJb5Y5PNHJx1HtVb9n6W9XxzoyCcDOgXYHlDJcCXowPFWtEQ0z9Qv2VJQ3wM0UhA3ySA/999KZ+yQC3wM0lB1HmZ/77NEthHp1omELlNv1NSRqfKIyOnrUXQHO+JYR/wALx+GN6i5MfiUgED1gm4/lUuqTGf4v/DqKzjMso8UxKqqMnJSQf1relJxj5GNVN7H6Kfsn/BTw544trjxn4pj+0RWV6Y7e0I+R22A5b1HPSvUv2XPh/r3gD4bCx8Qx+XcXN21wIieUVguAffivOxle70YYdNbnpUFpFbosUMaoiDCogwB9BUtcN2zqCigBGG5SuaWgD4q/4KR/8E2f+Cdf7Q/iM/G79q/w9fNqxs1tkubLU3hMoQcDavfnrXMf8Ffb3XNO8TaL9k1O5SCa2OIUmYLnPJxmvXyzBrFS1ZwYnFzoN8qPyp/bj/YI/Ys+H9i91+yh4H1G+v8A7SuIdU1Zikdv/Hg8HcP1r3prm6kOWumJJz8xzXtPLqDl7pwRzTETl7x+Xhtl+GPjSz1W0+A2pyNp94sqyQwXLeYQecEbl/PNfpvdvcoPOMit5ZDAGNSBgj1FDy6KXus1/tKfY/NXxB+0H4QjunvpPhp4khd1DSpJ+7KueSmHXgD8K/Ub4n+D/Cms+KbttT8H6VMJCGKvYR45Ue1T/Z9XpKw/7Rb3R+UUv7T3gG3fc/w91yPHVVuY+PzIr9I7z4A/BW8JF38LNDfJ5zpqH+lH9n1v5w/tDyPzYH7U3wxDiVvCPiCLDYJHltj9Rx7V+iU37KX7Od7+7n+DPh9snOW01aP7Pq/zl/2jDsfnY/7UnwfOGm0vXozjGTZq36B6/QW8/Yn/AGYLzHn/AAS8PN82SPsYGKTwFb+a4f2jDsfn4f2m/gjLMsxm1uLn586ecZ+gc/yr7zuP2CP2Srgnf8DdCPPQWuMUfUavkH9ox7Hw3p/x7+A9+3mJ4vvYSB8/naVKuP0r7bk/4J+fsm7sJ8G9LQekasB+ho+oVe6D+0Y9j4u/4XF8D5f3kPjhhjs1hKD/ACr7Fn/4JxfsjTKVPwojQEciK6kT+TUvqFbuhrMIPRo+Orb4o/B6cnb4+iB67WtJAf5V9cXH/BM39ky5Jx4DuIxjgR6rN/8AFUfUK3dD+u0fM+Rrn4lfCS2T7S3xDtI0DZzIHUZ+hr6nvP8Aglb+yhPGwHh/U489o9Vlx/M1MsvxLfu2D67R8z5St/i98JZnXy/itoq+zXOP0xX0tcf8EjP2V5zuhGuQn/Z1Nm/mKn+z8WH12j5nzfbfEj4aSKHi+KGiTKRyFvsH6dK9+uv+CPH7OE6EW3iDxCgznJuosg+xKVH1LFD+t0vM8Ng8a+D7tgIvH+jyBOFVdRUH9a9kn/4Iz/AeXcU+IHiZM9t1u/8A7TprB4pdA+t0jydde0qdh5Xi3TSMcY1KP/GvR7j/AIIt/Cckmz+KniFP962tyf8A0AU/qmK7If1uiecnU0Vy0GvWTY7pqEZz+tdzcf8ABFnwZg/ZfjHqyA/3tMjLfiQwB/KpeGxS+yH1uj3OFW+kD8anEcrnm6Q/1rrLr/givYKpNt8broMBhRLpQ/o9L6viv5RrFUW7XOUGoXUhKi5B4ydkin8ueK3pf+CMXiSMf8S347RAjpu0+Qfyel7DE/yle2odzB+1X0nyK0hI6DAJ/StJ/wDgj78Xbcn+z/j3aKR0YQzp+fz0vq+JfQPb0VsyglxqGSrROflyy+Vn9asy/wDBI79o6BDJYfHizdsYVd9yAw/764o+rYgPrFLuMgm1ZSSiSFieMICMetV7r/glx+19YMv2L4zWL8Y3f2nOAPzGKn6vif5GV7Wn3NGPXtZR/nMmB0/d45rHm/4Jv/tz2Q3WvxGsJB0DjWGXP5rR7DELeDQ1Wpp7m3H4k1UMWYPz2KZrmJ/2CP8AgoDbfLF4ot5u+F1kZP5pS9jV/lY/b0u50D+ItSJaZtxAPMbZ2j8K5G6/Yt/4KLWbt5LmQf3RqUR/pzS9lV/lZXtqXc6e813UTuJnkwf4QAa5A/so/wDBRy0YA6FKxH9y4hf9DTVOqvssTq07bnUx69rSuY1uAPlyQew9a521/Z3/AOCiOnkm/wDAdzcccZS3/wAafLPsyfaU+5vT6vqLnDTlgeeFyKxP+FR/t4Wp3zfCm8Yg/wANnE//AKCaap1H0D2lPubLardMgWMoPZhiucu/CX7bNgS118GdQf6aQT/Lin7Op2D2lPudFLf3WQcpnudvWuG1e/8A2sbBCl18FNRzj/oASH+QrJwqLoyuaHdHdrqiMuxgNw64OM15Fc/EH9p3TZCl58HpEx2l0CdD+ZAH5VPv/wArDmh/Mj1/7fErGNI1JHPHOa8Zb42/HKFjNf8AwijBHBJsJ1otP+VhzQ7o9oj1GJELvA+WXBAA4rxKT9or4jQnN58IrcD1KTjP4Urpblc9Pue4w6rbxSDBckjJ29q8OH7UHiGBy118MoQCu19l/IvP0I/pUycXHcftIdz3258RwyxiNlOAOuOa8HH7V0QXNz8PXUgfw6p/jHUR9mg549z2dtRszkMx5PpXi8f7WPh/d++8E3Q55xqSH+aitOeHRibi+p7Ml7ZHO4/J3B714+P2rPB8i4k8HakAfS6jP60c8O4rruewfbbGP5Y7gg9hjNeRxftQ+CFcqfDGqxj0Vo6OeHcLruesyXtgx3lxux3XrXkz/tK/D5yHk0vVUJ6blU/yIo54dw0PVmurF9uXB57CvLrf9o74blT5iaipzyfs4OP1NHPDuB6i15aQygm4VVByBivNP+GhfhhJ+8bUtQTPd7I4/SndMtbHs+napp8NtujulDDoG5JryE/H74aSjbF4hnA9Tatii6Gen+JtQgubbCTq+GBIVeTXl8Pxr+GbEk+LgPTfbtxTvHuB6Hp93bxW6rJKFySQD1FcAnxl+GLyBv8AhLYcd2MLUXj3JcU9z0VtYsIm8trlMj/aNcAvxX+GVw5CeN7FfTcDmlePcXIjvf7U09kGbuIqx+TB5+lctB4q+H14gePxpYbW6fvP/rD+dF0HJE6YajaSZkNwm4ccsBxXNx6p4Sk+ZPFenuDwNs/P86OZDUEzozewtny7tFyMEg5rnjc+GSu1fFVizE8YuVBx+JFHMh+zXY6T7ZaIg/0jPy9Sc5NczONG2gjXrIhTklr2MZ/Wjmj3D2aOlcMnSIH3V84rno76Irth1u2bPYXkfP5NReL2YnTVjfL7sKrck9CKyYnvioeKdHx2ScH+XNVZmfs12NgCXcEBUjPdiKzl/tYkFHkYnnA5x7UKLYcjWxuWeVuQ28j2DGsyK41mHBKyAgdxn+Rp8rDkZ0cVzbReE7UXKjb9pnU5cj+Bsc1y/i3VLm1+HUcl9dNH5eqqrc7chsDOe33qzkpNbG9meSatdCVsKwyB83pxWbPpXiueFmi06aRS3ybCHBHrkVkoyi7saTRWmEZJkSSNCDjrjNRXPhDxEWKtoFzkdvJZj+lVzRKPVPgJfWj+OPD1rp975lxHpN79oSJx+7Hm5GSfYg1ifs16HrmkfE63uLuxe1he1nRpLlNo+6D35HQdatSTE72P1W/Y+1aM/BDTRGCzK8i8jvvNec/Bf9o34Rfs/wD7PVpq3xL8VxxTz3c32DSrPEt5d4OTsiz90E43HA5rRQ5jBu0rn0x9oupvlxnceEReTXy74X8Qfteft96lLoPw40mX4f8AgNmVbzUPNb7VcR9cPNhdue6xjHHLdQb9gS60Ee4aP8R/B2qftPfD3wN4e8RW15qNj4wtZ9ShtJRILZQSMMy5wTnp2r2H9lH9j34TfsxQWMPhDR1nv2uIWutWu4wZpJN2SR/d5549aco8lFowlV9pNcp+ttmAlpED/wA81/HiksADYQjsIl/lXztX42d8ElHUtdaOlBQUUAFFAHwt/wAFjtNJg8NakuVysqFwPcV0f/BXzSmu/hzoOoLGT5V5IpPoMCvocjqWlJHlY+mtWfnJJKVU4XB9cVPLb5GVFe/T1kzxY6Mzbq5JgdVLElSMKParM1pGA0mOQp3fTFaFnReONXE2tpeBSBcWUEozj+KMVR8UrFNb6TNIPv6RD82emAR/SgCFb7cOTg+mKqwRNnKnjHGTQBZE7A8g/jTCQwwDQBIZ1PUA1BuVTyenWiwFjeSd3TsKr3VxElpJKSQBCxLHtgZ496EnJ2iBXu/Eeg2zmGXW7ZHU4Kl+Qa+UNc/aw0/QvEFzZaj4KnKqS0E/mbt4PQkds13f2ZmHslUVNtPsXGnKWx9Wf8JPoP8ADrkGfeQ/4V8kx/tqaBG/73wWAG6Br4Ju69NyjPT+VZrBYx/8u2vU1VBpXPrZfEmkyEiPXLUnuPMxXyuv7Yvgp0BuPDBBP3VTVIOTjtllz+dQ8NiYr4GHs2fVS65p7jZ/a1pgn+K4H+NfLkf7VvgaYrGnhu/bzDhzHc2rCMev+uzU+wxaXwidOfQ+pl1KyX7uo231WZf8a+ZYv2lfhs3FxperoQP4LIN+qsQfwNQliF8UWvkL2dQ+nFvLcnIuIWx2Egr5lj/aP+Fsp3ga6p/iA0K5I/RKXJX/AJX9wvZVT6cS781duY+vTzBXzda/H/4WXBcf2nqMWwZczaTcptHqcpwKlqqt00J0p9T6SUsTtUID6ZzXzZH+0b8DlG5PixaRnOMNdMhB9MGpvMXsvI+kmW4DkeU2fZRXz7afHv4UT5a3+M1iy9sawB+hNVzyQey8j34LcoM+ScDqAuK8PtfjN4Fvozc2PxfsHVvusmtp/Imk5uwez8j3DfL18hh79a8ci+KVnKqpbfFO3YE/KF1KM/1qPaeY/ZnsZlkzyjflXlEHj/Uip+z+Pi49UukYU1JvZjVK56sXJ6xE56/LXmKeMfEkozH4sLf8CUmneXcfsT04yM/DKT9a86Xxz4pQK669G23sVU0XXcLSPRC4j5ztz/t9a4CP4heMFYFL+Fs8Y8taL22YtVud/uI/ix+NcOnxD8WsAN1q5I7RnIo55dwujv4nYICHP4GuCbx34vzzY2cnQ/vITgA9D9KpTkS1dnoluhxgycH361meFdaOvaFDqxg8l5JHSSLOdjqQCPpz1pqbejCxs+T3B/WmwTYGGNPTsFh5hY/MWP1zSiVWIXPBOKTsJ6ELwB5Bnmp/MRRmNcn3pWFdldrBD8rJ+FPkmJbPUU2k1saXKsmm2xT5osHPUmnzuDyQRz3NR7OIXKj6bAyEFM89N1T719aOSPYLlCXRrKT5ZrKJh2DoD/OrFzKRIAKTUV0X3Bcz5vCXh+55n0Cylz/ftUbP5ir+8csDjPb+7StHsvuBSa2MW4+Hfgmcj7R4J0l8HOH0yE5/8draEr9AOfWlyR7L7ivaT7nMXfwU+FF6S198M9Cbd/CdKhI/Ra6fzCfv/wAqXs6b3ivuD2k+5w11+zZ8CLtWE/wg8PPk8A6XH/hmu4M5U4B/Sj2VL+VfcHtJ9zzS8/Y//Zrv1Juvgj4bcEcgaeozXo5nYAlhkD260ezp/wAq+4PaT7nkcv7Cn7KdxIzt8DNBBI/gswv9a9cjukZsbccelP2dP+VB7WotmeJ3P/BPP9kq4Yl/gzpqZPJjDL/I17dLKjJtFL2dP+VD9tV7ngt3/wAE2v2R5V+T4XIp7+Tdyr/XFe7rcYACnj6UvY0X9kr6xW7nzxN/wTF/ZMdTs8F3qcf8stSkH8zX0N+FJ0KDVuUf1mt3Pmq6/wCCVn7J9xlv7J1ZM9AmqPx+dfSu7/YqPqmG/lD6xW7nyzcf8EmP2YpjiGTXI/Qrf5H6ivqbd/sUfVcN/KH1it3Pkx/+CQ/7Oxm81Nf16MDsLhCP5V9ZFrfPzsAe4zR9Uw38ofWa3c+SJv8Agkh8H4022Pj3X4/RfLhP9K+t96+tH1Wj2F9Yrdz45uf+CR3gbG61+Kepoc9JbKNv5Yr7FcowAOevan9Wo9hrE1l1Piu6/wCCRmkFT9l+LtwvHG/TQf5OK+0tkR6Gl9Vo9h/Wq/c+G77/AIJDX91EY4fi/Cw7CbT3x+QavuTbF3yPrUPBYdu7QfW6/c/Py7/4I3eMEyLD4taaPY2MoH6PX6BlIyW96X1DDdh/W6/c/PKX/gjl8VUYvbfFjRTgcDyZh+uTX6FGIBTtHJFL+z8L2/Ef1ut3Pzpn/wCCRf7QVuxNj8StHb0/fzLmv0W2LgB+oFL+zsL2f3h9brdz85D/AMEt/wBrHTedP8c2LgdRFrcyflxX6NDG7Ypo/s7C9n94fXK3c/OiL/gl/wDtma1bvp914ktZoExJK02rs6LjodrdcV+lnhl932qJTkNaNkfSl/ZuH8yvrtY/Mu3/AOCcH7RNmPKi8UaFNtOGWQtwfyr74jt7c3Dgn+MnGcd6X9n0I7B9drHwi3/BP79pxYGhibw+dw5eJyG+oOK/QCBYkj2xBce/NP6lR7B9drHwF4c/4Js/tPajqUFtBqUhd3CoINfkjAz14zxmv0X8EOo8TWQbC4nXJFVDB0b7ETx9ZHm/7F3/AASf0m31SLxT8cbtL64tJAP7NW4aQvzx5jnlgPTNfb/wZW3SXUnc/cmyvHrU1adOmrJFQrVKq1Z1fhLwToXhLSYtH0PS7eytLddsEFtEEVV/CtFrgyLsXoelcxsnbcka4jGoWUUPQXCliP8AeWoggS6tn9JlJ/OiavSZomnK5+iGiuZtHtJQD81sh/8AHRTPDLbvDNg3rZxf+gCvmasffZ6EXzI0KKksKKACigD5a/4Ktaabv4DWt6ikmDUcce65/XFdP/wUg0f+1P2aNSlRcta3kMv0HQ/zr1MpqSjXaR5+OScD8s1tueOPrVwqoyAOV619gopK6PDskzMmtQwZtgzg5wevBqzKNu4oAMAnp37UAReJOND0OZVBH9nlTkejsP6Ua1k+C9FlXst1Gc/7M7D+tAGZE5ADDoR0pI1KxEN1WgCUHacmo2ckYI60ALKw5I71DKSr7R0xTTsA65HmadMm3OYZAAfXb/8AXojkJhZSmeDj644p0G41LoD4H+OkU+m/2JrsduDHLaC3nPYurHaTXefEHwXa+NPB50dBID50jQOF4jYSMPx6V+s5Li40cJBy6omqqkY3iz6E/wCCMfhP4R/ErQvFtv8AFbwDo2t202uWVno51LT1kdbh4pmlVWPIGyNTx6VlfsOaN45+BHgj4P2N5pex/FHxxupLuVGxutodLngXp28yZD+NfE8aY1yxCVF2PRwceaHNPUx/2Fv2Ufhv4/8A2yPHNz8XvCVpd+F/CXiq+0aHTbiENDcXstzJHDABxuCqjsfQJmvpHwb4Zg8G/t723wa8K20jWdpd61498VXiL/zEr5vLtYMjjEcbz/8AfQPevFlnWLo4RUovU7PYp6paHyh+05+zbH+0H+3L4x+Av7JPws8M6VaeCLGGN9PjnFqbtxGHmlZjncVLquPTvXd/sN3Gq3P7XX7RX7SnilnsLW1tNXlg1N4mdIonmeGOXauSRshR8AcjFd2W5hWyvASq1Um276mU6cJTVnY+cfEP7C/xg8PadYaudI0K/j1fxAmh2F1pXiCCeJr587YSwPyt2wa6/wCC3wcu/Cn7W/wf/Zq8KeML7xF4W/tPSvGWr3dvY+Ta3WrOk00jBNu5SFiXIbnLA9a9SlnmLqUXXai4+i/rqKpQUdpHDfEL9if9oL4RaPqPiPxl8KL61s9IiEmpXFvOk4tAwyDII3JQHsTX1f8AHPWfEP7NF7+0t+098TLxdRsPiWG8N+BPDunXJuTezRRBFaZUUpbsrB+GIOFBPoOShxNiL/vaMH6Mr6rp8R8afDn4I/FL4sW1xbfDbwRruspZvi7k0+JmSMnp+8LBQf8AZz3r3H9uS/8AE/7Mf7N3wR/ZY+Gmu3enRR6HF4k8WXdpOYp9SvAibftDJg7A7FsZ5IAxgV3UM/WYVfY0MNFvz2JlRhSV5M8Sf9nP49wrqMV14B8TomhTvBqcjQTFbGRU8wrKedh2ENz6j1r3/T/i/wDE/Wv+CaHx/wDjt4s8QXK+IPiT4ytLB57OR4yM21tat5YB+UiIYJHJIzSxWbVMHjYYerQppsjkjLZnzPF8KviXJpNnr9v4X8RvYajIiafqA06ZoZy+SoRyhV84bGD2r6OsNb8XR6J+x38BrPVbyC1uNRm165tY2b5l+0oIjj0VAwAPAzVTzehSzCVGdCGiKWHl/MfNWsfD3x5oVuk3iLwxqdkDt3vqOjiNefQyRgfh1r9A/in8TfGp+LH7UGrftAG+h+E1j4ci07wna61GEtbrUltA3mWW9VaRxI+CVLYKdK8+lxDQ+rc8sNGTvsuwfV5fzH513PhLWLGMfbbKWN5Pmg87RVUSj0XdHycc8V9x6rqmufHb9mT9mX9orx9riaZpPgiO81D4hX74wjWdsrYbszMY5Ixn/noa6f7cyqhjJwrYdbaLzD6u/wCY+DbnSpIWaKdIA23Plvp8RPHcYXkd8jtzXT69+0Zc/GD9o64/aG+KWgrqWn6l4gW+HhZIUhRdPjkzFabMADMeN3uTXr4CGGxWA+sVMNZ9EuqMKqdKajzHOW0bysrpcWnA4WKNQrewKsBng8V9d6p8b4viP/wTy+Nfxo+Ovhbw/ptlqOvi0+DOmxaZBFJp8wRY4reB40V5ArhCzEtyX5wMDy6uZ5bTq8lXDOJrCjOavzHyQ02swlSusomWAK+bIpye33wa+4fhb4I8Lfs/eLv2dP2ep/hzoOsa98YDdal8RZ9YsFnnXTfszGO2hLf6pVd0O5cHCe+aWJzPIKT/AHdDmXcdOjUktWfD9tqfjCObe+tzRopOdt7MpK+u7fivp/RfhX8K/gd4I/aB/aT8T+GLTX7P4c+I7rw/4B0TVYybWfUmdfKZl/jVBLEvfkt6U6uYcPRoxnCneT6WFGhWlNpM+Tr7x58S7N5JNM8b6nEiIzM0d5I2xR33FiD1Fe3/APBRz4eeGPBNp8L/AIh+GfD2m6LcfEHwCL7xBp2lQ+TAt8nll5I0/hVgx4PfFaUMZkWNVqdGzJlCrB6nq3wS0aP4X/Dbwl4W8YeONS13xnruhr4h8TQXV2Gh0WK6ZvsliByTN5YV5GztGcDjBPin7H2s6rrV5Pqeq6jcXdzfWSzvcXTbpHUMsaAn0CKFx0wor5fMIRp4ycUrK5NWEeTm6n2f8PZYzoU4Rh8t+6kD/aVWJ/kKz/hZcRzaDqCEncupkdf+mMJrjW5xJtnXKxX5t3H0quknG1+lWF2W0l+U/N16cdKrbx/B0oFe5b83/a/Sqm9+wH50ATu7bTzUJlcjBoHdjnc45pm5j6H60Bdjg4PGOfSmYw27GDjsaAuyOQmRtxGMdqVnjDHPWoe5S2GscKGwefUU1pHIKE5A6CkMUOx6AcdcNURc9gB9BQBL5oPTPvk1H5oHDfoKAHk5OajLk8qeKACSSIxbQxOOi46VFK6hjsHWgCWJMfPnqKSOQhBn04oAczYbGOCOtISxGGoAQALwDmgADgUAJhv736UMcDIoARtyjO79KQsT1NAAXYDOe9MdiOKAHNvzncPyphdj3oAN7etJQAodx0bH4U1+n40AODEdOKarFhzQA4uzcOcgdqSgBd7etR729aAHtIyjNMLE9TQArOxUvnpTcnG3tQAizMrh/wBKaR8xC8+x4oA1vCExOpMm/G+3kGPwqHwfk60iv18uQD8jQBx12j/bpMA/fP41dNv5l44cf8tGwfTmlLYBliko5DnGehrQis1jIAH1PrUAXvC7NFq8EoPImWpNFiEOo27EdZRVQ+IzqH0v8G5DK2pLtxmRTUPwNn332oRk8YU/jXLidzqw2x6NAnlrk84FO3EqVrjOoS8/5YyKMfOP5ii9cLBCpB+Z8AjqORRJv2bRpA/QfwdL5nhLTSe9jFz/AMAFZnwj8S6P4p+H2majpF8kyC0SNtp5VlGCCO3Svm8T7s3Y9GlsdRTd+VyvPuKzLHU1WJPJoAdRQB5V+2jo41r9m/xPaYyUtBLx32sDXR/HvTBrfwd8S6bsyX0mbA+i5rqwM1DEK7sc+KTdM/Hm5g2TMSMfN09auatAUv5kI+65A+tfcUn7qPnpJqZj3KDa5PGBTr/93DI7dNrfyNXMZQ1SQf8ACCaPLuyBdXox/wBtyaj1Ag/DvSGHT7Zej/yLURIluUFlQAhs5yc9fWoi6k5B71QiVpzluT7VGVLDAOPegBsshfGOoPNMaURgYHUfnUyTAtWwDhVLNksMADrVeGdxiVGwQeB6H1/CrhoB4Vq1xbxeF7a0igEcsNzcpMFGPm89jg474rsPH/7MPg3x94ll8UN4u1/SpZ0Bng0nUHjikcdW2ZwCfavoqOeU8PhI0uVtpG0XFWbMvxX+0LDceC/AHh3wb4TurDUPAmoTXdrqM9+sqXE0m1nfy9gI+ZUxk9Aawr/9hLQpJvtGn/GPxXEzdRLfF93/AI9Xl1MThq1ZVZRd0dMcUkrHe/s+ftdaJ8NPiJ4p+MXxXsNV1jxD4oYpNJpVtEsUMe0chWcHjaAB+VeVv+wp4jtpWOm/H7WSD90XKbwPzJrGrLC1Z8ziV9YVtzvPgv8AGX4VeAvhT8QvAWt6jrcM/jbFtDdw6QsxtrdDJhmAlGWPmnj2zXm19+xR8X4m36b8fpTgfcmskIP6GpqSoTVtUhxrxtqet/BP4qfs1fCL4weEPF2h32pR6d4b0i6/tTUZ9DYXGpX8uVQhAx2qibu5Hzda8Yf9jb9oSBt1p8aLCQntNp4x+gqb0rcvM7ehXt4nrN18afhv4n/Zv8efDLxL4pn+33njebXPCkkljIyyl3DsCAPkz845x96vI5P2UP2qIYsQ/ETw5MR/z2sJP8alRwa6v7g9uu57j8VPF3wG/aM8R+DfiF47+JVvo1ppXhWLTfEWk3CN9p3RJgCEqMHccc+9eB3X7Of7ZUSmG3vvB1yuMAskkZP481vRrww0uajNp+gpVoSWrPYfDnirwV8Q/wBjV/gLZeIdM0W+sfGjajHDq8wiiubR5C4bfg/OvHGOce9eHy/BD9teCQq/grwZdqvCka5In84jTqzw1WXOpPn7sXtKa6n078OfGnwq8T/tleDLuy17TV8LfDXwzFp9vqdy6LHNNHG5kKE4BBkYYx1xXy3J8J/2xoU2XXwS0GYDoLLxGrg/g0a1Dp0X+8nUbk9zWNaKW59OeOPEWifHD9nH4oeFfHGradfaz4b8ez634cS/vEffC8hLRwFj82VLYUcAYFfLNz4G/attAYZ/2Zp5FbljaavbnLevJGaijChSrKrCeq77A60WrXPpT4i6Xpumf8E09J+H0bWsq6x4qWbUdOFym5LVpWkG5Q2SpIGRjvXzFd6V+0Tp9yJrz9l/xEHUAMYbq2kXA6cB84/Cqk/bYn2tSS/AbqQ9na52fwP/AGavDXxu+KWmfDy20W2t4r2YG+ujtQQQLy5JPfGdv+0a4S41n44WbAT/ALNXi9MBstGm7GevKZ/LNfQ1c5lLC+xpTSXqcaadS7Po79tD9l3XofCdv4l8e6dpWl+DPCs8Ol+APCunXhkQq7MrXD4wPOYHczHP3sDvn5ouPGPxChVF1H4HeM40VwWzpcrgEdG25xketeHQnVp1HKdRO/mdkpwtoz791Pw14Q1X9sXwZ+1JrAWPwp4F+EyXdjqTsRBGxiaPy9x4LHpgc9K+AL/4v+JLiyXRdT+H3jqOyQgmyk0u48gYO4Hy8lQQT1AFZVaUYv8AcTVvNlKoz6e1fw/F+0P+wde+DdB025uL/wATfGxr3VraFzuU3Nx5sbNgZCAFPmPTafQ18yaZ+0Lrvh6GaPQ08daMZiPNbTrK8ty4x0Jh646c0nQpwj7WnJc6/EqNTXU9l/4KVWnw8+IXxm0T4daTMbvTfhx4STRoZIbg7TcOUaUY6FhsUZ7ZxXgq/FDwzdAw/YtYjd3Zna50S5XezHJLM6nJJ5JJ5NdeBksFL6w5JuW67fIiTue1T+EvAng39oT+z/hXpEWnaDceC7C5s7O3YlISY1Eignn76s31Y1znwR1geIPFI1PUNRMkVjp5tllkjKgAsCseSBnHNc2YSjKtJxdzGq48lj6K+Ek032bVIGHyi4ifj1MZz/6CP0qz8MrCaDTLrVWiK295cL9mY8GUIpBYD0yeD3rgp8yWpw2OqhkjYd/+BVXikjUlcEHPc1Yi5uQfxD86rkggAVSegFgAM4wM+tR7nTATqR61V0BKwaNSd+d3+z0qESjPIb8WougHFuOW/M01m+XAPf0ougHBx2b9aj57/wAqLoV0KzAuQDk1E7KWK52+4qHuMHLJGCQc96hkdmfG8kDtSAd5u7jpUZIHWgCRpAF9Tmot6+tAEpmHYVFvX1oACy9SRUbDIwKAJkfHVuPrTEYKoBFAExkyvD9/Wot6n2oAlM4BxmoGOTkUAT+bu+XFRklRkUAPZgAfmHA9aiYqQG79x60AIzMTncfzppYA8nr29KAF3f7X60xjk5FAD/M287v1qLegba+Rn2oAl80OPb1qISDCr2AoAl80LwKi3r60AS+cf7v6VEZWUZB4oAc5YNkE4qP7QX+XPUelAD9/+1+tRkgdaAJNxPRv1qLzSPumpdwHOSTgnIpu8HljzS1A1vAoabxBCASx2tnv/Cad8PGU+LbcqwRW8wcnA+6asDBaPbeTgHP74jH40B0k1G5KMD++PT6n/ClLYcdy5AGMYyD14p1uwBGagsuWXDxk8EN+VEAJcMOla0tyHufQvwEm36xdqe9upqn+z5Pu8Qyqej2Kn8RXNik7FU/jR7BgbTx2oAJBA9K887SG+JEcBXORKOaNRVhbQ/PtxMD0zmnuhp2Z2XgLx3qHhfw+0llqstmC7tJHHMVDn14Ncf8A2fqWsXTRkFIkPBBwB+HeuecE90dEZWW53Wn/ALS/xPtNehn0LxLdvHFKoeGZyysuecg+1YGlaVaaZaMkEYJKnLt1olQhyGfM+bc+8/D2oPq2jWmqSR7Dc20chT+6SuTVL4ezNP4K0iU/xadEc/8AARXg1IqNRnpR+BG3RUDMvxdZDU/DWo6cRxNaSJ+aGr8kayJIjDIOQacFaopEVFzQsfjP42s3svFV9aOu0x3LqRj0bFdH+0ToyeH/AI0eJNJYEGHVZlAx/tmvvsLKNWgnHofOYhctWzPN9bxHZysT2P8AKo/FTeXYygHscflWk5IkzL2QH4aaQ/YX99/6MqO7BHwt0dT3vr5v/IlTB3JluZiTBjgjHNQCRd/zH5mqySd3facHtUQkdzt45pcyAdklQp7DrTWdUHzdaOZAODEdDUMtxHGN5kwP7oGTRzICwJWAxWfLrEMfzb1x9f8A61PcDRklGF+bvWauq2rEJJMCc8YNAbmlJKMBR165qkL+3JyJD074oK5WWxI6oWBqodSiB2eYuD6mgaVi2JnJDVWF5B2lA/GgZa81jwxYj0zVYXUZOPOH5VPKxcyLJncDjOB2zUBuY1B/eA54pNWE2mSlgq+YF3Env2qETqfuMAPekST+cqtyoJ7mqwdGc7ufenZsrmaJxOCdzxKxHQ4HFQGZOxos1qHMycXA3BpFX8FqEupLDd0PFPnfYOZk4uo8AFjx2GQDUGAV3Bx+VJu405MnWaAsSYhgniq29XULnJHUikO8i0ywMN5jGW9hxVdZUYhNxoHd9yVbPTpMiWzibI5JjH+FMZgoyjAmmnZhd9xr6BobZZtHtWHfMC/4U2SeT7u7iq5kF33Hw6Xoi7UTSLZQhJAECf8AxNMgds4zUvclyaZblm/gxt+XaB6AdAPQUzO0c80hczFX9RzQWXOE9KB8yFDFzvHGOMU0HAwPWgE7k4XOGMnTtioS7HvQMl81Dx1pooAcCvOFxx60wuEXJPfFAmriPIS3HFNLKxytBPKxshVfmK5P1pZFBQEigpbDMfMW9aZvbcR6UDBnySuOR096THzb+9AB2H60dyfU0AFD8JkUAMZ8jGKSgBYwQ3JzxQnX8KAH/n+AprOFODKV9gKAFZ9vQZpoeMHO4k+uKABXOMn8qY0hY5wPwagCTzPao1JPVscUAOdxnmoXdc/O2fTFJuwEhcZ4FRb/AO6eKLoB7M7HJYUzzo/8ijmQD/y/A0zzYx0/lRdMBxJ7Co5WDDepPApgSMwK7TxVdSSMk0m0gJRlSCBnAxTVZt33v0o5kBJnevp7VD5jCQgelHMgHF8HGKb1o5kA7zPamvwmRRzIDa+Hcw/4TG1Uc5ZwBnGODTPhrCr+OLKLG7LvyD7GmBiK8/8Abt0so4EhAOPRjTWaRPENzGW6zPkf8CNKWw47mnGMOBSxcqHPWoLLUDEHGajgdt3WtKfuu5LXU90/Z9nP/CVRqeN9j/QGqfwDmK+LdPAP+stmUcegrPE+9FsKbXtEj3pO49RQisC5PbpXlncQavxYr7P/ACo1cMbEHtuFXH4QOo8tzZQmFQoaMH9KaDIbSAqePLGKykBO0Sx23HPymnkb7bn0ofwl/aR9nfDDcfAGilxg/wBmxZH/AAGnfDaRZvAujyp0OmxY/wC+a+erfxGepH4EbtFZDEI4OBS1LdmI/Lb9vLQxo37TPiKNcATXQnIAx95Rz+ddr/wVH0VtO+OEeoxwgC90uKTcF5OCRya+zyipF4a1zwsZTSq3Pkzxb/x5yk9NvWrmp2YvYSBjdjjI46Yr0ZR5jlMjU7Aj4ReHpOh+23+76ebWnYSMnh+Dw5q+kpdQW00ktqwm2tGZOWHQ5Gcn8aIxUUTI4OeMFsow68YNdnc6V4ZC86FdJ/uzA/0qiTi3ZljBE3P0xXVXOgeFgCw0u9yP9panlQHJ75QuXOfStq7g8F2mTPb3649QpApNWGk2afw18Rjw94f8SX0ej2d1M6WscMt1DvaDLvkoCcZYcE9sVFoK+H73whrMmhXMzEXNssiyx7cA78Ug5WSDxrNcRlG8N6S2T3sAMfjmqH2YYYAdSSPzq1sLYsDWdOmQpc+DdMcnjKxFf61WEYQ5UcimNOzJ57zwm5CzeB7H32s3FVWh3ncw5+tA+YlkTwU+GXwREgBySs5+b/D6VF5DD7o/WgOYV7LwUHOPDkoHotwcU0RsTtA6UBzDf7O8EtN5n9lXqr2K3XH60rQ8ZXqe3pQSR/2P4Nk5SLU05/huFxTtkicuOPYUmrgN/sHwmwZUvtUXjqVVsU9Tzn2pcoETeHfDJkCQ+ItRjwOS1sDUoOCG8vgdTVLQCH/hGdIk5j8UTqP9q3qbbGvK9aHqBD/wilmzDy/F8Y5/jgNTbPO+Xbj8anlQEP8AwiTkkJ4us254DREVJ5KbiuDkGjlGnYiXwdfE5i8RadkfMcyEVN+6iQqI/mo5R8xXPgjxAynytT08nti6FWGSFB8iHHuaOUOYq/8ACGeLceZCLVx0OLpc5+lWFZQd2c+wY0cocxWPhDxsGytlE47hLhDVhpSrZUsvHXOaOVBzEK+EPGqoXGgTMT/dYGrtvcydfMc++4/40cpL1KA8PeMwoZvDl0SPTkVqPfzBAouZMd/3ho5QMiTSvE0Hzy+HrwEccRVsf23qg4g1OdRt4AejlAw2tteyd2k3aHG7a0Bzit5PEWtRAAatP8ww2WB4/KjlGnY59Li/3kSaZc57jyGFdEviTXscatJjtkD/AAo5R8xzY1WVnJkt5lHvCR/SupXxV4hQ/NeKw7kxj/CjlDmOU/ti1fKh2OOSMdK6hvEuqYA/ctzk5gU5/SjlDmOWGrwYzGwx9a6o+Iror81jZMT/AHrVTj2o5Q5jlTrNrjDyfrXTSavHIuX0SwLHqfsw5o5Q5jmG1GBk3l1GOuCK6H+1NPf5B4U0059ISKGrBzHOHUrYj5ZB+Jrfabw/NxN4Msj/AHuSKkOYwPtgOP3mM9OOtbUsHhIuN3hGAAHosrUDTuY32oHjfmtb7F4LYY/4Rl0/3Lo0DMj7QrfNuHHUVpz6N4InPy6Tegt1H2vigDM+1hedwGfatH+wPBG3akepIR2EwIoAz/OA6c5565q83hzwU/BvdShPZsqc0AZr3K5ySKvTeFvC8vEPiHUE9zCDQBn+fGp5Cirg8IaAUYx+L5wN2cPbg0AU2uAR8vP0qw3g/TGyE8Y8EfL5ltQBUMik8kD61YHg+JFyni23OehaIik1cCDzoiNjZGOpqU+E51YkeJrJx2yppcqAhMyg4KgfhT28I6wkZ8rWLJ27ZkIo5UBE9wgHUdalHhbxAIztvLIt6CWmlYCNX3Lk8fWiTw54pQZWOFhjkrcCmAvmKqHge2RUEmi+J4UMraYXGP4ZQc/Sk0mBJkryOtV4JZ1cx3SlHXGUbgjPtSa0AtB9z9O3WmCQk/IOfcVIEjMoAyQOahcsxy1AEjy4OMcdqhlZAvIOfrQBv/DB9njuykycFpOB2+U0vwo2T+P9PVWHzNKBn/catAOdv7hk8Q3DAcG5cA/jUGr7xr023oLuT/0KlLYcdzetjmMc9aZYElFJqCy1EQG5OPrSMpLcCmpdBPY9d+Bt0Y/FWjP6Ep9eDVH4M3Bj1rSJAcFboqPpRWX7pkQ0qo+mQhWRgeck5HpSnIlf65NeUd3MVdbAXTSwxw44pdY4sS+M/MOPxq4/CNO50tpubToSV/5Zin2P/IMtznPyE1lLcZO5UxkIR04ApY4lPzL+tEvgNWkpI+xPg+S3w00Nic/8S2Pk/jUfwSkMvwr0N2/6B6/zP+FfPVv4jPRg7wR1VFZFCM2OCKR+v4Ukr3uNHxT/AMFZPDaRz+GfEmw4khmt2fHcEMB+td9/wVA8NLq3wNtNXCEtp+qKQ3oGGP6V7uS14ufIeXjYR3PzrIVlZcUjblO09T1r6g8oYrbBtAodGIyooJluIyxvy3ftTGSTblYix74oJIbxVCHAPT1ovQ3lklW6d1oLsjkfFUbbHRW69zUniQkliR2/umoqNpGlNK474PQk+G/FEJBba1o4B9d7ipvgpIZIPFFoMZNhDJ0/uy//AGRrGlJylZjlpsWvJwANvQYqzJHKHIHrxXTsYN3KXlfMW29at+Ueh6jrQIqrAW4C1cjABOB2oApeSQCStXJYix+UDFAFFYOd+OvarojVUOeooApGAqMirjoCpAHNAFExM3Dc1aZCgyxA9KAKZtx2FXEXIJZfpQBSMOAV29atsi7jxQBT8r/Z/Wrfkv7UAU2hJGF4PrVzyiPvCgCoIsjbt5A61ZYANwO1AFIxc8rVvymPI6UAUxCwOev1q4EU9qAKghJ6qOnYVbVRgn3oAotHk/d/WrbRqDwKAIIFxxs/WrKIoGQKCklYrsq7TxU7QKVIA/WgbSKjKoHpVhYSvJUHPqaCCERDaCOcirSgMOVHHpQUkmVDCc8VaYYOBQOyK/lO3y8fnU20DlVGe3FAWRWMbKxGf0qyYWdQSKAsiqY8fdH1qyIHHQD86Asitsb0qeRJF6VLbuFkVgNvKjmp1tyGBI4+tK7YmlYqkSD7xzk1aaPc5QDpVWRJTIJ6p+tWjAwbGO1S1ZlR2KLqx3NjoasSRMAcDk0iiswkxyf0qy0asu319KAKuWUfKOfWrItVB+XP4jFAFUqJOZF5+tWJbcjBxQBW8sdjgVYNsQeB+tAFZ4yvzKen8OKlMUgGcCgCsyEuDngeoqdIXJ2npmgCBogyCM4wPVaneBgxAoAqtCgOAox/u1YNvk5L4oApGPAzgflVn7OfQfnQBWMIJ2uO2egqyYGPUD86AKptoyMdqsNEEOCP1oAt+CZo7DxhpkrcIL2PcpGVIzjkGk8P/wDIw2PA2/aow3/fYoA5n4lTzWnj26MKBRhdx7/QCqPxh8S+ILHx5fQ6Xo9ncqJST9oDAnNJ7ASWmou6fOrHj0rG07xx4kYGKX4f2zY6skpH86gDoS8jANgjIqnb+MNS2gS+BnH+5LVJJgX0C4y7/hiol8RRsoluPCl6uf7pzTsgOs+D1lFJ4+tZDjaglY/N/wBMyf61keF/H1roGpjVLbw5fI6qygleMkYNMDM1OLzNenSNgSLlzgdgTV7SVbU9Qm1MxuiOSQJFwQc5pS2C9i7ZQFI1DHoPSpztB+U5xxUDuwBzRS+0F2d18LrvyprCYHmO7Xv1yazfh9deXHGVP+ruFZfzFbSSdOzEtHc+wPlbBH8ajmobCXzrKCY/xwIwP1HNeRUSUrI76SUoXYzWEzpr5P3D+eKNXY/2dKPVSauySBaHT2QC6VbEt1j/AJioLOYPpdoueQgz+VYS3GtzRgZSOvaolURxjPU8US+A2nuj7A+BjK3wq0QKcgWQGfoxqv8As8S+d8INFcH/AJdyD/30a+fr/wARnfT+E7WisSwwD1FFAHkv7afhseJP2b/EdqEBMNss6ZXPKGu8+JegJ4m+H2s6FIoP2nTpkUEdTsOP1rpwc1TxMXtqY4hXpM/GvWdQstGsJtT1GcJFArPK57Dg/wCfrXJ/tZw6jo/hDVLCEEFbho5cHHAbBH6V9zSq/u7nzU7xnqeMfFH9onxv4v1N9O8KarJpWnhz5a2/Dso4yW6jNeZWjNDDJP8A3FbJ9qlyb1Zo/eehsH4u+NdLZfL8easvXJOpyMTjr1NcD8ONAu/ix8XoPB80ziyRXuL5kOP3SckZ7ZzWDvJ2Rsko7nfXPxH+PviXSZZfBXiLXZ2AOyWK6wpOOOX4r2Pw98Bf2kfj3qVz4B/ZW8LadBa6BIIdY1/ULYyW1owj8wxqMjlUKszsc/MuBzXNiMVRwq96ozqpU51NYQTPgn4w/Fv/AIKUfDiSTVtQ8a+IrexQkiWAW1yiLn+IiNscetfUPxf/AGfv23/hDp58Z+NfDcPjjwa1jJey+ItA03YrQRttldeT5pj7owBxyM15/wBeoVX7k3fzN5Ua8fiivkcX/wAEj/2z/jX8b/jJ4h+EnxU1uw1JH8HXN9Z3QslinPkyxhsshww+dT0HfitD9in4XeFvA37cfhv4w/D1IV0fxn4X1Owlji+4JZoEuI5ABwFYQMCOxx6124R1nUTvoc2JUeTzPswxox3K5I/2jzS7GwPlIyoOD9K9hu7PMIvKIO7OfX3qwUjKFlzxSArlDxgY59KkoAY7EKAE5+lPoAjki3Lkd+1SUARYVuMineUoJ29RQOzI5IEYfMQee9SbB/H0oCzItmOOtSYUcLQFmQNDlic1KyknIFAiLB9DUhUjkigCFwcdD1qR+n40AQbSeq/pUlAELBgcAGptkZ5brQBAoOeRUjKVODQAm0dl/SlUgZz6UARuoJ4X9KcoIzn1oAZtPpUlBaasMAIbBH509+XyKAuiJlJc5XjtkVIwJxj1oC6GbdvG3H4U6UgkY9KAuhu3PO39KcrADBNAXQ3ywOcg0UBdAM9BSqQDzSdxiYPTFOI3NuHTFTqA2QAxjIocHbt71S2AibZj5d2aWmAkQ+YkjtTlIGc+lAEZBLHApyAgkmpe4EMwJXAFSFWJPFKzAiCkchf0qQ8HBoswGHd3zTz0I9qLMCFwSelSMpIGB0FFmBFhvQ1Jsb0pAQNGuOGB9s0/ylHK9aAIhGT0GPepdjelAERhJ5J/WpdjelAEJjUHBUH8Km8pTy3WgCBkQjGAPfFTSRRqMGgCs0eB8pz9Km2IOUoArGPP3k/MVMwLHigA0dQus2hC4xcqScf7QpbRljv4XHaZS34UAcV8UU8r4iXjMcfvhkHvU3xfRf8AhP76UHgvkZoAz9OZGnOEAJYnp2zUVmxS4Bz0Qd/WgDpYJI1Cq6nJHUCo7Zt4XBBKjlQeal7gXllQADAPuagByNwHFTzLuOzLouB0HrmoFIGGOcH/AGTV80RE/nljkjJqNJEByWwPVuP50vi2E2kSBs8gYpN6k4U5+gqXoNajsn1NNDqe9TdcwWZ0Hg248pnhH8JBzVfwo7ieRSBypNdGnKTN+6fYvhO5+2eF7C567rVOfwqh8Lbo3Pw80ycngW4WvKxCfOduGb5TY1Yf8Sqc4/hGPzpNQkRtNlz0/rUx0jqao2dGBaxts8/KKXQTnTIWP/PMZrJoDRJJ5UjPbNMHqT2NQ0+UqfxH1p+zWQfg9pQz0Eg+n7xuKZ+zKyv8H9OZTx5k3/ow14mJ/is9Gl8J39Fc5qFFADJ0WSFo3GQy4IpzjKEYoba1RMlzRsfjT+3Z4EbT/F/jTwv5JVor+Z0Qr0XcWH55r7c/bp/YY8RfGDxBL8Q/htZR3FzdW3l6lYGQKZGA4YZ6nHH419RhMwpSoKEnZni4nCzcrpXPw1/syQwXNu6dmyB29q+25/8Agjx+1n4h8TzQaL8PXtYJH+ae/uI44x+OST+VelUxOG5F76+8wjSqKXws+M/2TvC0WlfFO/1C4Rg02nskeRwRuUsPyXH41+h3w7/4IW/tM+Hb0alL4y8LWkhIb555JcEduFFcax2Fg9ZG06FWa0RL8Gvih8X/AIY/svz2Pgrwfaf8I7L4ou4dR1nTS5mG9VmJvAMkh0fYGXn93jNafxT/AGWv22P2K7e6134V6+s9jqlsINSmsNNN9ZSLz8lzbOVyBk4dSuM9e1eVjsPSxbvTmj0cDivq6tOD+46zSvju/jX4QXUV98II7fwHd6bO13bafau32O1WIrLdLKwACtyRnGMnlq+XfG/xT/4KAfG34MN+yH4Z03R9J0G+gNjqY8E+G7j7fe2zEloQ7Mwg3ZIO0E4OAR1HHDLZ0rPmX3m9bGQq6KLPCfgKvwR0743aQ/wBuJ5/Ap8WtD4UkvZN0jW0jeWp3fxZeRgvqrDHGK+5f2WP+CJnxA8DfDK28QeJfDujW2s24tj4b8P3Vywi0lY2Vg8hXd+8AA2qCcEc17WGxFCjHllJHnVqNWaukeNXUbRXMkbkkhznIwf/AK1afjvQ7zw5401TRdQXEtrqEsUo/wBoOQewr2qclKCaPLmnGVmY+dqFaaWJ4JqyRKKACigAooAQnBLetDEBcnpQXzIazbhjFIWQ/doC6FAHc0x+v4UBzIVnwcYplBL1YryfKeKjLE8E0CBm3DGKSgAooAKazEHANACzfepju2Dv69qACmb29aAHM204xTCSetAEgORmmBiOAaAH0jHAyKABjtGcU0sT1NAAx3HOKY7EHg0AOpm9vWgB9M3t60APpm9vWgqO5IrbRjFR729aChzyfMeKbvT+LrQAlBIUZNABTPNB4U0AOZtpximEk9aTdgJAcjNMDEcA0cyACN7g9KQEg5FMBWXaM5oLE9TSbsAlFHMgCmsxBwDUvVgNAzRSAByM+9HTigBVXcM5oDEdDQAEYOKQkk5NACTDeM9KH+6aAI1j689qUEjpQBHjaSM96ftU9qAIVPl3Cv1w2cUs4CncOooA4f463ZtPHckrKQsyBuD0yKT9pK33a7aXY432gBIOPpQBkSapY6T4eHibVJilrFF8xHWQjsK8o8aeJ9Rl8Ow+GpJ28uKZmwe+aV0BF43+O3xG1hn/AOEavI9MtP8All5UQL49Sx/wrzz4m+MLXwtoAAX52GBzWFWbjsaU4KRNq37Qfxn0FMx/EeZSFJw0SN/Tim/stfBCP4zzy/Ej4hQ+bocEzx2lhM+EuZV6u/rGuGyDxXOlOo9Dobp09zkU/br/AGrPtLw+ErU6wqn7yaC0gx9V/pX0DP8AG65tpHsvgH8FrvxHpFpM0Ems2hFpYSSoxR44CFLT7WGC6jaCQBnBFROuqe9UuFOVTaJ8/R/8FKP2qdKkWLWPA+ikjrHLYSQyfjnmvrTxZ8EPFHi34e6Z4j/aP/Z4vfDFjrl0bXS77UxFuefaSIwfleOQrkqHRQwBIojVVTapcJwdP4ongHgD/gqhr93qcVp48+GcDwE/vDYXLpMP90ScN9MivPP2lP2Xrr4b6lItpGskUkReyuFXiRRnKn0YdCPUVcp1aavuSqVKfkfcvwn+Ovw7+NGkNqvgjWxO8YH2i1lG2aE/7S9R9a/Nz4TfFHxj8Mdes/Gnhu8eC+s5ds6AkCWNeqsOhzRDERlqyZ4drbY/WXwrcEXgX+8oHWuU+AvxI0f4o+FNK8daO2Ib2BWePP3HHDL+DZrupzUmrHDVg4ps+1vgnem4+FVqwOTDK6Nz71n/ALNMw1L4e39gDkw3DHHpkZrjxMXznZhpLlO0kfdps+eQF4qK1kD6RKz8grXPJWZsnc3vDsrPpMXb5Kb4Xw2jQsPp+GakZrSsApVTklCaseGfD2r+K9bi0bQ7Rpp5m8uNNp+hJ9BUOSUdTVwc3ofU37LbE/BzT+cjzpv/AEYa3Pg94Il+HXgSz8J3F2J5YQzTOFwN7NkgewJrwcTOMquh3UtFY6iisDUKKAA8jFFADXUcYX9KdSsG2xGqADCr+QqSiwb7jDuIwR+lPo5UO5EUVs5TORg5GeKlpqy2Fq9ynbaNpdnO1xZaZBDIxyzxQKrH6kCrlVzyas2Llj0ItgRsEZPUGnv1/Cs1Gz3KburH5O/t1eGI/CX7UXivTYUKxyXaXEY24/1ig/416R/wVj8L/wBlftAWHiJYxs1XQEZsD7zRsyk/XGK+0yetGvQUH0Pn8ZScaspHyueDg0jSKzBh0r0lq2cSaaFyB1NMd1x1oAfkHoai80j7poAc021iMVEzgtknmgCR5CVI2/pUXmseG6VXKAu/ZzTHdcdaTVgHGde4FQuQTxSAkaQE5DfrUBlRTg0ASsRjg1EzjHynmgB24jq361Huc/eoAk3E9G/WomkKdDQBKSM8mqzTPuPNAEpbPVv1qJyQpI60ASb1Xk4qAF2+9QBK84zwKh3L60AS+Znndj8ai3r60AWGmyuMVX85/agCXeV5NQPM+OtAErz89O1QeZn7xoAl84/3f0qLzWHC9KAJd3+1+tRGQKMg0FcqJTJs5JqBpt4wT+lA0rE/ng9BVbzSPumgZYM655AqAEsMmgCTeTxvz+NRFwOVPNAEucd8VEJGc4NAEu//AGv1qIsB1NTLcCXcf7361F5rDhelSBMswJwagEqE4FVzAWHdccMPzqDevrSbuBLv/wBr9agd2z8lICfzQOMZ96r75fQUASq+DnOfbNRElRkUAWPMDcYAqukxz89AErsAeG/WomkUnINAEnnY461FvX1oAl3f7X61FvX1oAlyPUVEGB6GgBzsAeG/WmP1/CgBJ2G37361HN92gDm/j7YG8t9NuupaDFdXrfhObxfpNtb20RLRJ6ZO0+lJ7AfKXi/SZPOyAc55yPevbfFn7P8A4iZMQaY7N2+XNZ80R8rPjT48+G9Q1FIoYY2IBPK9OlfRnxC+DB8sQ3VpmROXXZyDjpiuas/fTNoNxg1Y5SHTbzwt+wDqTaA5tb+HwLPJ5sYyySNkO/1B3EgV6Z8OIdEtvDa+Ar3R7maOe0khvYJrN/JlhbO5ckY71p8S00FFSTuz7q/YP+Fuofs//C74dfD/AE34W+HbPwne6PY2ek+Kmmikuo5Hhy0hRioAJwxwR/F6ivnT4Q/tf2/wW/Ztsf2ffjZoWu6/Z+Gr1YPB/ivSdON5JZaXvDqk0KkytLFjGVB8wKvfIr5bHYGqpe4rn0OExFJx992Prb4w/saeH/2ltEvfh/8AE34tf8JDpGh6PqV75keoPFPaamkZe3vkQkjaChUA9A2Qa+UfjL+1H4R8a/DF/Av7KviTxVeaprmnrpnifx/rekXOkxWmnkAukNrcBZGndcoH27VBYk5wDGFweMclZWKrYrDRu9z5q+PdnF8QfgrpPii6sYxcSrBKWXldzqQxHscZrd+P3wn1bxf8KrP4beG9Tk0u3n8uKea2/wCPiO0UbWCY+4zDgN2619Q7wocsrXPCv7Srpoj4Z1Xw5YJYS3mkN5yyXD5ePp8vH0PNe5+NPg3pfhrw8mjaNpS2trYxCOBAp6LxyT1PqfXNcajyq90dDerikei/8E1tfuJPAd7oM1xujsNUYxqT0DgH8BnP41kfsFuuh+INb0WdwpkKOvoWHWvQw0m2noefXjq0fp1+yZqYSLVdKPdEcj8CP61zP7L2uRxeKp7VZP8Aj5tCFA/iYYqsRTm/eYqNRRdrHrtvIBbzW+/jcQBn36V1fw4+C/jz4p6lNYeENMZlXDSXMh2xIfc+tedUrUVuzvVOf2US/Dvw9rXiaex0DQLV7i4mz5cMQ9OpJ7Cvrb9n34C2Xwd8NxrdtHc6tMv+lXSjIUdlTPQD9a4KuPjHSOp0Qw7e5b+C3wX0j4W6QskiC41WdP8AS7sj/wAdXPYfrXeKpByRXl1K1WruzrVOKEjGG27cYHHFPrOyL0sFFABRQAUUAFFABRQAUUAFFABRQAjLuOc0tAHxX/wWD8Ii48M+E/GcMOXt7ya0dx3DqGA/MH869T/4KV+DB4s/Zc1e8jt98ukXEV6h7qqthsfga9jJ63JX5e55+OinA/LhzsOOtJMctkV9jeCWnU8LlimNeTjp3qGSRtxXPepshj/M9qhaXavJ5qWrMCRnGear+bG3zN1pATOw2nBqv5ye9O7AeHxyxqKSZMdTRdsB7SBzkHFVmkjU8Z5pATMyg8tUBkiJyc0ASM2Bnf8ApUHnJ70ASiY9zUEkoIwp70ASyS5wN1V96/x9aALHnDvVRpUBxzQBZaX5T836VVMsZ4OaAJxNj+Kq5ZD92gaVyZnOeGqAyiPgmgqyJTKQcFv0qAyRk5OaAsicynsarmWNRkUBZEzzEjk1XadGGGJ/KgLInEhPQ1As6KMKT+VS20wsiYysDiqzXI3Hn9KV2FkWRMc81VNwp4JP5UXYy08oYYX1qqJ0HQn8qLsC0koUYb1qqZ0PUn8qLsC0ZRng1V85Pei7AtiYE4AqsZY1+YdRRdgWWkwPSqrXQcYJ/Si7AtCYdzVTzk96V7gWWbJzv/Sq3nJ70AWSw7N+lVllQnHNAFlZNpznNQNLGoyuaAJnmyfTiqzSxsctmgCyGyM7/wBKrCWMcDNAFndjndn2xUIIU5NAE3me1QvOgHBP5UAThx3qBZY2GWzQBPvX1qs0qA45oAseZ7VB9pHqfyoAn359qrmbcMA/pQBOZAvBOarEk9aAJpJlb5arM8YbB60Aej/Bl4bjVY7WdQVaB1wfUAGsz4PX6QeIrUE9ZSrfUjB/lUVPgZUPiPWzpdlGP9QNxOM47fjVmdl37m9TiuI2uZuoeHtFY+amk2wZuWfyFyT9cVauLkEBM85oauXF6FODS7dIZIEhTYxG5DGCCKvQMmMMOvWmm0O5wniP9nrwNr1y93amewnY/ObUjYfbaf8AGu/URmPeB8xpe0kJpM4bwn+zj4G0y8S/1WW51J4jlIrhwsYx0+Vev416DprBSc9KlybTJkkj6q/4Jv8AgLwNf+D/ABRFqHg7TLgjVYG/0mwjkIUxYwCRkD5RWl/wTVuQ+k+KoAeFu7ZiPbY4rwsc2pbno4fU9n139lz9nXxVCY/EfwS8LXm4fMZdDhOff7td6o2jFefzSa1Z2pJHzB8Zf+CR37FvxF0a7uPBvwj0nwf4hkiC2viDw/ZCKWMjoGUcOn+ya+oCAeCK0p161J3iyJUqc90fEvwD/wCCSR+G3i+PWfH3xVTVbOA8WmnWbRGUDgbixIXjrjNfbAjQZwo574rplmOMnHlctPkSsPRTukZ/hzwpoPhTSYdE8O6dFa2sChUjiTGeOpx1NaXSuJtt3ZstNgAwMUVNkwCimAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAcv8YfB0Pj74aa/wCDbmHzF1LSZoFUj+Io239cV0suG+X0ohUdKspIzq0/awsz8OtRilsbmeyuY2WWGTy3BGMEfyNdt+114Uk8AftH+L/DbQeXEusyy26BcAJIdy/hiv0ChUWIoxkj52vT9lU5UecNKUkJJ/Oq005Y4U/nXQZWZNPOCOPSqUlyQclhQFmS/aCOKqPd4+bcKLoVmWmnwvSs975vu7ufrWYFyS5IHJ71nPf54LUAXvtIPU1ly6gFIw3agDRa5+brWWb1ichv1oujRbGl9oX2rMF8WONwpN6AaTXII+U/lWcbsjowqAL5uPWs83v95hQBdafLdKo/bR/eH5UXYF3z/aqX20f3qd2Bd+0gHrWeboK2d3FF2BfNwp+8R+NZzXYJyGFF2Bea4XPGKofav9sUXYFv7TnjNUTcMBkEUXYF4z8H6VQ+1serCi7AvC4GByOlUftX+2KVwL3nr6CqP2r/AGxRdAXWnXB4FUWucjG4UAW/tA9qpee394UAXftA9qpee394UAXvP9qpC8CjBYUAXftOeM1RW5OfvD8qAL3n+1VPtX+2KLoC6s645AqmLgnowougLbTjPAqp57f3hRdAWvP9qq/aG9R+VF0Ba84twTVRrkqMkii6At+bt461T+2e/wClF0Bc8/2qoLkkZz+lF0Bf+0+9UfPb1FF0Bd+0KeuKpec/tRdAXftCjpiqXnP7VLeoF3z19BVI3DA4JH5VN2BcadccAVT+0H1H5U7sC15xPQ4qoLknkEflSuwLf2kn1qp9pPqPyp3YFozrnkCqbTuTkGqT0A6r4d6mbbWIZsEbZlP64rG8N3zw34ZW4ABH4HND1Q4uzPpC4uScsDnNY8GpmXT4LnfkSwq2ffHNYtNG10y1NPtfk/nWdLfK55fkGlox3satvdf7X61mR3ihiS/BXFAXNwXSYwGH51kDUR8oAHB7GsGncLs6G0nA6VlWl+xIbPH8qcU29Av3Psf/AIJk3Ikj8YQE5bfakc89JKzf+CWl4JtX8YRlukdsT7ctXiZonyndhLuR9jKcqD7UL90fSvGimlqem9xaKoQUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFADSoyWJpxAPapkm1oO/Q/N3/AIK+fCvUNG+LWmfE+w0uQWes6aIbq4RCVE8R6MQOCQePXFfod4s8F+FPHGkPoXi/QLXUrN8bra8iDoT64PevWwOZ1MLG0tjgxGDVZ3R+D13frEfmJU45HcV+u3jf/gmZ+xp46aSbUPhJDZvLktJpl1JDz64Bx+lep/btLszj/syfc/HafxDbLkGZfwev0n8af8EKf2X9e3Hw7498X6QzN8u29jmUD0w6E1SzrDyWt0XHLqiW6PzMn8SW5HE/HbmvvTXv+De3wfMpbw7+0jrcPHyi70+NwD/wHFP+2MN3Y/qFTuj4Bl8Rwbx++7+tfZ+tf8G8vj0MW0H9pe2fjj7TphH8jVf2thu5i8DV7Hxa+vxHnz/yNfVGsf8ABv1+09aFm0b44+HroA/KJLaRD/Oms1w76h9Rrdj5TbxBDn5pP1FfROqf8EKv25LLcLDxL4Yuwo+ULcupP50/7Tw/cPqNbsfOv9vRHpKa9o1D/gjH/wAFEdOXbD4a0S6x/wA8dUAz+YrRZhhWviJeDrJ7HjA1yNjgEivSb7/glF/wUZ0+UoPgyk3o0OpIRVfXsL/ML6pX7Hmx1oAcSn8TXZ6n/wAE2v8AgohoiGW4/Z51CUA4PkXUb0/ruG/mF9WrdjjU1gMMls/jVvUf2RP23dHLfb/2bPEyhfvGO03fyNNYzDP7Qnh6y6FX+1196y9S+D37TOhZOsfAPxZHjqP7KkOPyo+t4f8AmF9XrdjWXVFZd24/lXHXVl8U9IU/2r8M/ENuB183Sphj/wAdq/rFH+YXsavY699UXHLYrgp/E+v2nN54d1GIZ/5a2Uo/mBTVei/tC9jV7Hd/2pH/AM9BXnx+IdrGP35KY6h0YH9aftqX8yH7Gr2PQv7Uj/vn8BXnq/ErSDy2oKo/3h/jT9pTfUTpTXQ9BOqIRjzBXAr8Q9NdcreRn6HH86PaQfUTpzXQ7z+0U/56iuHXx3YOBi4QZ7lxVc0O6J5ZdjuP7RT/AJ6iuNXxjZP926Tp61LcXsylTm+h2X9op/z1FcfF4ts3+9dJ+dK6H7OfY7D+0U/56iuP/wCErgP3bhCfrWl0RyyOw/tFP+eorj18UITzIv50XQ+VnYf2in/PUVykXiKBxkyqOfWi6DlOpN8hOfOFcx/b9v8A89l/OlcVjqv7RjPAYVzMOuQE581c9vmo3E9DphejvJj8K51tcjI5lX8DU2YuZHSDUAvR81zaa0uPlcHn1osxqzOmF/kZ3fpXOrriBeX/AFo5WB0Zv17Gud/tsd2H50WYHQm9B6t+lc8NbDfcfP1NDTQzoPta+v6VgrrAx87flS17BY3xfKBjNYKasWOOMeuadn2EdCt3g53/AKVhR6ujDLNRZhZm/wDb1rC/taL1NILM3ft61h/2op+6aANo3ik5zWMNSix8zHNAG39pVed36VjHU42GA5oA1xdqBjd3rH+3r/e/WgaVzZW5Vhnd+lY39o46NigOVmw13g4rKF8pGS1AcrN3Rbwx3oBbORtrGttV8mdZFb+IZprcUlZHvnhvXfN8NWpaTJVdvXpiuP8ACGsxnSHiV+FfIH1pTKhJHaS6spORLj2zXK3GrJkDecEZrFM0dmdMNdAGPM/WuQudZEA3buOBy2M56Y6kn6VWnUVtTtI/EUSne7DjsDXsv7In/BOL4n/tALb+N/ibJdeGPCzENGGj23d8v+yrf6tSOMnmuWvi6FBaSTOmNCpPY4b4P+AfiP8AHLxUvg/4X+F59SuN4M82MRWy93kc8IB78nsDX6q/Cb4K/DT4LeFYfBnw28L22m2MQ+YQjLzMP43bq7e5ryauc1XpCJ108FZ3mcf+yZ+y1ov7NvhWaJtXbUNZ1JEOq3Z4jJGSFQegJPJ6164sSr3J+prza1erXd5s7IU4Q2FXhQCc8daUADgVglYsKKYBRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAJwOcfpS0rJgJhf7v6UtFkA3jp5f6U6nZBqNOD/CR+FOoDUZtHofyp9MNRuNvAT9KdSAavX7mPfFOpWAQqrdVB+opaXKgEb/dzS00kgIJrS3uP9fao/syA1PVLQdzOuvC3hq+BW98P2kuevm2yt/MVo0c0u4jmbz4PfC3UMi7+H2jybvvb9PTn9K6ampzXUDzfWP2SP2btdVl1X4N6FLu6n+z0/wr0in7SfcDw7V/+Cc37GetKRd/AXROTzi0Fe40e1qraRLhBu7R8z6t/wAEjf2CdXJ874C6YmR1RMV9MU1Wrp/EL2cOx8g6p/wRF/YF1FmaP4W/Z89PIuGTH5Gvr6q+sVu4+Sn2PhzUv+CB/wCxJfEmy0zV7bPQx6g/H4Zr7jqlisRHaQnTg+h+fWr/APBvL+ypdAnTfF3iK1JPUXeRX6C0/rmJ/mD2cOx+a2qf8G5Pwekz/Y3xm1+E44MhU1+lNX9fxX8xPsafY/LDVf8Ag3EhDH+xv2htQQdhNaKwr9T6Pr+J/mD2FJ7o/I7Vf+Dc34qQIw0L9ou3b0E2n9f1r9caPr2J7i+r0ex+Nmo/8G8/7UtoD/Zvxl0Wf0L2zDP61+ydUsxxSVuYTw1Bu9j8UtT/AOCA/wC23p8fnaX448NXB/uFnXP49q/a0gMMGqWZYpPVi+q0Ox+FOr/8EVf+CheiZaDQ9FvADjMV+Rn8xX7pmID7v41X9qYgX1Sh2PwF1T/glT/wUV0liT8IIp1UcmLUBk/pX79GGMjBQHPqBT/tTECeDo9j+enUP+CfP/BQDRstc/s+anIP+mUyN/Wv6FDaQFQGjU46AgUf2pXF9Ton86Gqfshftt6JELjUv2dPEKr/ABeXbbsfka/osk020mTbLaxtjodgq/7XxHYPqdE/mxvPhN+0jpEjJqnwO8SRleudNkOPyFf0izeF9Cn/ANfo9s+eu6IGqWb1r6oUsFRaP5prnS/ilphI1H4b65FjqH02Qf0r+k24+Gvga7Ui68Jac+eoazQ/zFV/bFTsR/Z9E/mkl8Q63ZORe+Hb+HnnzbR1x+Yr+ki9+Afwd1Ik33w20d89c2Sf/E1X9tSWjQfUKfRn82v/AAnkcSkTRTJ/vRkV/Rdqf7Hf7M+rHN98F9Ak9d2nJ/QU1nbvqgeAh3P51E+INhgB7hhz34r+gnVf+CdX7GerhjefALQGLfeIsVrT+2odifqKP5/V8d6e5wtwD9a/dvVf+CSv7BerKyXPwC0lC3eKLbTWcQfQh5fzbM/ClPG1kRj7UAe4yOK/a/U/+CJX7AWoEmP4TLBn/nhcup/Rqf8AbFPsL+zn/MfimvjG1LAfaO/rX7Dav/wQK/Ya1AFrXQtTtTjgw6nJxVf2xhuxP9nT7n4+jxbaucNP09TX6vap/wAG8X7KN2D/AGZ4u8SWuegTUGIH50/7Yw3Uf9n1F1Pyli8SWzMMS/8Aj1fpvqv/AAbk/BpwTpHxo8QQN/CJFQij+2MKL6jUPzPHiKM8LIP++q/RDUv+DcuxUbdI/aCu8A8CayBxWizTDNXF9RrH54ReIFxkyDj1Nfe13/wbs/ECKQnTPj9auO3n2JJ/Q1Uc0w19WTLA1nE+UvAevrNaeUZAcpz9a+2vhL/wQR8S+Htchn8e/HNPsSSZmGnWX71l7hSxwCemampmuE6MIYCsfLnw5+HHxK+NXi+LwP8ACzwhc6vqEmBshX93EpON8jnhF9+9fs58Cf2d/hN+zz4Vj8KfCzwhBp8agCe6+/PcsB96SQ/MxPvXBUzdrSmtDqp4BJe+eA/sdf8ABLjwJ8FJLT4g/GUweJvFKLuiieINZ2Lf7KkfOw/vEfhX1ygKrg15lXF4ir9qx1Rw9GPQZHGiYVYwABgADoKkrA2tHogwPSikAUUAFFABRQAUUAFIWA6mgBaAQeRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUAFFABRQAUUABB7GigBAD3NLQAUUrIBCCehpaYCbT/e/SloFYb5fvTqBiKu05zS0PUBGXcc5paAsN8v3p1ACbKWgBpTd/FTqdwTsIiBBgGlpXuF7hRQAUUAFFABRQAUUAFFABRQAjLuOc0tAABgYooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooAKKACigAooA//9k='
 };
@@ -0,0 +1,157 @@
+#include "ds18b20.h"
+#include "eeprom_log.h"
+#include "eeprom_ram.h"
+#include "hal_uart.h"
+#include "host.h"
+#include "load_profile.h"
+#include "mercury.h"
+#include "mercury200.h"
+#include "mercury_emu.h"
+#include "report_phase.h"
+#include "zcl_app.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Host timings of the per-poll paths, ns per call. They don't predict CC2530 cycles,
+// but show how a change moves the cost relative to the other paths.
+// The fault profiles run the poll cycle against the emulated meter and print the share
+// of requests that made it to a report and the request timings in virtual us.
+// bench [iterations]
+
+typedef void (*benchCase_t)(uint32 i);
+
+typedef struct {
+    char const *Name;
+    uint8 Faults;
+} benchProfile_t;
+
+static mercuryEmu_t bench_Meter;
+static uint8 bench_Cv[MERCURY_EMU_CV_LENGTH];
+static uint8 bench_Energy[MERCURY_EMU_ENERGY_LENGTH];
+static reportPhase_t bench_Phase = {.Period = 30000, .Jitter = 10};
+static uint8 bench_Payload[EEPROM_LOG_PAYLOAD_SIZE];
+static volatile uint32 bench_Sink;
+
+static uint64_t bench_Nanos(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void bench_Run(char const *name, benchCase_t run, uint32 iterations) {
+    uint64_t start = bench_Nanos();
+    for (uint32 i = 0; i < iterations; i++) {
+        run(i);
+    }
+    uint64_t elapsed = bench_Nanos() - start;
+    printf("%-28s %10.1f ns\n", name, (double)elapsed / iterations);
+}
+
+static void bench_Request(uint32 i) {
+    mercury200_dev.RequestMeasure(11111111 + i, 0x63);
+    hostUart_ClearSent(MERCURY_PORT);
+}
+
+static void bench_CurrentValues(uint32 i) {
+    hostUart_Feed(MERCURY_PORT, bench_Cv, sizeof(bench_Cv));
+    bench_Sink += mercury200_dev.ReadCurrentValues().Voltage;
+}
+
+static void bench_ReadEnergy(uint32 i) {
+    hostUart_Feed(MERCURY_PORT, bench_Energy, sizeof(bench_Energy));
+    bench_Sink += mercury200_dev.ReadEnergy().Energy_T1;
+}
+
+static void bench_Ds18b20(uint32 i) { bench_Sink += ds18b20_convertTemperature(i & 0xFF, (i >> 8) & 0x07, DS18B20_TEMP_10_BIT); }
+
+static void bench_ReportPhase(uint32 i) { bench_Sink += zclReportPhase_Next(&bench_Phase, i * 30000, (uint16)i); }
+
+static void bench_ProfilePush(uint32 i) { zclLoadProfile_Push((i + 1) * LOAD_PROFILE_INTERVAL_SEC, i); }
+
+static void bench_ProfileRead(uint32 i) {
+    uint8 buf[20 * 3];
+    uint32 endTime;
+    bench_Sink += zclLoadProfile_Read(0, 20, &endTime, buf);
+}
+
+static void bench_EepromAppend(uint32 i) { zclEepromLog_Append(i, bench_Payload); }
+
+// whole zcl_app cycle in virtual time: phases, decode, reports
+static void bench_PollCycle(uint32 i) {
+    uint8 mask = 0;
+    hostZcl_Command(FIRST_ENDPOINT, MERCURY_POLL, COMMAND_MERCURY_POLL_NOW, &mask, 1);
+    hostOsal_Run(3000);
+}
+
+// 50 ms meter latency on a 9600 baud line, every fifth reply broken the profile's way
+static void bench_Faults(benchProfile_t const *profile, uint32 cycles) {
+    bench_Meter.Latency = 50;
+    bench_Meter.Baud = 9600;
+    bench_Meter.Faults = profile->Faults;
+    bench_Meter.FaultPercent = 20;
+    memset(&bench_Meter.Stats, 0, sizeof(bench_Meter.Stats));
+    memset(&zclApp_LatencyCurrentValues, 0, sizeof(zclApp_LatencyCurrentValues));
+    memset(&zclApp_LatencyEnergy, 0, sizeof(zclApp_LatencyEnergy));
+
+    for (uint32 i = 0; i < cycles; i++) {
+        bench_PollCycle(i);
+    }
+    uint32 reported = zclApp_LatencyCurrentValues.Total.Count + zclApp_LatencyEnergy.Total.Count;
+    printf("%-28s %5.1f %% reported, cv frame %6u us, cv total max %6u us\n", profile->Name,
+           bench_Meter.Stats.Requests ? 100.0 * reported / bench_Meter.Stats.Requests : 0.0,
+           (unsigned)zclApp_LatencyCurrentValues.Frame, (unsigned)zclApp_LatencyCurrentValues.Total.Max);
+}
+
+int main(int argc, char **argv) {
+    uint32 iterations = argc > 1 ? (uint32)strtoul(argv[1], NULL, 10) : 100000;
+    benchProfile_t const profiles[] = {
+        {"faults none", 0},
+        {"faults crc", MERCURY_EMU_FAULT_CRC},
+        {"faults drop", MERCURY_EMU_FAULT_DROP},
+        {"faults partial", MERCURY_EMU_FAULT_PARTIAL},
+        {"faults late", MERCURY_EMU_FAULT_LATE},
+        {"faults silent", MERCURY_EMU_FAULT_SILENT},
+        {"faults all",
+         MERCURY_EMU_FAULT_CRC | MERCURY_EMU_FAULT_DROP | MERCURY_EMU_FAULT_PARTIAL | MERCURY_EMU_FAULT_LATE | MERCURY_EMU_FAULT_SILENT},
+    };
+
+    if (iterations == 0) {
+        iterations = 1;
+    }
+    mercuryEmu_Init(&bench_Meter, 11111111);
+    mercuryEmu_Reply(&bench_Meter, MERCURY_EMU_CMD_CURRENT_VALUES, bench_Cv);
+    mercuryEmu_Reply(&bench_Meter, MERCURY_EMU_CMD_ENERGY, bench_Energy);
+
+    hostOsal_Reset();
+    hostNv_Reset();
+    hostUart_Reset();
+    hostZcl_Reset();
+    eepromRam_Reset();
+
+    bench_Run("mercury request", bench_Request, iterations);
+    bench_Run("mercury current values", bench_CurrentValues, iterations);
+    bench_Run("mercury energy", bench_ReadEnergy, iterations);
+    bench_Run("ds18b20 convert", bench_Ds18b20, iterations);
+    bench_Run("report phase next", bench_ReportPhase, iterations);
+
+    zclLoadProfile_Init();
+    bench_Run("load profile push", bench_ProfilePush, iterations);
+    bench_Run("load profile read 20", bench_ProfileRead, iterations);
+
+    zclEepromLog_Init(&eepromRam_dev);
+    bench_Run("eeprom log append", bench_EepromAppend, iterations);
+
+    hostNv_Reset();
+    mercuryEmuHost_Attach(&bench_Meter, MERCURY_PORT);
+    zclApp_Init(hostOsal_AddTask(zclApp_event_loop));
+    hostOsal_Run(3000);
+    bench_Run("zcl_app poll cycle", bench_PollCycle, iterations / 100 + 1);
+
+    for (uint8 i = 0; i < sizeof(profiles) / sizeof(profiles[0]); i++) {
+        bench_Faults(&profiles[i], iterations / 1000 + 20);
+    }
+
+    return bench_Sink == 0xFFFFFFFF;
+}
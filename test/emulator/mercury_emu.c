@@ -0,0 +1,216 @@
+#include "mercury_emu.h"
+#include <string.h>
+
+static void mercuryEmu_Handle(mercuryEmu_t *emu, mercuryEmuReply_t *reply, bool *answered);
+static uint8 mercuryEmu_PickFault(mercuryEmu_t *emu);
+static void mercuryEmu_ApplyFault(mercuryEmu_t *emu, mercuryEmuReply_t *reply);
+static uint32 mercuryEmu_Random(mercuryEmu_t *emu, uint32 range);
+static uint32 mercuryEmu_LineTime(mercuryEmu_t const *emu, uint8 len);
+static void mercuryEmu_Header(uint8 *buf, uint32 address, uint8 cmd);
+static void mercuryEmu_Bcd(uint8 *buf, uint32 value, uint8 bytes);
+static void mercuryEmu_Seal(uint8 *buf, uint8 len);
+
+void mercuryEmu_Init(mercuryEmu_t *emu, uint32 address) {
+    memset(emu, 0, sizeof(*emu));
+    emu->Address = address;
+    emu->Serial = address;
+    emu->Voltage = 2305;
+    emu->Current = 123;
+    emu->Power = 2835;
+    emu->Tiers[0] = 1234567;
+    emu->Tiers[1] = 7654321;
+    emu->Clock = (mercuryEmuClock_t){.Weekday = 1, .Hours = 12, .Day = 1, .Month = 1, .Year = 24};
+    emu->DropCount = 1;
+    emu->PartialLength = MERCURY_EMU_CV_LENGTH / 2;
+    emu->LateBy = 1000;
+    emu->Seed = 1;
+}
+
+bool mercuryEmu_Receive(mercuryEmu_t *emu, uint8 const *buf, uint16 len, mercuryEmuReply_t *reply) {
+    bool answered = FALSE;
+
+    for (uint16 i = 0; i < len; i++) {
+        emu->Rx[emu->RxLength++] = buf[i];
+        if (emu->RxLength < MERCURY_EMU_REQUEST_LENGTH) {
+            continue;
+        }
+        uint16 crc = mercuryEmu_Crc16(emu->Rx, MERCURY_EMU_REQUEST_LENGTH - 2);
+        if (emu->Rx[5] == LO_UINT16(crc) && emu->Rx[6] == HI_UINT16(crc)) {
+            mercuryEmu_Handle(emu, reply, &answered);
+            emu->RxLength = 0;
+        } else {
+            // resync: the request may start at the next byte
+            memmove(emu->Rx, &emu->Rx[1], MERCURY_EMU_REQUEST_LENGTH - 1);
+            emu->RxLength--;
+            emu->Stats.BadBytes++;
+        }
+    }
+    return answered;
+}
+
+void mercuryEmu_Idle(mercuryEmu_t *emu) {
+    emu->Stats.BadBytes += emu->RxLength;
+    emu->RxLength = 0;
+}
+
+uint8 mercuryEmu_Reply(mercuryEmu_t const *emu, uint8 cmd, uint8 *buf) {
+    uint8 len;
+
+    mercuryEmu_Header(buf, emu->Address, cmd);
+    switch (cmd) {
+    case MERCURY_EMU_CMD_CURRENT_VALUES:
+        mercuryEmu_Bcd(&buf[5], emu->Voltage, 2);
+        mercuryEmu_Bcd(&buf[7], emu->Current, 2);
+        mercuryEmu_Bcd(&buf[9], emu->Power, 3);
+        len = MERCURY_EMU_CV_LENGTH;
+        break;
+    case MERCURY_EMU_CMD_ENERGY:
+        for (uint8 i = 0; i < MERCURY_EMU_TIERS; i++) {
+            mercuryEmu_Bcd(&buf[5 + i * 4], emu->Tiers[i], 4);
+        }
+        len = MERCURY_EMU_ENERGY_LENGTH;
+        break;
+    case MERCURY_EMU_CMD_TIME:
+        mercuryEmu_Bcd(&buf[5], emu->Clock.Weekday, 1);
+        mercuryEmu_Bcd(&buf[6], emu->Clock.Hours, 1);
+        mercuryEmu_Bcd(&buf[7], emu->Clock.Minutes, 1);
+        mercuryEmu_Bcd(&buf[8], emu->Clock.Seconds, 1);
+        mercuryEmu_Bcd(&buf[9], emu->Clock.Day, 1);
+        mercuryEmu_Bcd(&buf[10], emu->Clock.Month, 1);
+        mercuryEmu_Bcd(&buf[11], emu->Clock.Year, 1);
+        len = MERCURY_EMU_TIME_LENGTH;
+        break;
+    case MERCURY_EMU_CMD_SERIAL:
+        // binary, unlike the readings
+        buf[5] = BREAK_UINT32(emu->Serial, 3);
+        buf[6] = BREAK_UINT32(emu->Serial, 2);
+        buf[7] = BREAK_UINT32(emu->Serial, 1);
+        buf[8] = BREAK_UINT32(emu->Serial, 0);
+        len = MERCURY_EMU_SERIAL_LENGTH;
+        break;
+    default:
+        return 0;
+    }
+    mercuryEmu_Seal(buf, len);
+    return len;
+}
+
+void mercuryEmu_Request(uint8 *buf, uint32 address, uint8 cmd) {
+    mercuryEmu_Header(buf, address, cmd);
+    mercuryEmu_Seal(buf, MERCURY_EMU_REQUEST_LENGTH);
+}
+
+uint16 mercuryEmu_Crc16(uint8 const *buf, uint16 len) {
+    uint16 crc = 0xFFFF;
+
+    for (uint16 i = 0; i < len; i++) {
+        crc ^= buf[i];
+        for (uint8 bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x0001) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+static void mercuryEmu_Handle(mercuryEmu_t *emu, mercuryEmuReply_t *reply, bool *answered) {
+    uint32 address = BUILD_UINT32(emu->Rx[3], emu->Rx[2], emu->Rx[1], emu->Rx[0]);
+    uint8 cmd = emu->Rx[4];
+
+    if (address != emu->Address && address != MERCURY_EMU_BROADCAST) {
+        emu->Stats.Foreign++;
+        return;
+    }
+    emu->Stats.Requests++;
+    // a later request on the same line supersedes the reply not yet sent
+    *answered = FALSE;
+    reply->Length = mercuryEmu_Reply(emu, cmd, reply->Data);
+    if (reply->Length == 0) {
+        emu->Stats.Unsupported++;
+        return;
+    }
+    reply->Delay = emu->Latency;
+    reply->Fault = mercuryEmu_PickFault(emu);
+    if (reply->Fault == MERCURY_EMU_FAULT_SILENT) {
+        emu->Stats.Faults++;
+        return;
+    }
+    if (reply->Fault) {
+        emu->Stats.Faults++;
+        mercuryEmu_ApplyFault(emu, reply);
+    }
+    reply->Delay += mercuryEmu_LineTime(emu, reply->Length);
+    emu->Stats.Replies++;
+    *answered = TRUE;
+}
+
+static uint8 mercuryEmu_PickFault(mercuryEmu_t *emu) {
+    uint8 enabled[8];
+    uint8 count = 0;
+
+    if (emu->Faults == 0 || mercuryEmu_Random(emu, 100) >= emu->FaultPercent) {
+        return 0;
+    }
+    for (uint8 bit = 0; bit < 8; bit++) {
+        if (emu->Faults & BV(bit)) {
+            enabled[count++] = BV(bit);
+        }
+    }
+    return enabled[mercuryEmu_Random(emu, count)];
+}
+
+static void mercuryEmu_ApplyFault(mercuryEmu_t *emu, mercuryEmuReply_t *reply) {
+    switch (reply->Fault) {
+    case MERCURY_EMU_FAULT_DROP:
+        for (uint8 i = 0; i < emu->DropCount && reply->Length > 0; i++) {
+            uint8 at = (uint8)mercuryEmu_Random(emu, reply->Length);
+            memmove(&reply->Data[at], &reply->Data[at + 1], reply->Length - at - 1);
+            reply->Length--;
+        }
+        break;
+    case MERCURY_EMU_FAULT_CRC:
+        reply->Data[reply->Length - 1] ^= 0xFF;
+        break;
+    case MERCURY_EMU_FAULT_LATE:
+        reply->Delay += emu->LateBy;
+        break;
+    case MERCURY_EMU_FAULT_PARTIAL:
+        reply->Length = MIN(reply->Length, emu->PartialLength);
+        break;
+    }
+}
+
+// 32-bit LCG, faults repeat with the seed
+static uint32 mercuryEmu_Random(mercuryEmu_t *emu, uint32 range) {
+    emu->Seed = emu->Seed * 1664525 + 1013904223;
+    return (emu->Seed >> 16) % range;
+}
+
+// 8N1, 10 bits a byte, rounded up to whole ms
+static uint32 mercuryEmu_LineTime(mercuryEmu_t const *emu, uint8 len) {
+    if (emu->Baud == 0) {
+        return 0;
+    }
+    return ((uint32)len * 10 * 1000 + emu->Baud - 1) / emu->Baud;
+}
+
+static void mercuryEmu_Header(uint8 *buf, uint32 address, uint8 cmd) {
+    buf[0] = BREAK_UINT32(address, 3);
+    buf[1] = BREAK_UINT32(address, 2);
+    buf[2] = BREAK_UINT32(address, 1);
+    buf[3] = BREAK_UINT32(address, 0);
+    buf[4] = cmd;
+}
+
+// most significant digits first
+static void mercuryEmu_Bcd(uint8 *buf, uint32 value, uint8 bytes) {
+    for (int8 i = bytes - 1; i >= 0; i--) {
+        buf[i] = (uint8)(((value / 10) % 10) << 4 | (value % 10));
+        value /= 100;
+    }
+}
+
+static void mercuryEmu_Seal(uint8 *buf, uint8 len) {
+    uint16 crc = mercuryEmu_Crc16(buf, len - 2);
+    buf[len - 2] = LO_UINT16(crc);
+    buf[len - 1] = HI_UINT16(crc);
+}
@@ -0,0 +1,131 @@
+#ifndef MERCURY_EMU_H
+#define MERCURY_EMU_H
+
+#include "hal_types.h"
+
+// Software Mercury 200 on the other end of the RS-485 line. Requests are
+// address (4 bytes, big endian) + command + CRC-16/MODBUS (low byte first),
+// replies repeat address and command, carry the BCD payload and are sealed the same way.
+// The core only turns request bytes into reply frames, mercury_emu_host.c delivers them
+// through the HAL UART stub in virtual time, mercury_emu_pty.c through a Linux pty.
+
+#define MERCURY_EMU_CMD_TIME 0x21           // date and time
+#define MERCURY_EMU_CMD_ENERGY 0x27         // tier totals
+#define MERCURY_EMU_CMD_SERIAL 0x2F         // serial number
+#define MERCURY_EMU_CMD_CURRENT_VALUES 0x63 // voltage, current, power
+
+#define MERCURY_EMU_BROADCAST 0 // answered by any meter
+
+#define MERCURY_EMU_REQUEST_LENGTH 7
+#define MERCURY_EMU_TIME_LENGTH 14
+#define MERCURY_EMU_SERIAL_LENGTH 11
+#define MERCURY_EMU_CV_LENGTH 14
+#define MERCURY_EMU_ENERGY_LENGTH 23
+#define MERCURY_EMU_MAX_REPLY MERCURY_EMU_ENERGY_LENGTH
+
+#define MERCURY_EMU_TIERS 4
+
+// faults, one of the enabled ones is applied to a reply picked by FaultPercent
+#define MERCURY_EMU_FAULT_DROP 0x01    // DropCount bytes go missing
+#define MERCURY_EMU_FAULT_CRC 0x02     // CRC doesn't match
+#define MERCURY_EMU_FAULT_LATE 0x04    // LateBy ms after the normal latency
+#define MERCURY_EMU_FAULT_PARTIAL 0x08 // only the first PartialLength bytes
+#define MERCURY_EMU_FAULT_SILENT 0x10  // no reply at all
+
+typedef struct {
+    uint8 Weekday; // 0 - Sunday
+    uint8 Hours;
+    uint8 Minutes;
+    uint8 Seconds;
+    uint8 Day;
+    uint8 Month;
+    uint8 Year; // since 2000
+} mercuryEmuClock_t;
+
+typedef struct {
+    uint32 Requests;    // addressed to this meter with a valid CRC
+    uint32 Replies;     // sent, faulted ones included
+    uint32 Foreign;     // valid, for another address
+    uint32 BadBytes;    // skipped while looking for a valid request
+    uint32 Unsupported; // unknown command, not answered
+    uint32 Faults;      // replies a fault was applied to
+} mercuryEmuStats_t;
+
+typedef struct {
+    uint8 Data[MERCURY_EMU_MAX_REPLY];
+    uint8 Length;
+    uint32 Delay; // ms, request end to the last reply byte on the line
+    uint8 Fault;  // MERCURY_EMU_FAULT_* applied, 0 - clean
+} mercuryEmuReply_t;
+
+typedef struct {
+    // meter
+    uint32 Address;
+    uint32 Serial;
+    uint16 Voltage;                  // 0.1 V
+    uint16 Current;                  // 0.01 A
+    uint32 Power;                    // W
+    uint32 Tiers[MERCURY_EMU_TIERS]; // 0.01 kWh
+    mercuryEmuClock_t Clock;
+
+    // timing
+    uint16 Latency; // ms, request end to reply start
+    uint32 Baud;    // line time of the reply is added, 0 - none
+
+    // faults
+    uint8 Faults;        // MERCURY_EMU_FAULT_* allowed
+    uint8 FaultPercent;  // of the replies, 100 - every one
+    uint8 DropCount;     // bytes
+    uint8 PartialLength; // bytes
+    uint16 LateBy;       // ms
+    uint32 Seed;         // fault dice, same seed - same faults
+
+    mercuryEmuStats_t Stats;
+
+    // request being assembled
+    uint8 Rx[MERCURY_EMU_REQUEST_LENGTH];
+    uint8 RxLength;
+} mercuryEmu_t;
+
+/*
+ * Meter at address with the default readings, no latency and no faults
+ */
+extern void mercuryEmu_Init(mercuryEmu_t *emu, uint32 address);
+
+/*
+ * Bytes from the line. Returns TRUE and fills reply once they complete a request
+ * for this meter, garbage in front of a request is skipped byte by byte.
+ */
+extern bool mercuryEmu_Receive(mercuryEmu_t *emu, uint8 const *buf, uint16 len, mercuryEmuReply_t *reply);
+
+/*
+ * Line went quiet, a request left incomplete is dropped
+ */
+extern void mercuryEmu_Idle(mercuryEmu_t *emu);
+
+/*
+ * Clean reply of the meter to cmd, returns its length, 0 for an unknown command
+ */
+extern uint8 mercuryEmu_Reply(mercuryEmu_t const *emu, uint8 cmd, uint8 *buf);
+
+/*
+ * Request frame as the CC2530 side sends it, MERCURY_EMU_REQUEST_LENGTH bytes
+ */
+extern void mercuryEmu_Request(uint8 *buf, uint32 address, uint8 cmd);
+
+extern uint16 mercuryEmu_Crc16(uint8 const *buf, uint16 len);
+
+// RS-485 glue for the host build, see mercury_emu_host.c
+
+/*
+ * Answers requests written to port, replies are fed back after their Delay of virtual time.
+ * Registers an OSAL task, call after hostOsal_Reset.
+ */
+extern void mercuryEmuHost_Attach(mercuryEmu_t *emu, uint8 port);
+
+/*
+ * Replies still on their way
+ */
+extern uint8 mercuryEmuHost_Pending(void);
+
+#endif // MERCURY_EMU_H
@@ -0,0 +1,93 @@
+#include "OSAL.h"
+#include "host.h"
+#include "mercury_emu.h"
+#include <string.h>
+
+// Delivers the emulator replies into the HAL UART stub. A reply waits for its Delay
+// on an OSAL timer, so it lands in RX between the phases of the poll cycle just as
+// a slow meter would, replies with no Delay are fed from the write itself.
+
+#define MERCURY_EMU_HOST_REPLY_EVT 0x0001
+#define MERCURY_EMU_HOST_QUEUE 4
+
+typedef struct {
+    mercuryEmuReply_t Reply;
+    uint32 Due; // virtual ms
+} mercuryEmuHostSlot_t;
+
+static mercuryEmu_t *mercuryEmuHost_Emu = NULL;
+static uint8 mercuryEmuHost_Port;
+static uint8 mercuryEmuHost_TaskId;
+static mercuryEmuHostSlot_t mercuryEmuHost_Queue[MERCURY_EMU_HOST_QUEUE];
+static uint8 mercuryEmuHost_Count = 0;
+
+static void mercuryEmuHost_Tx(uint8 port, uint8 const *buf, uint16 len);
+static uint16 mercuryEmuHost_Loop(uint8 task_id, uint16 events);
+static void mercuryEmuHost_Schedule(void);
+
+void mercuryEmuHost_Attach(mercuryEmu_t *emu, uint8 port) {
+    mercuryEmuHost_Emu = emu;
+    mercuryEmuHost_Port = port;
+    mercuryEmuHost_Count = 0;
+    mercuryEmuHost_TaskId = hostOsal_AddTask(mercuryEmuHost_Loop);
+    hostUart_SetTxHook(port, mercuryEmuHost_Tx);
+}
+
+uint8 mercuryEmuHost_Pending(void) { return mercuryEmuHost_Count; }
+
+static void mercuryEmuHost_Tx(uint8 port, uint8 const *buf, uint16 len) {
+    mercuryEmuReply_t reply;
+
+    if (port != mercuryEmuHost_Port || !mercuryEmu_Receive(mercuryEmuHost_Emu, buf, len, &reply)) {
+        return;
+    }
+    if (reply.Delay == 0) {
+        hostUart_Feed(port, reply.Data, reply.Length);
+        return;
+    }
+    if (mercuryEmuHost_Count == MERCURY_EMU_HOST_QUEUE) {
+        // line busy for longer than anyone polls, the oldest reply is lost
+        memmove(&mercuryEmuHost_Queue[0], &mercuryEmuHost_Queue[1], sizeof(mercuryEmuHost_Queue[0]) * (MERCURY_EMU_HOST_QUEUE - 1));
+        mercuryEmuHost_Count--;
+    }
+    mercuryEmuHost_Queue[mercuryEmuHost_Count].Reply = reply;
+    mercuryEmuHost_Queue[mercuryEmuHost_Count].Due = osal_GetSystemClock() + reply.Delay;
+    mercuryEmuHost_Count++;
+    mercuryEmuHost_Schedule();
+}
+
+static uint16 mercuryEmuHost_Loop(uint8 task_id, uint16 events) {
+    if (events & MERCURY_EMU_HOST_REPLY_EVT) {
+        uint32 now = osal_GetSystemClock();
+        uint8 kept = 0;
+
+        for (uint8 i = 0; i < mercuryEmuHost_Count; i++) {
+            mercuryEmuHostSlot_t *slot = &mercuryEmuHost_Queue[i];
+            if ((int32)(slot->Due - now) <= 0) {
+                hostUart_Feed(mercuryEmuHost_Port, slot->Reply.Data, slot->Reply.Length);
+            } else {
+                mercuryEmuHost_Queue[kept++] = *slot;
+            }
+        }
+        mercuryEmuHost_Count = kept;
+        mercuryEmuHost_Schedule();
+        return (events ^ MERCURY_EMU_HOST_REPLY_EVT);
+    }
+    return 0;
+}
+
+// timer to the earliest reply due
+static void mercuryEmuHost_Schedule(void) {
+    uint32 now = osal_GetSystemClock();
+    uint32 wait = 0xFFFFFFFF;
+
+    if (mercuryEmuHost_Count == 0) {
+        osal_stop_timerEx(mercuryEmuHost_TaskId, MERCURY_EMU_HOST_REPLY_EVT);
+        return;
+    }
+    for (uint8 i = 0; i < mercuryEmuHost_Count; i++) {
+        int32 left = (int32)(mercuryEmuHost_Queue[i].Due - now);
+        wait = MIN(wait, (uint32)MAX(left, 0));
+    }
+    osal_start_timerEx(mercuryEmuHost_TaskId, MERCURY_EMU_HOST_REPLY_EVT, wait);
+}
@@ -0,0 +1,152 @@
+#include "mercury_emu.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+// Mercury 200 on a Linux pty, for tools that talk to a serial port.
+// mercury_emu_pty [-a address] [-l latency ms] [-b baud] [-f faults] [-p percent] [-s seed] [-v]
+// faults: d - drop bytes, c - corrupt CRC, l - late, p - partial frame, s - silent.
+// Prints the slave path, serves until SIGINT or SIGTERM, then prints the counters.
+
+#define MERCURY_EMU_PTY_IDLE_MS 20 // gap that ends an incomplete request
+
+static volatile sig_atomic_t mercuryEmuPty_Stop = 0;
+
+static void mercuryEmuPty_Signal(int sig) { mercuryEmuPty_Stop = 1; }
+
+static uint8 mercuryEmuPty_Faults(char const *letters) {
+    uint8 faults = 0;
+
+    for (; *letters; letters++) {
+        switch (*letters) {
+        case 'd':
+            faults |= MERCURY_EMU_FAULT_DROP;
+            break;
+        case 'c':
+            faults |= MERCURY_EMU_FAULT_CRC;
+            break;
+        case 'l':
+            faults |= MERCURY_EMU_FAULT_LATE;
+            break;
+        case 'p':
+            faults |= MERCURY_EMU_FAULT_PARTIAL;
+            break;
+        case 's':
+            faults |= MERCURY_EMU_FAULT_SILENT;
+            break;
+        default:
+            fprintf(stderr, "unknown fault %c\n", *letters);
+            exit(2);
+        }
+    }
+    return faults;
+}
+
+static void mercuryEmuPty_Sleep(uint32 ms) {
+    struct timespec ts = {.tv_sec = ms / 1000, .tv_nsec = (long)(ms % 1000) * 1000000};
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR && !mercuryEmuPty_Stop) {
+    }
+}
+
+static int mercuryEmuPty_Open(void) {
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    struct termios tio;
+
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        perror("pty");
+        exit(1);
+    }
+    // the slave stays open here too, so the master doesn't see a hangup between clients
+    int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if (slave < 0 || tcgetattr(slave, &tio) != 0) {
+        perror(ptsname(master));
+        exit(1);
+    }
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+    return master;
+}
+
+int main(int argc, char **argv) {
+    mercuryEmu_t emu;
+    mercuryEmuReply_t reply;
+    bool verbose = FALSE;
+    int opt;
+
+    mercuryEmu_Init(&emu, 11111111);
+    emu.FaultPercent = 10;
+    while ((opt = getopt(argc, argv, "a:l:b:f:p:s:v")) != -1) {
+        switch (opt) {
+        case 'a':
+            emu.Address = emu.Serial = (uint32)strtoul(optarg, NULL, 10);
+            break;
+        case 'l':
+            emu.Latency = (uint16)strtoul(optarg, NULL, 10);
+            break;
+        case 'b':
+            emu.Baud = (uint32)strtoul(optarg, NULL, 10);
+            break;
+        case 'f':
+            emu.Faults = mercuryEmuPty_Faults(optarg);
+            break;
+        case 'p':
+            emu.FaultPercent = (uint8)strtoul(optarg, NULL, 10);
+            break;
+        case 's':
+            emu.Seed = (uint32)strtoul(optarg, NULL, 10);
+            break;
+        case 'v':
+            verbose = TRUE;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-a address] [-l latency] [-b baud] [-f dclps] [-p percent] [-s seed] [-v]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    int master = mercuryEmuPty_Open();
+    signal(SIGINT, mercuryEmuPty_Signal);
+    signal(SIGTERM, mercuryEmuPty_Signal);
+    printf("%s\n", ptsname(master));
+    fflush(stdout);
+
+    while (!mercuryEmuPty_Stop) {
+        struct pollfd pfd = {.fd = master, .events = POLLIN};
+        uint8 buf[64];
+
+        int ready = poll(&pfd, 1, emu.RxLength ? MERCURY_EMU_PTY_IDLE_MS : 1000);
+        if (ready == 0) {
+            mercuryEmu_Idle(&emu);
+            continue;
+        }
+        if (ready < 0) {
+            continue; // signal
+        }
+        ssize_t len = read(master, buf, sizeof(buf));
+        if (len <= 0) {
+            continue;
+        }
+        if (!mercuryEmu_Receive(&emu, buf, (uint16)len, &reply)) {
+            continue;
+        }
+        mercuryEmuPty_Sleep(reply.Delay);
+        if (write(master, reply.Data, reply.Length) != reply.Length) {
+            perror("write");
+        }
+        if (verbose) {
+            fprintf(stderr, "reply %d bytes after %u ms, fault 0x%02X\n", reply.Length, (unsigned)reply.Delay, reply.Fault);
+        }
+    }
+
+    fprintf(stderr, "requests %u replies %u foreign %u bad bytes %u unsupported %u faults %u\n", (unsigned)emu.Stats.Requests,
+            (unsigned)emu.Stats.Replies, (unsigned)emu.Stats.Foreign, (unsigned)emu.Stats.BadBytes, (unsigned)emu.Stats.Unsupported,
+            (unsigned)emu.Stats.Faults);
+    return 0;
+}
@@ -0,0 +1,64 @@
+#ifndef AF_H
+#define AF_H
+
+#include "OSAL.h"
+#include "ZComDef.h"
+
+typedef uint16 cId_t;
+
+typedef enum {
+    afAddrNotPresent = AddrNotPresent,
+    afAddr16Bit = Addr16Bit,
+    afAddr64Bit = Addr64Bit,
+    afAddrGroup = AddrGroup,
+    afAddrBroadcast = AddrBroadcast
+} afAddrMode_t;
+
+typedef struct {
+    union {
+        uint16 shortAddr;
+        uint8 extAddr[Z_EXTADDR_LEN];
+    } addr;
+    afAddrMode_t addrMode;
+    uint8 endPoint;
+    uint16 panId;
+} afAddrType_t;
+
+typedef struct {
+    uint8 TransSeqNumber;
+    uint16 DataLength;
+    uint8 *Data;
+} afMSGCommandFormat_t;
+
+typedef struct {
+    osal_event_hdr_t hdr;
+    uint16 groupId;
+    uint16 clusterId;
+    afAddrType_t srcAddr;
+    uint16 macDestAddr;
+    uint8 endPoint;
+    uint8 wasBroadcast;
+    uint8 LinkQuality;
+    uint8 correlation;
+    int8 rssi;
+    uint8 SecurityUse;
+    uint32 timestamp;
+    uint8 nwkSeqNum;
+    afMSGCommandFormat_t cmd;
+    uint16 macSrcAddr;
+    uint8 radius;
+} afIncomingMSGPacket_t;
+
+typedef struct {
+    uint8 EndPoint;
+    uint16 AppProfId;
+    uint16 AppDeviceId;
+    uint8 AppDevVer : 4;
+    uint8 Reserved : 4;
+    uint8 AppNumInClusters;
+    cId_t *pAppInClusterList;
+    uint8 AppNumOutClusters;
+    cId_t *pAppOutClusterList;
+} SimpleDescriptionFormat_t;
+
+#endif // AF_H
@@ -0,0 +1,6 @@
+#ifndef DEBUGTRACE_H
+#define DEBUGTRACE_H
+
+// nothing from here is used by the host build
+
+#endif // DEBUGTRACE_H
@@ -0,0 +1,6 @@
+#ifndef MT_H
+#define MT_H
+
+// nothing from here is used by the host build
+
+#endif // MT_H
@@ -0,0 +1,35 @@
+#ifndef OSAL_H
+#define OSAL_H
+
+#include "OSAL_Memory.h"
+#include "ZComDef.h"
+
+#define SYS_EVENT_MSG 0x8000
+
+typedef struct {
+    uint8 event;
+    uint8 status;
+} osal_event_hdr_t;
+
+extern uint8 *osal_msg_allocate(uint16 len);
+extern uint8 osal_msg_deallocate(uint8 *msg_ptr);
+extern uint8 osal_msg_send(uint8 destination_task, uint8 *msg_ptr);
+extern uint8 *osal_msg_receive(uint8 task_id);
+
+extern uint8 osal_set_event(uint8 task_id, uint16 event_flag);
+extern uint8 osal_clear_event(uint8 task_id, uint16 event_flag);
+
+extern uint8 osal_start_timerEx(uint8 task_id, uint16 event_id, uint32 timeout_value);
+extern uint8 osal_start_reload_timer(uint8 taskID, uint16 event_id, uint32 timeout_value);
+extern uint8 osal_stop_timerEx(uint8 task_id, uint16 event_id);
+extern uint32 osal_get_timeoutEx(uint8 task_id, uint16 event_id);
+extern uint32 osal_GetSystemClock(void);
+
+extern uint16 osal_rand(void);
+extern int osal_strlen(char *pString);
+extern void *osal_memcpy(void *dst, const void *src, unsigned int len);
+extern uint8 osal_memcmp(const void *src1, const void *src2, unsigned int len);
+extern void *osal_memset(void *dest, uint8 value, int len);
+extern uint32 osal_build_uint32(uint8 *swapped, uint8 len);
+
+#endif // OSAL_H
@@ -0,0 +1,23 @@
+#ifndef OSAL_CLOCK_H
+#define OSAL_CLOCK_H
+
+#include "comdef.h"
+
+// seconds since 2000-01-01 00:00:00
+typedef uint32 UTCTime;
+
+typedef struct {
+    uint8 seconds; // 0-59
+    uint8 minutes; // 0-59
+    uint8 hour;    // 0-23
+    uint8 day;     // 0-30
+    uint8 month;   // 0-11
+    uint16 year;   // 2000+
+} UTCTimeStruct;
+
+extern void osal_setClock(UTCTime newTime);
+extern UTCTime osal_getClock(void);
+extern void osal_ConvertUTCTime(UTCTimeStruct *tm, UTCTime secTime);
+extern UTCTime osal_ConvertUTCSecs(UTCTimeStruct *tm);
+
+#endif // OSAL_CLOCK_H
@@ -0,0 +1,12 @@
+#ifndef OSAL_MEMORY_H
+#define OSAL_MEMORY_H
+
+#include "comdef.h"
+
+extern void *osal_mem_alloc(uint16 size);
+extern void osal_mem_free(void *ptr);
+#if OSALMEM_METRICS
+extern uint16 osal_heap_mem_used(void);
+#endif
+
+#endif // OSAL_MEMORY_H
@@ -0,0 +1,12 @@
+#ifndef OSAL_NV_H
+#define OSAL_NV_H
+
+#include "ZComDef.h"
+
+extern uint8 osal_nv_item_init(uint16 id, uint16 len, void *buf);
+extern uint16 osal_nv_item_len(uint16 id);
+extern uint8 osal_nv_read(uint16 id, uint16 ndx, uint16 len, void *buf);
+extern uint8 osal_nv_write(uint16 id, uint16 ndx, uint16 len, void *buf);
+extern uint8 osal_nv_delete(uint16 id, uint16 len);
+
+#endif // OSAL_NV_H
@@ -0,0 +1,11 @@
+#ifndef OSAL_PWRMGR_H
+#define OSAL_PWRMGR_H
+
+#include "comdef.h"
+
+#define PWRMGR_CONSERVE 0
+#define PWRMGR_HOLD 1
+
+extern uint8 osal_pwrmgr_task_state(uint8 task_id, uint8 state);
+
+#endif // OSAL_PWRMGR_H
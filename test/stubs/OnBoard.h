@@ -0,0 +1,20 @@
+#ifndef ONBOARD_H
+#define ONBOARD_H
+
+#include "OSAL.h"
+#include "hal_mcu.h"
+
+typedef struct {
+    osal_event_hdr_t hdr;
+    uint8 state; // shift
+    uint8 keys;  // keys
+} keyChange_t;
+
+extern uint8 RegisterForKeys(uint8 task_id);
+extern void MicroWait(uint16 timeout);
+
+// DS18B20 data line, see host_preinclude.h
+extern uint8 *hostDs18b20_Pin(void);
+extern uint8 hostDs18b20_Dir;
+
+#endif // ONBOARD_H
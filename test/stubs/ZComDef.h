@@ -0,0 +1,23 @@
+#ifndef ZCOMDEF_H
+#define ZCOMDEF_H
+
+#include "comdef.h"
+
+typedef Status_t ZStatus_t;
+
+#define ZSuccess SUCCESS
+#define ZSUCCESS SUCCESS
+#define ZFailure FAILURE
+#define ZInvalidParameter INVALIDPARAMETER
+#define ZMemError 0x10
+#define ZBufferFull 0x11
+
+enum { AddrNotPresent = 0, AddrGroup = 1, Addr16Bit = 2, Addr64Bit = 3, AddrBroadcast = 15 };
+
+#define Z_EXTADDR_LEN 8
+
+#define KEY_CHANGE 0xC0
+#define AF_DATA_CONFIRM_CMD 0xFD
+#define AF_INCOMING_MSG_CMD 0x1A
+
+#endif // ZCOMDEF_H
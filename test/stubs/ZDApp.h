@@ -0,0 +1,26 @@
+#ifndef ZDAPP_H
+#define ZDAPP_H
+
+#include "AF.h"
+#include "OSAL_Nv.h"
+
+typedef enum {
+    DEV_HOLD,
+    DEV_INIT,
+    DEV_NWK_DISC,
+    DEV_NWK_JOINING,
+    DEV_NWK_SEC_REJOIN_CURR_CHANNEL,
+    DEV_END_DEVICE_UNAUTH,
+    DEV_END_DEVICE,
+    DEV_ROUTER,
+    DEV_COORD_STARTING,
+    DEV_ZB_COORD,
+    DEV_NWK_ORPHAN
+} devStates_t;
+
+extern devStates_t devState;
+
+extern uint8 *NLME_GetExtAddr(void);
+extern uint16 NLME_GetShortAddr(void);
+
+#endif // ZDAPP_H
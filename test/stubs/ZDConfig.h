@@ -0,0 +1,6 @@
+#ifndef ZDCONFIG_H
+#define ZDCONFIG_H
+
+// nothing from here is used by the host build
+
+#endif // ZDCONFIG_H
@@ -0,0 +1,6 @@
+#ifndef ZDOBJECT_H
+#define ZDOBJECT_H
+
+// nothing from here is used by the host build
+
+#endif // ZDOBJECT_H
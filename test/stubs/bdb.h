@@ -0,0 +1,6 @@
+#ifndef BDB_H
+#define BDB_H
+
+#include "bdb_interface.h"
+
+#endif // BDB_H
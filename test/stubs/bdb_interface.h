@@ -0,0 +1,10 @@
+#ifndef BDB_INTERFACE_H
+#define BDB_INTERFACE_H
+
+#include "AF.h"
+
+extern void bdb_RegisterSimpleDescriptor(SimpleDescriptionFormat_t *simpleDesc);
+extern void bdb_RepChangedAttrValue(uint8 endpoint, uint16 cluster, uint16 attrID);
+extern uint8 bdb_getZCLFrameCounter(void);
+
+#endif // BDB_INTERFACE_H
@@ -0,0 +1,6 @@
+#ifndef BDB_TOUCHLINK_H
+#define BDB_TOUCHLINK_H
+
+// nothing from here is used by the host build
+
+#endif // BDB_TOUCHLINK_H
@@ -0,0 +1,6 @@
+#ifndef BDB_TOUCHLINK_TARGET_H
+#define BDB_TOUCHLINK_TARGET_H
+
+// nothing from here is used by the host build
+
+#endif // BDB_TOUCHLINK_TARGET_H
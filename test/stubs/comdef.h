@@ -0,0 +1,25 @@
+#ifndef COMDEF_H
+#define COMDEF_H
+
+#include "hal_defs.h"
+#include "hal_types.h"
+
+typedef uint8 byte;
+typedef uint8 UINT8;
+typedef int8 INT8;
+typedef uint16 UINT16;
+typedef int16 INT16;
+typedef uint32 UINT32;
+typedef int32 INT32;
+
+typedef uint8 Status_t;
+
+#define SUCCESS 0x00
+#define FAILURE 0x01
+#define INVALIDPARAMETER 0x02
+#define INVALID_EVENT_ID 0x06
+#define NV_ITEM_UNINIT 0x09
+#define NV_OPER_FAILED 0x0A
+#define NV_BAD_ITEM_LEN 0x0C
+
+#endif // COMDEF_H
@@ -0,0 +1,91 @@
+#include "eeprom_i2c.h"
+#include "hal_i2c.h"
+#include <string.h>
+
+// Only the slave side of the transfers is modelled: the 16-bit word address is latched
+// from the prefix, page writes wrap inside their page, sequential reads roll over at
+// the end of memory and the address is NAKed while the write cycle runs.
+
+// HalI2CAckPoll gives up after this many attempts, as the driver does after its timeout
+#define EEPROM_I2C_ACK_POLL_LIMIT 100
+
+uint8 eepromI2c_Memory[EEPROM_I2C_SIZE];
+uint16 eepromI2c_Transfers = 0;
+uint16 eepromI2c_AckPolls = 0;
+uint16 eepromI2c_LastAddress = 0;
+
+static uint16 eepromI2c_WriteCycle = 1;
+static uint16 eepromI2c_Busy = 0;
+static bool eepromI2c_Present = true;
+
+void eepromI2c_Reset(void) {
+    memset(eepromI2c_Memory, 0xFF, sizeof(eepromI2c_Memory));
+    eepromI2c_Transfers = 0;
+    eepromI2c_AckPolls = 0;
+    eepromI2c_LastAddress = 0;
+    eepromI2c_WriteCycle = 1;
+    eepromI2c_Busy = 0;
+    eepromI2c_Present = true;
+}
+
+void eepromI2c_SetWriteCycle(uint16 polls) { eepromI2c_WriteCycle = polls; }
+
+void eepromI2c_SetPresent(bool present) { eepromI2c_Present = present; }
+
+// address byte of a transfer
+static bool eepromI2c_Acked(uint8 address) {
+    if (!eepromI2c_Present || address != EEPROM_I2C_ADDRESS) {
+        return false;
+    }
+    if (eepromI2c_Busy) {
+        eepromI2c_Busy--;
+        return false;
+    }
+    return true;
+}
+
+static bool eepromI2c_Latch(uint8 *prefix, uint8 prefixLen) {
+    if (prefixLen != 2) {
+        return false;
+    }
+    eepromI2c_LastAddress = (uint16)(BUILD_UINT16(prefix[1], prefix[0]) % EEPROM_I2C_SIZE);
+    return true;
+}
+
+void HalI2CInit(void) {}
+
+void HalI2CSetClockDivisor(uint8 divisor) {}
+
+int8 HalI2CWriteBlock(uint8 address, uint8 *prefix, uint8 prefixLen, uint8 *buf, uint16 len) {
+    if (!eepromI2c_Acked(address) || !eepromI2c_Latch(prefix, prefixLen)) {
+        return I2C_ERROR;
+    }
+    uint16 page = eepromI2c_LastAddress - eepromI2c_LastAddress % EEPROM_I2C_PAGE_SIZE;
+    for (uint16 i = 0; i < len; i++) {
+        eepromI2c_Memory[page + (eepromI2c_LastAddress + i) % EEPROM_I2C_PAGE_SIZE] = buf[i];
+    }
+    eepromI2c_Transfers++;
+    eepromI2c_Busy = eepromI2c_WriteCycle;
+    return I2C_SUCCESS;
+}
+
+int8 HalI2CReadBlock(uint8 address, uint8 *prefix, uint8 prefixLen, uint8 *buf, uint16 len) {
+    if (!eepromI2c_Acked(address) || !eepromI2c_Latch(prefix, prefixLen)) {
+        return I2C_ERROR;
+    }
+    for (uint16 i = 0; i < len; i++) {
+        buf[i] = eepromI2c_Memory[(eepromI2c_LastAddress + i) % EEPROM_I2C_SIZE];
+    }
+    eepromI2c_Transfers++;
+    return I2C_SUCCESS;
+}
+
+int8 HalI2CAckPoll(uint8 address) {
+    for (uint8 i = 0; i < EEPROM_I2C_ACK_POLL_LIMIT; i++) {
+        eepromI2c_AckPolls++;
+        if (eepromI2c_Acked(address)) {
+            return I2C_SUCCESS;
+        }
+    }
+    return I2C_ERROR;
+}
@@ -0,0 +1,23 @@
+#ifndef EEPROM_I2C_H
+#define EEPROM_I2C_H
+
+#include "hal_types.h"
+
+// 24C256 on the hal_i2c block API for the at24c driver tests
+#define EEPROM_I2C_SIZE ((uint32)32768)
+#define EEPROM_I2C_PAGE_SIZE 64
+#define EEPROM_I2C_ADDRESS 0x50
+
+extern uint8 eepromI2c_Memory[EEPROM_I2C_SIZE];
+extern uint16 eepromI2c_Transfers; // address acknowledged, data moved
+extern uint16 eepromI2c_AckPolls;  // address bytes sent by HalI2CAckPoll, NAKed ones included
+extern uint16 eepromI2c_LastAddress;
+
+// erases memory to 0xFF, the part is idle and on the bus
+extern void eepromI2c_Reset(void);
+// address NAKs for this many polls after a page write
+extern void eepromI2c_SetWriteCycle(uint16 polls);
+// NAKs every transfer while removed
+extern void eepromI2c_SetPresent(bool present);
+
+#endif // EEPROM_I2C_H
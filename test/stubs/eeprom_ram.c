@@ -0,0 +1,57 @@
+#include "eeprom_ram.h"
+#include <string.h>
+
+static int8 eepromRam_Read(uint16 address, uint8 *buf, uint16 len);
+static int8 eepromRam_Write(uint16 address, uint8 *buf, uint16 len);
+
+zclEeprom_t eepromRam_dev = {&eepromRam_Read, &eepromRam_Write, EEPROM_RAM_PAGE_SIZE, EEPROM_RAM_SIZE};
+uint8 eepromRam_Memory[EEPROM_RAM_SIZE];
+uint32 eepromRam_Writes = 0;
+
+static int32 eepromRam_CutAfter = -1;
+static bool eepromRam_Offline = false;
+
+void eepromRam_Reset(void) {
+    memset(eepromRam_Memory, 0xFF, sizeof(eepromRam_Memory));
+    eepromRam_Writes = 0;
+    eepromRam_CutAfter = -1;
+    eepromRam_Offline = false;
+}
+
+void eepromRam_CutPowerAfter(uint16 bytes) { eepromRam_CutAfter = bytes; }
+
+void eepromRam_SetOffline(bool offline) { eepromRam_Offline = offline; }
+
+static int8 eepromRam_Read(uint16 address, uint8 *buf, uint16 len) {
+    if (eepromRam_Offline) {
+        return EEPROM_ERROR;
+    }
+    // sequential read rolls over at the end of memory
+    for (uint16 i = 0; i < len; i++) {
+        buf[i] = eepromRam_Memory[(address + i) % EEPROM_RAM_SIZE];
+    }
+    return EEPROM_SUCCESS;
+}
+
+static int8 eepromRam_Write(uint16 address, uint8 *buf, uint16 len) {
+    uint32 page = address - address % EEPROM_RAM_PAGE_SIZE;
+
+    if (eepromRam_Offline || len > EEPROM_RAM_PAGE_SIZE) {
+        return EEPROM_ERROR;
+    }
+    eepromRam_Writes++;
+    // like the real part, page write wraps to the start of the same page
+    for (uint16 i = 0; i < len; i++) {
+        if (eepromRam_CutAfter == 0) {
+            // power is back with eepromRam_SetOffline(false)
+            eepromRam_CutAfter = -1;
+            eepromRam_Offline = true;
+            return EEPROM_ERROR;
+        }
+        if (eepromRam_CutAfter > 0) {
+            eepromRam_CutAfter--;
+        }
+        eepromRam_Memory[page + (address + i) % EEPROM_RAM_PAGE_SIZE] = buf[i];
+    }
+    return EEPROM_SUCCESS;
+}
@@ -0,0 +1,21 @@
+#ifndef EEPROM_RAM_H
+#define EEPROM_RAM_H
+
+#include "eeprom.h"
+
+// RAM backed 24Cxx double for host tests
+#define EEPROM_RAM_SIZE ((uint32)32768)
+#define EEPROM_RAM_PAGE_SIZE 64
+
+extern zclEeprom_t eepromRam_dev;
+extern uint8 eepromRam_Memory[EEPROM_RAM_SIZE];
+extern uint32 eepromRam_Writes;
+
+// erases memory to 0xFF and clears injected faults
+extern void eepromRam_Reset(void);
+// simulates a power cut: only the given number of bytes of the next write reach the memory
+extern void eepromRam_CutPowerAfter(uint16 bytes);
+// every read and write fails while set
+extern void eepromRam_SetOffline(bool offline);
+
+#endif // EEPROM_RAM_H
@@ -0,0 +1,6 @@
+#ifndef GP_INTERFACE_H
+#define GP_INTERFACE_H
+
+// nothing from here is used by the host build
+
+#endif // GP_INTERFACE_H
@@ -0,0 +1,23 @@
+#ifndef HAL_ADC_H
+#define HAL_ADC_H
+
+#include "hal_board.h"
+#include "comdef.h"
+
+#define HAL_ADC_CHANNEL_0 0x00
+#define HAL_ADC_CHANNEL_7 0x07
+#define HAL_ADC_CHANNEL_VDD 0x0F
+
+#define HAL_ADC_RESOLUTION_8 0x01
+#define HAL_ADC_RESOLUTION_10 0x02
+#define HAL_ADC_RESOLUTION_12 0x03
+#define HAL_ADC_RESOLUTION_14 0x04
+
+#define HAL_ADC_REF_125V 0x00
+#define HAL_ADC_REF_AIN7 0x40
+#define HAL_ADC_REF_AVDD 0x80
+
+extern uint16 HalAdcRead(uint8 channel, uint8 resolution);
+extern void HalAdcSetReference(uint8 reference);
+
+#endif // HAL_ADC_H
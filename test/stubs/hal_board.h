@@ -0,0 +1,6 @@
+#ifndef HAL_BOARD_H
+#define HAL_BOARD_H
+
+#include "hal_mcu.h"
+
+#endif // HAL_BOARD_H
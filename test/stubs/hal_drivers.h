@@ -0,0 +1,6 @@
+#ifndef HAL_DRIVERS_H
+#define HAL_DRIVERS_H
+
+#include "hal_board.h"
+
+#endif // HAL_DRIVERS_H
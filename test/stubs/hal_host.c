@@ -0,0 +1,130 @@
+#include "OnBoard.h"
+#include "hal_adc.h"
+#include "hal_led.h"
+#include "hal_uart.h"
+#include "host.h"
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+    halUARTCBack_t Callback;
+    hostUart_TxHook_t TxHook;
+    uint8 Rx[HOST_UART_BUFFER_SIZE];
+    uint16 RxLen;
+    uint8 Tx[HOST_UART_BUFFER_SIZE];
+    uint16 TxLen;
+} hostUartPort_t;
+
+static hostUartPort_t hostUart_Ports[HAL_UART_PORT_MAX];
+bool hostUart_Echo = false;
+
+uint16 hostAdc_Value = 0;
+
+static uint32 hostHal_SleepLatch = 0;
+static uint8 hostDs18b20_Line = 1;
+uint8 hostDs18b20_Dir = 0;
+
+/*********************************************************************
+ * UART
+ */
+void hostUart_Reset(void) { memset(hostUart_Ports, 0, sizeof(hostUart_Ports)); }
+
+// bytes arrive at once and the line goes idle, as the DMA driver reports them
+void hostUart_Feed(uint8 port, uint8 const *buf, uint16 len) {
+    hostUartPort_t *p = &hostUart_Ports[port];
+
+    len = MIN(len, HOST_UART_BUFFER_SIZE - p->RxLen);
+    memcpy(&p->Rx[p->RxLen], buf, len);
+    p->RxLen += len;
+    if (p->Callback != NULL) {
+        p->Callback(port, HAL_UART_RX_TIMEOUT);
+    }
+}
+
+uint8 const *hostUart_Sent(uint8 port, uint16 *len) {
+    *len = hostUart_Ports[port].TxLen;
+    return hostUart_Ports[port].Tx;
+}
+
+void hostUart_ClearSent(uint8 port) { hostUart_Ports[port].TxLen = 0; }
+
+void hostUart_SetTxHook(uint8 port, hostUart_TxHook_t hook) { hostUart_Ports[port].TxHook = hook; }
+
+void HalUARTInit(void) {}
+
+uint8 HalUARTOpen(uint8 port, halUARTCfg_t *config) {
+    if (port >= HAL_UART_PORT_MAX) {
+        return HAL_UART_NOT_SUPPORTED;
+    }
+    hostUart_Ports[port].Callback = config->callBackFunc;
+    return HAL_UART_SUCCESS;
+}
+
+uint16 HalUARTRead(uint8 port, uint8 *buf, uint16 len) {
+    hostUartPort_t *p = &hostUart_Ports[port];
+
+    len = MIN(len, p->RxLen);
+    memcpy(buf, p->Rx, len);
+    memmove(p->Rx, &p->Rx[len], p->RxLen - len);
+    p->RxLen -= len;
+    return len;
+}
+
+uint16 HalUARTWrite(uint8 port, uint8 *buf, uint16 len) {
+    hostUartPort_t *p = &hostUart_Ports[port];
+
+    if (hostUart_Echo && port == HAL_UART_PORT_0) {
+        fwrite(buf, 1, len, stdout);
+    }
+    // the hook is the other end of the line and drains it, the write goes out whole;
+    // the log keeps the oldest bytes, without a hook like a full TX buffer
+    uint16 logged = MIN(len, HOST_UART_BUFFER_SIZE - p->TxLen);
+    memcpy(&p->Tx[p->TxLen], buf, logged);
+    p->TxLen += logged;
+    if (p->TxHook != NULL) {
+        p->TxHook(port, buf, len);
+        return len;
+    }
+    return logged;
+}
+
+uint16 Hal_UART_RxBufLen(uint8 port) { return hostUart_Ports[port].RxLen; }
+
+/*********************************************************************
+ * LED, ADC, keys, timers
+ */
+uint8 HalLedSet(uint8 led, uint8 mode) {
+    (void)led;
+    return mode;
+}
+
+uint16 HalAdcRead(uint8 channel, uint8 resolution) {
+    (void)channel;
+    (void)resolution;
+    return hostAdc_Value;
+}
+
+void HalAdcSetReference(uint8 reference) { (void)reference; }
+
+uint8 RegisterForKeys(uint8 task_id) {
+    (void)task_id;
+    return TRUE;
+}
+
+void MicroWait(uint16 timeout) { (void)timeout; }
+
+uint8 hostHal_SleepTimer(uint8 index) {
+    if (index == 0) {
+        hostHal_SleepLatch = (uint32)((uint64_t)hostOsal_Micros() * 32768 / 1000000);
+    }
+    return BREAK_UINT32(hostHal_SleepLatch, index);
+}
+
+/*********************************************************************
+ * DS18B20 data line
+ */
+uint8 *hostDs18b20_Pin(void) {
+    // pulled up, whatever was driven before
+    hostDs18b20_Line = 1;
+    return &hostDs18b20_Line;
+}
@@ -0,0 +1,20 @@
+#ifndef HAL_LED_H
+#define HAL_LED_H
+
+#include "hal_board.h"
+
+#define HAL_LED_1 0x01
+#define HAL_LED_2 0x02
+#define HAL_LED_3 0x04
+#define HAL_LED_4 0x08
+#define HAL_LED_ALL (HAL_LED_1 | HAL_LED_2 | HAL_LED_3 | HAL_LED_4)
+
+#define HAL_LED_MODE_OFF 0x00
+#define HAL_LED_MODE_ON 0x01
+#define HAL_LED_MODE_BLINK 0x02
+#define HAL_LED_MODE_FLASH 0x04
+#define HAL_LED_MODE_TOGGLE 0x08
+
+extern uint8 HalLedSet(uint8 led, uint8 mode);
+
+#endif // HAL_LED_H
@@ -0,0 +1,20 @@
+#ifndef HAL_MCU_H
+#define HAL_MCU_H
+
+#include "hal_defs.h"
+#include "hal_types.h"
+
+// single threaded host, interrupts are never taken
+typedef uint8 halIntState_t;
+#define HAL_ENTER_CRITICAL_SECTION(x) st(x = 0;)
+#define HAL_EXIT_CRITICAL_SECTION(x) st((void)(x);)
+
+// 24-bit sleep timer, 32.768 kHz, follows the virtual clock of osal_host.c
+#define ST0 hostHal_SleepTimer(0)
+#define ST1 hostHal_SleepTimer(1)
+#define ST2 hostHal_SleepTimer(2)
+
+// reading byte 0 latches the other two, like on the CC2530
+extern uint8 hostHal_SleepTimer(uint8 index);
+
+#endif // HAL_MCU_H
@@ -0,0 +1,25 @@
+#ifndef HAL_TYPES_H
+#define HAL_TYPES_H
+
+// Host build: 8051 integer types with the same widths, bool is the C99 one
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int8_t int8;
+typedef uint8_t uint8;
+typedef int16_t int16;
+typedef uint16_t uint16;
+typedef int32_t int32;
+typedef uint32_t uint32;
+typedef int64_t int64;
+typedef uint8 halDataAlign_t;
+
+#ifndef TRUE
+    #define TRUE 1
+#endif
+#ifndef FALSE
+    #define FALSE 0
+#endif
+
+#endif // HAL_TYPES_H
@@ -0,0 +1,54 @@
+#ifndef HAL_UART_H
+#define HAL_UART_H
+
+#include "hal_board.h"
+
+#define HAL_UART_PORT_0 0x00
+#define HAL_UART_PORT_1 0x01
+#define HAL_UART_PORT_MAX 0x02
+
+#define HAL_UART_BR_9600 0x00
+#define HAL_UART_BR_19200 0x01
+#define HAL_UART_BR_38400 0x02
+#define HAL_UART_BR_57600 0x03
+#define HAL_UART_BR_115200 0x04
+
+#define HAL_UART_RX_FULL 0x01
+#define HAL_UART_RX_ABOUT_FULL 0x02
+#define HAL_UART_RX_TIMEOUT 0x04
+#define HAL_UART_TX_FULL 0x08
+#define HAL_UART_TX_EMPTY 0x10
+
+#define HAL_UART_SUCCESS 0x00
+#define HAL_UART_UNCONFIGURED 0x01
+#define HAL_UART_NOT_SUPPORTED 0x02
+
+typedef void (*halUARTCBack_t)(uint8 port, uint8 event);
+
+typedef struct {
+    uint16 bufferHead;
+    uint16 bufferTail;
+    uint16 maxBufSize;
+    uint8 *pBuffer;
+} halUARTBufControl_t;
+
+typedef struct {
+    bool configured;
+    uint8 baudRate;
+    bool flowControl;
+    uint16 flowControlThreshold;
+    uint8 idleTimeout;
+    halUARTBufControl_t rx;
+    halUARTBufControl_t tx;
+    bool intEnable;
+    uint32 rxChRvdTime;
+    halUARTCBack_t callBackFunc;
+} halUARTCfg_t;
+
+extern void HalUARTInit(void);
+extern uint8 HalUARTOpen(uint8 port, halUARTCfg_t *config);
+extern uint16 HalUARTRead(uint8 port, uint8 *buf, uint16 len);
+extern uint16 HalUARTWrite(uint8 port, uint8 *buf, uint16 len);
+extern uint16 Hal_UART_RxBufLen(uint8 port);
+
+#endif // HAL_UART_H
@@ -0,0 +1,75 @@
+#ifndef HOST_H
+#define HOST_H
+
+#include "AF.h"
+#include "zcl.h"
+
+// Test side of the OSAL / HAL / ZCL stubs. Time is virtual, it moves only in hostOsal_Run.
+
+typedef uint16 (*hostOsal_EventLoop_t)(uint8 task_id, uint16 events);
+typedef void (*hostUart_TxHook_t)(uint8 port, uint8 const *buf, uint16 len);
+
+#define HOST_UART_BUFFER_SIZE 256
+
+#define HOST_ZCL_MAX_FRAMES 32
+#define HOST_ZCL_MAX_ATTRS 8
+#define HOST_ZCL_MAX_PAYLOAD 80
+
+// frame handed to the stack by zcl_SendReportCmd or zcl_SendCommand
+typedef struct {
+    uint8 Endpoint;
+    uint16 ClusterId;
+    uint8 CommandId; // ZCL_CMD_REPORT for reports
+    bool Specific;
+    afAddrMode_t AddrMode;
+    uint16 ShortAddr;
+    uint8 NumAttr;
+    uint16 AttrId[HOST_ZCL_MAX_ATTRS];
+    uint32 AttrValue[HOST_ZCL_MAX_ATTRS]; // low 4 bytes of the attribute
+    uint16 PayloadLen;
+    uint8 Payload[HOST_ZCL_MAX_PAYLOAD];
+} hostZclFrame_t;
+
+// OSAL: tasks, timers, messages, clock, heap
+extern void hostOsal_Reset(void);
+extern uint8 hostOsal_AddTask(hostOsal_EventLoop_t loop);
+extern void hostOsal_Run(uint32 ms);
+extern uint32 hostOsal_Micros(void);
+extern void hostOsal_Seed(uint16 seed);
+extern void hostOsal_FailAllocs(uint16 count);
+extern uint16 hostOsal_Allocated(void);
+
+// NV in RAM
+extern void hostNv_Reset(void);
+extern uint32 hostNv_Writes;
+
+// UART
+extern void hostUart_Reset(void);
+extern void hostUart_Feed(uint8 port, uint8 const *buf, uint16 len);
+extern uint8 const *hostUart_Sent(uint8 port, uint16 *len);
+extern void hostUart_ClearSent(uint8 port);
+extern void hostUart_SetTxHook(uint8 port, hostUart_TxHook_t hook);
+extern bool hostUart_Echo;
+
+// ADC channels read back by HalAdcRead
+extern uint16 hostAdc_Value;
+
+// ZCL / BDB / NWK
+extern void hostZcl_Reset(void);
+extern uint8 hostZcl_FrameCount(void);
+extern hostZclFrame_t const *hostZcl_Frame(uint8 index);
+extern hostZclFrame_t const *hostZcl_FindFrame(uint16 clusterId, uint8 commandId);
+extern zclAttrRec_t const *hostZcl_FindAttr(uint8 endpoint, uint16 clusterId, uint16 attrId);
+extern ZStatus_t hostZcl_Authorize(uint8 endpoint, uint16 clusterId, uint16 attrId, uint8 oper);
+extern ZStatus_t hostZcl_Command(uint8 endpoint, uint16 clusterId, uint8 commandId, uint8 *payload, uint16 len);
+extern void hostZcl_TimeResponse(uint16 srcAddr, uint32 time); // Time read response to the ZCL message task
+extern ZStatus_t hostZcl_SendStatus; // returned by zcl_SendReportCmd
+extern uint16 hostZcl_ChangedAttrs;  // bdb_RepChangedAttrValue calls
+extern uint8 hostNwk_ExtAddr[Z_EXTADDR_LEN];
+
+// commissioning and factory reset
+extern void hostCommissioning_Connect(void);
+extern uint16 hostCommissioning_PollRate;
+extern uint16 hostCommissioning_FastPolls;
+
+#endif // HOST_H
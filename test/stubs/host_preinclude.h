@@ -0,0 +1,35 @@
+// Host counterpart of Source/preinclude.h and f8wConfig.cfg, force-included by test/CMakeLists.txt
+#define CONST const
+#define GENERIC
+
+#define ZCL_READ
+#define ZCL_WRITE
+#define ZCL_BASIC
+#define ZCL_REPORTING_DEVICE
+#define ZCL_ELECTRICAL_MEASUREMENT
+#define ZCL_ON_OFF
+#define ZCL_ALARMS
+#define ZCL_DIAGNOSTIC
+
+#define OSALMEM_METRICS TRUE
+#define POLL_RATE 1000
+
+#define HAL_UART TRUE
+#define MERCURY_PORT HAL_UART_PORT_1
+
+// log lines go to the debug UART stub, hostUart_Echo prints them
+#define DO_DEBUG_UART
+#ifndef LOG_LEVEL
+    #define LOG_LEVEL LOG_LEVEL_WARN
+#endif
+
+// the data line floats high on every access, as with no sensor on the bus
+#define DS18B20_PORT 0
+#define TSENS_SBIT (*hostDs18b20_Pin())
+#define TSENS_BV BV(0)
+#define TSENS_DIR hostDs18b20_Dir
+
+// what hal_board_cfg.h brings in on the device
+#include "hal_mcu.h"
+#include "hal_defs.h"
+#include "hal_types.h"
@@ -0,0 +1,6 @@
+#ifndef NWK_UTIL_H
+#define NWK_UTIL_H
+
+// nothing from here is used by the host build
+
+#endif // NWK_UTIL_H
@@ -0,0 +1,473 @@
+#include "OSAL.h"
+#include "OSAL_Clock.h"
+#include "OSAL_Nv.h"
+#include "OSAL_PwrMgr.h"
+#include "host.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HOST_OSAL_MAX_TASKS 4
+#define HOST_OSAL_MAX_TIMERS 32
+#define HOST_OSAL_MAX_LOOPS 10000 // event loop calls at one instant before giving up
+
+#define HOST_NV_MAX_ITEMS 48
+#define HOST_NV_MAX_ITEM_SIZE 512
+
+#define HOST_CLOCK_DAY_SEC ((uint32)24 * 60 * 60)
+
+typedef struct {
+    bool Used;
+    uint8 Task;
+    uint16 Event;
+    uint32 Due; // ms
+    uint32 Reload;
+} hostTimer_t;
+
+typedef struct hostMsg {
+    struct hostMsg *Next;
+    uint8 Task;
+    bool Queued;
+} hostMsg_t;
+
+typedef struct {
+    uint16 Size;
+} hostMem_t;
+
+typedef struct {
+    bool Used;
+    uint16 Id;
+    uint16 Len;
+    uint8 Data[HOST_NV_MAX_ITEM_SIZE];
+} hostNvItem_t;
+
+static hostOsal_EventLoop_t hostOsal_Tasks[HOST_OSAL_MAX_TASKS];
+static uint16 hostOsal_Events[HOST_OSAL_MAX_TASKS];
+static uint8 hostOsal_TaskCount = 0;
+static hostTimer_t hostOsal_Timers[HOST_OSAL_MAX_TIMERS];
+static hostMsg_t *hostOsal_Messages = NULL;
+static uint32 hostOsal_Now = 0;       // ms since boot
+static uint32 hostOsal_UtcBase = 0;   // UTC at boot
+static uint32 hostOsal_RandState = 1;
+static uint16 hostOsal_AllocFailures = 0;
+static uint16 hostOsal_HeapUsed = 0;
+
+static hostNvItem_t hostNv_Items[HOST_NV_MAX_ITEMS];
+uint32 hostNv_Writes = 0;
+
+static void hostOsal_Poll(void);
+static hostTimer_t *hostOsal_FindTimer(uint8 task, uint16 event);
+static hostNvItem_t *hostNv_Find(uint16 id);
+static bool hostClock_IsLeapYear(uint16 year);
+static uint8 hostClock_MonthLength(uint16 year, uint8 month);
+
+/*********************************************************************
+ * Test control
+ */
+void hostOsal_Reset(void) {
+    while (hostOsal_Messages != NULL) {
+        osal_msg_deallocate((uint8 *)(hostOsal_Messages + 1));
+    }
+    memset(hostOsal_Tasks, 0, sizeof(hostOsal_Tasks));
+    memset(hostOsal_Events, 0, sizeof(hostOsal_Events));
+    memset(hostOsal_Timers, 0, sizeof(hostOsal_Timers));
+    hostOsal_TaskCount = 0;
+    hostOsal_Now = 0;
+    hostOsal_UtcBase = 0;
+    hostOsal_RandState = 1;
+    hostOsal_AllocFailures = 0;
+}
+
+uint8 hostOsal_AddTask(hostOsal_EventLoop_t loop) {
+    if (hostOsal_TaskCount >= HOST_OSAL_MAX_TASKS) {
+        fprintf(stderr, "hostOsal: too many tasks\n");
+        abort();
+    }
+    hostOsal_Tasks[hostOsal_TaskCount] = loop;
+    return hostOsal_TaskCount++;
+}
+
+void hostOsal_Run(uint32 ms) {
+    uint32 end = hostOsal_Now + ms;
+
+    for (;;) {
+        hostTimer_t *next = NULL;
+
+        hostOsal_Poll();
+        for (uint8 i = 0; i < HOST_OSAL_MAX_TIMERS; i++) {
+            hostTimer_t *timer = &hostOsal_Timers[i];
+            if (timer->Used && (int32)(timer->Due - end) <= 0 && (next == NULL || (int32)(timer->Due - next->Due) < 0)) {
+                next = timer;
+            }
+        }
+        if (next == NULL) {
+            break;
+        }
+        if ((int32)(next->Due - hostOsal_Now) > 0) {
+            hostOsal_Now = next->Due;
+        }
+        for (uint8 i = 0; i < HOST_OSAL_MAX_TIMERS; i++) {
+            hostTimer_t *timer = &hostOsal_Timers[i];
+            if (!timer->Used || (int32)(timer->Due - hostOsal_Now) > 0) {
+                continue;
+            }
+            hostOsal_Events[timer->Task] |= timer->Event;
+            if (timer->Reload) {
+                timer->Due = hostOsal_Now + timer->Reload;
+            } else {
+                timer->Used = false;
+            }
+        }
+    }
+    hostOsal_Now = end;
+}
+
+uint32 hostOsal_Micros(void) { return hostOsal_Now * 1000; }
+
+void hostOsal_Seed(uint16 seed) { hostOsal_RandState = seed ? seed : 1; }
+
+void hostOsal_FailAllocs(uint16 count) { hostOsal_AllocFailures = count; }
+
+uint16 hostOsal_Allocated(void) { return hostOsal_HeapUsed; }
+
+// lower task ids first, like the OSAL scheduler
+static void hostOsal_Poll(void) {
+    for (uint16 loops = 0;; loops++) {
+        uint8 task = 0;
+
+        while (task < hostOsal_TaskCount && hostOsal_Events[task] == 0) {
+            task++;
+        }
+        if (task == hostOsal_TaskCount) {
+            return;
+        }
+        if (loops >= HOST_OSAL_MAX_LOOPS) {
+            fprintf(stderr, "hostOsal: task %d keeps events 0x%04X set\n", task, hostOsal_Events[task]);
+            abort();
+        }
+        uint16 events = hostOsal_Events[task];
+        hostOsal_Events[task] = 0;
+        hostOsal_Events[task] |= hostOsal_Tasks[task](task, events);
+    }
+}
+
+/*********************************************************************
+ * Events and timers
+ */
+uint8 osal_set_event(uint8 task_id, uint16 event_flag) {
+    hostOsal_Events[task_id] |= event_flag;
+    return SUCCESS;
+}
+
+uint8 osal_clear_event(uint8 task_id, uint16 event_flag) {
+    hostOsal_Events[task_id] &= ~event_flag;
+    return SUCCESS;
+}
+
+uint8 osal_start_timerEx(uint8 task_id, uint16 event_id, uint32 timeout_value) {
+    hostTimer_t *timer = hostOsal_FindTimer(task_id, event_id);
+
+    if (timer == NULL) {
+        return FAILURE;
+    }
+    timer->Used = true;
+    timer->Task = task_id;
+    timer->Event = event_id;
+    timer->Due = hostOsal_Now + timeout_value;
+    timer->Reload = 0;
+    return SUCCESS;
+}
+
+uint8 osal_start_reload_timer(uint8 taskID, uint16 event_id, uint32 timeout_value) {
+    uint8 status = osal_start_timerEx(taskID, event_id, timeout_value);
+
+    if (status == SUCCESS) {
+        hostOsal_FindTimer(taskID, event_id)->Reload = timeout_value;
+    }
+    return status;
+}
+
+uint8 osal_stop_timerEx(uint8 task_id, uint16 event_id) {
+    hostTimer_t *timer = hostOsal_FindTimer(task_id, event_id);
+
+    if (timer == NULL || !timer->Used) {
+        return INVALID_EVENT_ID;
+    }
+    timer->Used = false;
+    return SUCCESS;
+}
+
+uint32 osal_get_timeoutEx(uint8 task_id, uint16 event_id) {
+    hostTimer_t *timer = hostOsal_FindTimer(task_id, event_id);
+
+    if (timer == NULL || !timer->Used) {
+        return 0;
+    }
+    return timer->Due - hostOsal_Now;
+}
+
+uint32 osal_GetSystemClock(void) { return hostOsal_Now; }
+
+// the running timer of the task event, or a free slot
+static hostTimer_t *hostOsal_FindTimer(uint8 task, uint16 event) {
+    hostTimer_t *free = NULL;
+
+    for (uint8 i = 0; i < HOST_OSAL_MAX_TIMERS; i++) {
+        hostTimer_t *timer = &hostOsal_Timers[i];
+        if (timer->Used && timer->Task == task && timer->Event == event) {
+            return timer;
+        }
+        if (!timer->Used && free == NULL) {
+            free = timer;
+        }
+    }
+    return free;
+}
+
+/*********************************************************************
+ * Messages
+ */
+uint8 *osal_msg_allocate(uint16 len) {
+    hostMsg_t *msg = osal_mem_alloc(sizeof(hostMsg_t) + len);
+
+    if (msg == NULL) {
+        return NULL;
+    }
+    memset(msg, 0, sizeof(hostMsg_t) + len);
+    return (uint8 *)(msg + 1);
+}
+
+uint8 osal_msg_deallocate(uint8 *msg_ptr) {
+    hostMsg_t *msg = (hostMsg_t *)msg_ptr - 1;
+
+    if (msg->Queued) {
+        hostMsg_t **link = &hostOsal_Messages;
+        while (*link != msg) {
+            link = &(*link)->Next;
+        }
+        *link = msg->Next;
+    }
+    osal_mem_free(msg);
+    return SUCCESS;
+}
+
+uint8 osal_msg_send(uint8 destination_task, uint8 *msg_ptr) {
+    hostMsg_t *msg = (hostMsg_t *)msg_ptr - 1;
+    hostMsg_t **link = &hostOsal_Messages;
+
+    while (*link != NULL) {
+        link = &(*link)->Next;
+    }
+    msg->Task = destination_task;
+    msg->Queued = true;
+    msg->Next = NULL;
+    *link = msg;
+    return osal_set_event(destination_task, SYS_EVENT_MSG);
+}
+
+uint8 *osal_msg_receive(uint8 task_id) {
+    for (hostMsg_t **link = &hostOsal_Messages; *link != NULL; link = &(*link)->Next) {
+        hostMsg_t *msg = *link;
+        if (msg->Task == task_id) {
+            *link = msg->Next;
+            msg->Queued = false;
+            return (uint8 *)(msg + 1);
+        }
+    }
+    return NULL;
+}
+
+uint8 osal_pwrmgr_task_state(uint8 task_id, uint8 state) {
+    (void)task_id;
+    (void)state;
+    return SUCCESS;
+}
+
+/*********************************************************************
+ * Heap
+ */
+void *osal_mem_alloc(uint16 size) {
+    hostMem_t *mem;
+
+    if (hostOsal_AllocFailures > 0) {
+        hostOsal_AllocFailures--;
+        return NULL;
+    }
+    mem = malloc(sizeof(hostMem_t) + size);
+    if (mem == NULL) {
+        return NULL;
+    }
+    mem->Size = size;
+    hostOsal_HeapUsed += size;
+    return mem + 1;
+}
+
+void osal_mem_free(void *ptr) {
+    hostMem_t *mem = (hostMem_t *)ptr - 1;
+
+    if (ptr == NULL) {
+        return;
+    }
+    hostOsal_HeapUsed -= mem->Size;
+    free(mem);
+}
+
+uint16 osal_heap_mem_used(void) { return hostOsal_HeapUsed; }
+
+/*********************************************************************
+ * Utilities
+ */
+uint16 osal_rand(void) {
+    hostOsal_RandState = hostOsal_RandState * 1103515245UL + 12345;
+    return (uint16)(hostOsal_RandState >> 16);
+}
+
+int osal_strlen(char *pString) { return (int)strlen(pString); }
+
+void *osal_memcpy(void *dst, const void *src, unsigned int len) {
+    memcpy(dst, src, len);
+    // OSAL returns the byte after the copy
+    return (uint8 *)dst + len;
+}
+
+// TRUE when equal
+uint8 osal_memcmp(const void *src1, const void *src2, unsigned int len) { return memcmp(src1, src2, len) == 0; }
+
+void *osal_memset(void *dest, uint8 value, int len) { return memset(dest, value, len); }
+
+uint32 osal_build_uint32(uint8 *swapped, uint8 len) {
+    uint32 value = 0;
+
+    for (int8 i = len - 1; i >= 0; i--) {
+        value = (value << 8) | swapped[i];
+    }
+    return value;
+}
+
+/*********************************************************************
+ * Clock
+ */
+void osal_setClock(UTCTime newTime) { hostOsal_UtcBase = newTime - hostOsal_Now / 1000; }
+
+UTCTime osal_getClock(void) { return hostOsal_UtcBase + hostOsal_Now / 1000; }
+
+void osal_ConvertUTCTime(UTCTimeStruct *tm, UTCTime secTime) {
+    uint32 day = secTime % HOST_CLOCK_DAY_SEC;
+    uint32 days = secTime / HOST_CLOCK_DAY_SEC;
+
+    tm->seconds = day % 60;
+    tm->minutes = (day % 3600) / 60;
+    tm->hour = day / 3600;
+    tm->year = 2000;
+    while (days >= (hostClock_IsLeapYear(tm->year) ? 366U : 365U)) {
+        days -= hostClock_IsLeapYear(tm->year) ? 366 : 365;
+        tm->year++;
+    }
+    tm->month = 0;
+    while (days >= hostClock_MonthLength(tm->year, tm->month)) {
+        days -= hostClock_MonthLength(tm->year, tm->month);
+        tm->month++;
+    }
+    tm->day = days;
+}
+
+UTCTime osal_ConvertUTCSecs(UTCTimeStruct *tm) {
+    uint32 days = tm->day;
+
+    for (uint8 month = 0; month < tm->month; month++) {
+        days += hostClock_MonthLength(tm->year, month);
+    }
+    for (uint16 year = 2000; year < tm->year; year++) {
+        days += hostClock_IsLeapYear(year) ? 366 : 365;
+    }
+    return days * HOST_CLOCK_DAY_SEC + (uint32)tm->hour * 3600 + (uint32)tm->minutes * 60 + tm->seconds;
+}
+
+static bool hostClock_IsLeapYear(uint16 year) { return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0); }
+
+static uint8 hostClock_MonthLength(uint16 year, uint8 month) {
+    static const uint8 lengths[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return month == 1 && hostClock_IsLeapYear(year) ? 29 : lengths[month];
+}
+
+/*********************************************************************
+ * NV
+ */
+void hostNv_Reset(void) {
+    memset(hostNv_Items, 0, sizeof(hostNv_Items));
+    hostNv_Writes = 0;
+}
+
+uint8 osal_nv_item_init(uint16 id, uint16 len, void *buf) {
+    hostNvItem_t *item = hostNv_Find(id);
+
+    if (item != NULL) {
+        return SUCCESS;
+    }
+    for (uint8 i = 0; i < HOST_NV_MAX_ITEMS; i++) {
+        if (!hostNv_Items[i].Used && len <= HOST_NV_MAX_ITEM_SIZE) {
+            item = &hostNv_Items[i];
+            item->Used = true;
+            item->Id = id;
+            item->Len = len;
+            if (buf != NULL) {
+                memcpy(item->Data, buf, len);
+            } else {
+                memset(item->Data, 0xFF, len);
+            }
+            return NV_ITEM_UNINIT;
+        }
+    }
+    return NV_OPER_FAILED;
+}
+
+uint16 osal_nv_item_len(uint16 id) {
+    hostNvItem_t *item = hostNv_Find(id);
+    return item != NULL ? item->Len : 0;
+}
+
+uint8 osal_nv_read(uint16 id, uint16 ndx, uint16 len, void *buf) {
+    hostNvItem_t *item = hostNv_Find(id);
+
+    if (item == NULL || ndx + len > item->Len) {
+        return NV_OPER_FAILED;
+    }
+    memcpy(buf, &item->Data[ndx], len);
+    return SUCCESS;
+}
+
+uint8 osal_nv_write(uint16 id, uint16 ndx, uint16 len, void *buf) {
+    hostNvItem_t *item = hostNv_Find(id);
+
+    if (item == NULL) {
+        return NV_ITEM_UNINIT;
+    }
+    if (ndx + len > item->Len) {
+        return NV_OPER_FAILED;
+    }
+    memcpy(&item->Data[ndx], buf, len);
+    hostNv_Writes++;
+    return SUCCESS;
+}
+
+uint8 osal_nv_delete(uint16 id, uint16 len) {
+    hostNvItem_t *item = hostNv_Find(id);
+
+    if (item == NULL) {
+        return NV_ITEM_UNINIT;
+    }
+    if (item->Len != len) {
+        return NV_BAD_ITEM_LEN;
+    }
+    item->Used = false;
+    return SUCCESS;
+}
+
+static hostNvItem_t *hostNv_Find(uint16 id) {
+    for (uint8 i = 0; i < HOST_NV_MAX_ITEMS; i++) {
+        if (hostNv_Items[i].Used && hostNv_Items[i].Id == id) {
+            return &hostNv_Items[i];
+        }
+    }
+    return NULL;
+}
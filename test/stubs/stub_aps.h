@@ -0,0 +1,6 @@
+#ifndef STUB_APS_H
+#define STUB_APS_H
+
+// nothing from here is used by the host build
+
+#endif // STUB_APS_H
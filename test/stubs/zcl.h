@@ -0,0 +1,159 @@
+#ifndef ZCL_H
+#define ZCL_H
+
+#include "AF.h"
+
+#define ZCL_INCOMING_MSG 0x34
+
+// clusters
+#define ZCL_CLUSTER_ID_GEN_BASIC 0x0000
+#define ZCL_CLUSTER_ID_GEN_POWER_CFG 0x0001
+#define ZCL_CLUSTER_ID_GEN_IDENTIFY 0x0003
+#define ZCL_CLUSTER_ID_GEN_ON_OFF 0x0006
+#define ZCL_CLUSTER_ID_GEN_ALARMS 0x0009
+#define ZCL_CLUSTER_ID_GEN_TIME 0x000A
+#define ZCL_CLUSTER_ID_MS_TEMPERATURE_MEASUREMENT 0x0402
+#define ZCL_CLUSTER_ID_MS_PRESSURE_MEASUREMENT 0x0403
+#define ZCL_CLUSTER_ID_MS_RELATIVE_HUMIDITY 0x0405
+#define ZCL_CLUSTER_ID_SE_METERING 0x0702
+#define ZCL_CLUSTER_ID_HA_ELECTRICAL_MEASUREMENT 0x0B04
+#define ZCL_CLUSTER_ID_HA_DIAGNOSTIC 0x0B05
+
+// foundation commands
+#define ZCL_CMD_READ 0x00
+#define ZCL_CMD_READ_RSP 0x01
+#define ZCL_CMD_WRITE 0x02
+#define ZCL_CMD_REPORT 0x0A
+
+#define ZCL_FRAME_CLIENT_SERVER_DIR 0x00
+#define ZCL_FRAME_SERVER_CLIENT_DIR 0x01
+#define zcl_ServerCmd(a) ((a) == ZCL_FRAME_CLIENT_SERVER_DIR)
+
+// status
+#define ZCL_STATUS_SUCCESS 0x00
+#define ZCL_STATUS_FAILURE 0x01
+#define ZCL_STATUS_MALFORMED_COMMAND 0x80
+#define ZCL_STATUS_UNSUP_CLUSTER_COMMAND 0x81
+#define ZCL_STATUS_UNSUPPORTED_ATTRIBUTE 0x86
+#define ZCL_STATUS_SOFTWARE_FAILURE 0xD1
+#define ZCL_STATUS_CMD_HAS_RSP 0xFF
+
+// data types
+#define ZCL_DATATYPE_BITMAP16 0x19
+#define ZCL_DATATYPE_UINT8 0x20
+#define ZCL_DATATYPE_UINT16 0x21
+#define ZCL_DATATYPE_UINT24 0x22
+#define ZCL_DATATYPE_UINT32 0x23
+#define ZCL_DATATYPE_UINT48 0x25
+#define ZCL_DATATYPE_INT8 0x28
+#define ZCL_DATATYPE_INT16 0x29
+#define ZCL_DATATYPE_INT32 0x2B
+#define ZCL_DATATYPE_ENUM8 0x30
+#define ZCL_DATATYPE_SINGLE_PREC 0x39
+#define ZCL_DATATYPE_CHAR_STR 0x42
+#define ZCL_DATATYPE_UTC 0xE2
+
+// access control
+#define ACCESS_CONTROL_READ 0x01
+#define ACCESS_CONTROL_WRITE 0x02
+#define ACCESS_REPORTABLE 0x04
+#define ACCESS_CONTROL_COMMAND 0x08
+#define ACCESS_CONTROL_AUTH_READ 0x10
+#define ACCESS_CONTROL_AUTH_WRITE 0x20
+#define ACCESS_CLIENT 0x80
+
+#define ZCL_OPER_LEN 0x00
+#define ZCL_OPER_READ 0x01
+#define ZCL_OPER_WRITE 0x02
+
+#define ATTRID_CLUSTER_REVISION 0xFFFD
+
+typedef struct {
+    unsigned int type : 2;
+    unsigned int manuSpecific : 1;
+    unsigned int direction : 1;
+    unsigned int disableDefaultRsp : 1;
+    unsigned int reserved : 3;
+} zclFrameControl_t;
+
+typedef struct {
+    zclFrameControl_t fc;
+    uint16 manuCode;
+    uint8 transSeqNum;
+    uint8 commandID;
+} zclFrameHdr_t;
+
+typedef struct {
+    afIncomingMSGPacket_t *msg;
+    zclFrameHdr_t hdr;
+    uint8 *pData;
+    uint16 pDataLen;
+    void *attrCmd;
+} zclIncoming_t;
+
+typedef struct {
+    osal_event_hdr_t hdr;
+    zclFrameHdr_t zclHdr;
+    uint16 clusterId;
+    afAddrType_t srcAddr;
+    uint8 endPoint;
+    void *attrCmd;
+} zclIncomingMsg_t;
+
+typedef struct {
+    uint16 attrId;
+    uint8 dataType;
+    uint8 accessControl;
+    void *dataPtr;
+} zclAttribute_t;
+
+typedef struct {
+    uint16 clusterID;
+    zclAttribute_t attr;
+} zclAttrRec_t;
+
+typedef struct {
+    uint16 attrID;
+    uint8 dataType;
+    uint8 *attrData;
+} zclReport_t;
+
+typedef struct {
+    uint8 numAttr;
+    zclReport_t attrList[];
+} zclReportCmd_t;
+
+typedef struct {
+    uint8 numAttr;
+    uint16 attrID[];
+} zclReadCmd_t;
+
+typedef struct {
+    uint16 attrID;
+    uint8 status;
+    uint8 dataType;
+    uint8 *data;
+} zclReadRspStatus_t;
+
+typedef struct {
+    uint8 numAttr;
+    zclReadRspStatus_t attrList[];
+} zclReadRspCmd_t;
+
+typedef ZStatus_t (*zclInHdlr_t)(zclIncoming_t *pInHdlrMsg);
+typedef ZStatus_t (*zclReadWriteCB_t)(uint16 clusterId, uint16 attrId, uint8 oper, uint8 *pValue, uint16 *pLen);
+typedef ZStatus_t (*zclAuthorizeCB_t)(afAddrType_t *srcAddr, zclAttrRec_t *pAttr, uint8 oper);
+
+extern ZStatus_t zcl_registerPlugin(uint16 startClusterID, uint16 endClusterID, zclInHdlr_t pfnIncomingHdlr);
+extern ZStatus_t zcl_registerAttrList(uint8 endpoint, uint8 numAttr, const zclAttrRec_t attrList[]);
+extern ZStatus_t zcl_registerReadWriteCB(uint8 endpoint, zclReadWriteCB_t pfnReadWriteCB, zclAuthorizeCB_t pfnAuthorizeCB);
+extern uint8 zcl_registerForMsg(uint8 taskId);
+
+extern ZStatus_t zcl_SendCommand(uint8 srcEP, afAddrType_t *dstAddr, uint16 clusterID, uint8 cmd, uint8 specific, uint8 direction,
+                                 uint8 disableDefaultRsp, uint16 manuCode, uint8 seqNum, uint16 cmdFormatLen, uint8 *cmdFormat);
+extern ZStatus_t zcl_SendRead(uint8 srcEP, afAddrType_t *dstAddr, uint16 realClusterID, zclReadCmd_t *readCmd, uint8 direction,
+                              uint8 disableDefaultRsp, uint8 seqNum);
+extern ZStatus_t zcl_SendReportCmd(uint8 srcEP, afAddrType_t *dstAddr, uint16 clusterID, zclReportCmd_t *reportCmd, uint8 direction,
+                                   uint8 disableDefaultRsp, uint8 seqNum);
+
+#endif // ZCL_H
@@ -0,0 +1,37 @@
+#ifndef ZCL_DIAGNOSTIC_H
+#define ZCL_DIAGNOSTIC_H
+
+#include "zcl.h"
+
+#define ATTRID_DIAGNOSTIC_NUMBER_OF_RESETS 0x0000
+#define ATTRID_DIAGNOSTIC_PERSISTENT_MEMORY_WRITES 0x0001
+#define ATTRID_DIAGNOSTIC_MAC_RX_BCAST 0x0100
+#define ATTRID_DIAGNOSTIC_MAC_TX_BCAST 0x0101
+#define ATTRID_DIAGNOSTIC_MAC_RX_UCAST 0x0102
+#define ATTRID_DIAGNOSTIC_MAC_TX_UCAST 0x0103
+#define ATTRID_DIAGNOSTIC_MAC_TX_UCAST_RETRY 0x0104
+#define ATTRID_DIAGNOSTIC_MAC_TX_UCAST_FAIL 0x0105
+#define ATTRID_DIAGNOSTIC_APS_RX_BCAST 0x0106
+#define ATTRID_DIAGNOSTIC_APS_TX_BCAST 0x0107
+#define ATTRID_DIAGNOSTIC_APS_RX_UCAST 0x0108
+#define ATTRID_DIAGNOSTIC_APS_TX_UCAST_SUCCESS 0x0109
+#define ATTRID_DIAGNOSTIC_APS_TX_UCAST_RETRY 0x010A
+#define ATTRID_DIAGNOSTIC_APS_TX_UCAST_FAIL 0x010B
+#define ATTRID_DIAGNOSTIC_ROUTE_DISC_INITIATED 0x010C
+#define ATTRID_DIAGNOSTIC_NEIGHBOR_ADDED 0x010D
+#define ATTRID_DIAGNOSTIC_NEIGHBOR_REMOVED 0x010E
+#define ATTRID_DIAGNOSTIC_NEIGHBOR_STALE 0x010F
+#define ATTRID_DIAGNOSTIC_JOIN_INDICATION 0x0110
+#define ATTRID_DIAGNOSTIC_CHILD_MOVED 0x0111
+#define ATTRID_DIAGNOSTIC_NWK_DECRYPT_FAILURES 0x0112
+#define ATTRID_DIAGNOSTIC_APS_DECRYPT_FAILURES 0x0113
+#define ATTRID_DIAGNOSTIC_PACKET_BUFFER_ALLOCATE_FAILURES 0x0114
+#define ATTRID_DIAGNOSTIC_RELAYED_UCAST 0x0115
+#define ATTRID_DIAGNOSTIC_AVERAGE_MAC_RETRY_PER_APS_MESSAGE_SENT 0x011B
+#define ATTRID_DIAGNOSTIC_LAST_MESSAGE_LQI 0x011C
+#define ATTRID_DIAGNOSTIC_LAST_MESSAGE_RSSI 0x011D
+
+extern uint8 zclDiagnostic_InitStats(void);
+extern ZStatus_t zclDiagnostic_ReadWriteAttrCB(uint16 clusterId, uint16 attrId, uint8 oper, uint8 *pValue, uint16 *pLen);
+
+#endif // ZCL_DIAGNOSTIC_H
@@ -0,0 +1,19 @@
+#ifndef ZCL_ELECTRICAL_MEASUREMENT_H
+#define ZCL_ELECTRICAL_MEASUREMENT_H
+
+#include "zcl.h"
+
+#define ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE 0x0505
+#define ATTRID_ELECTRICAL_MEASUREMENT_RMS_CURRENT 0x0508
+#define ATTRID_ELECTRICAL_MEASUREMENT_ACTIVE_POWER 0x050B
+#define ATTRID_ELECTRICAL_MEASUREMENT_AC_VOLTAGE_MULTIPLIER 0x0600
+#define ATTRID_ELECTRICAL_MEASUREMENT_AC_VOLTAGE_DIVISOR 0x0601
+#define ATTRID_ELECTRICAL_MEASUREMENT_AC_CURRENT_MULTIPLIER 0x0602
+#define ATTRID_ELECTRICAL_MEASUREMENT_AC_CURRENT_DIVISOR 0x0603
+#define ATTRID_ELECTRICAL_MEASUREMENT_AC_POWER_MULTIPLIER 0x0604
+#define ATTRID_ELECTRICAL_MEASUREMENT_AC_POWER_DIVISOR 0x0605
+#define ATTRID_ELECTRICAL_MEASUREMENT_AC_ALARMS_MASK 0x0800
+#define ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE_SAG_PERIOD 0x0809
+#define ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE_SWELL_PERIOD 0x080A
+
+#endif // ZCL_ELECTRICAL_MEASUREMENT_H
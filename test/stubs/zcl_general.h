@@ -0,0 +1,55 @@
+#ifndef ZCL_GENERAL_H
+#define ZCL_GENERAL_H
+
+#include "zcl.h"
+
+// Basic
+#define ATTRID_BASIC_ZCL_VERSION 0x0000
+#define ATTRID_BASIC_APPL_VERSION 0x0001
+#define ATTRID_BASIC_STACK_VERSION 0x0002
+#define ATTRID_BASIC_HW_VERSION 0x0003
+#define ATTRID_BASIC_MANUFACTURER_NAME 0x0004
+#define ATTRID_BASIC_MODEL_ID 0x0005
+#define ATTRID_BASIC_DATE_CODE 0x0006
+#define ATTRID_BASIC_POWER_SOURCE 0x0007
+#define ATTRID_BASIC_SW_BUILD_ID 0x4000
+
+#define POWER_SOURCE_MAINS_1_PHASE 0x01
+
+// On/Off
+#define COMMAND_ON_OFF_OFF 0x00
+#define COMMAND_ON_OFF_ON 0x01
+
+// Alarms
+#define COMMAND_ALARMS_ALARM 0x00
+
+// Time
+#define ATTRID_TIME_TIME 0x0000
+#define ATTRID_TIME_STATUS 0x0001
+#define ATTRID_TIME_TIME_ZONE 0x0002
+#define ATTRID_TIME_LOCAL_TIME 0x0007
+
+typedef void (*zclGCB_BasicReset_t)(void);
+
+typedef struct {
+    zclGCB_BasicReset_t pfnBasicReset;
+    void *pfnIdentifyTriggerEffect;
+    void *pfnOnOff;
+    void *pfnOnOff_OffWithEffect;
+    void *pfnOnOff_OnWithRecallGlobalScene;
+    void *pfnOnOff_OnWithTimedOff;
+    void *pfnLocation;
+    void *pfnLocationRsp;
+} zclGeneral_AppCallbacks_t;
+
+extern ZStatus_t zclGeneral_RegisterCmdCallbacks(uint8 endpoint, zclGeneral_AppCallbacks_t *callbacks);
+
+#define zclGeneral_SendOnOff_CmdOff(a, b, c, d)                                                                                            \
+    zcl_SendCommand((a), (b), ZCL_CLUSTER_ID_GEN_ON_OFF, COMMAND_ON_OFF_OFF, TRUE, ZCL_FRAME_CLIENT_SERVER_DIR, (c), 0, (d), 0, NULL)
+#define zclGeneral_SendOnOff_CmdOn(a, b, c, d)                                                                                             \
+    zcl_SendCommand((a), (b), ZCL_CLUSTER_ID_GEN_ON_OFF, COMMAND_ON_OFF_ON, TRUE, ZCL_FRAME_CLIENT_SERVER_DIR, (c), 0, (d), 0, NULL)
+
+extern ZStatus_t zclGeneral_SendAlarm(uint8 srcEP, afAddrType_t *dstAddr, uint8 alarmCode, uint16 clusterID, uint8 disableDefaultRsp,
+                                      uint8 seqNum);
+
+#endif // ZCL_GENERAL_H
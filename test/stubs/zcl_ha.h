@@ -0,0 +1,9 @@
+#ifndef ZCL_HA_H
+#define ZCL_HA_H
+
+#include "zcl.h"
+
+#define ZCL_HA_PROFILE_ID 0x0104
+#define ZCL_HA_DEVICEID_SIMPLE_SENSOR 0x000C
+
+#endif // ZCL_HA_H
@@ -0,0 +1,8 @@
+#ifndef ZCL_MS_H
+#define ZCL_MS_H
+
+#include "zcl.h"
+
+#define ATTRID_MS_TEMPERATURE_MEASURED_VALUE 0x0000
+
+#endif // ZCL_MS_H
@@ -0,0 +1,6 @@
+#ifndef ZCL_SE_H
+#define ZCL_SE_H
+
+#include "zcl.h"
+
+#endif // ZCL_SE_H
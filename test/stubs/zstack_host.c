@@ -0,0 +1,356 @@
+#include "ZDApp.h"
+#include "bdb_interface.h"
+#include "commissioning.h"
+#include "factory_reset.h"
+#include "host.h"
+#include "zcl_diagnostic.h"
+#include "zcl_general.h"
+#include <string.h>
+
+#define HOST_ZCL_MAX_ENDPOINTS 4
+#define HOST_ZCL_MAX_PLUGINS 4
+
+typedef struct {
+    uint8 Endpoint;
+    uint8 NumAttr;
+    zclAttrRec_t const *Attrs;
+    zclAuthorizeCB_t Authorize;
+} hostZclEndpoint_t;
+
+typedef struct {
+    uint16 Start;
+    uint16 End;
+    zclInHdlr_t Handler;
+} hostZclPlugin_t;
+
+static hostZclEndpoint_t hostZcl_Endpoints[HOST_ZCL_MAX_ENDPOINTS];
+static hostZclPlugin_t hostZcl_Plugins[HOST_ZCL_MAX_PLUGINS];
+static hostZclFrame_t hostZcl_Frames[HOST_ZCL_MAX_FRAMES];
+static uint8 hostZcl_Frames_Count = 0;
+static uint8 hostZcl_Seq = 0;
+static uint8 hostZcl_MsgTask = 0xFF;
+
+ZStatus_t hostZcl_SendStatus = ZSuccess;
+uint16 hostZcl_ChangedAttrs = 0;
+uint8 hostNwk_ExtAddr[Z_EXTADDR_LEN] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+devStates_t devState = DEV_HOLD;
+
+rejoin_t zclCommissioning_Rejoin = {.Stage = REJOIN_STAGE_IDLE, .Parent = REJOIN_NO_PARENT};
+uint16 hostCommissioning_PollRate = POLL_RATE;
+uint16 hostCommissioning_FastPolls = 0;
+static zclCommissioning_ConnectCB_t hostCommissioning_ConnectCB = NULL;
+
+static hostZclEndpoint_t *hostZcl_Endpoint(uint8 endpoint);
+static hostZclFrame_t *hostZcl_NewFrame(uint8 endpoint, afAddrType_t *dstAddr, uint16 clusterId, uint8 commandId);
+
+/*********************************************************************
+ * Test control
+ */
+void hostZcl_Reset(void) {
+    memset(hostZcl_Endpoints, 0, sizeof(hostZcl_Endpoints));
+    memset(hostZcl_Plugins, 0, sizeof(hostZcl_Plugins));
+    hostZcl_Frames_Count = 0;
+    hostZcl_SendStatus = ZSuccess;
+    hostZcl_ChangedAttrs = 0;
+    hostZcl_MsgTask = 0xFF;
+    hostCommissioning_ConnectCB = NULL;
+    hostCommissioning_PollRate = POLL_RATE;
+    hostCommissioning_FastPolls = 0;
+}
+
+uint8 hostZcl_FrameCount(void) { return hostZcl_Frames_Count; }
+
+hostZclFrame_t const *hostZcl_Frame(uint8 index) { return index < hostZcl_Frames_Count ? &hostZcl_Frames[index] : NULL; }
+
+// the latest frame of the cluster and command
+hostZclFrame_t const *hostZcl_FindFrame(uint16 clusterId, uint8 commandId) {
+    for (uint8 i = hostZcl_Frames_Count; i > 0; i--) {
+        hostZclFrame_t const *frame = &hostZcl_Frames[i - 1];
+        if (frame->ClusterId == clusterId && frame->CommandId == commandId) {
+            return frame;
+        }
+    }
+    return NULL;
+}
+
+zclAttrRec_t const *hostZcl_FindAttr(uint8 endpoint, uint16 clusterId, uint16 attrId) {
+    hostZclEndpoint_t *ep = hostZcl_Endpoint(endpoint);
+
+    for (uint8 i = 0; ep != NULL && i < ep->NumAttr; i++) {
+        if (ep->Attrs[i].clusterID == clusterId && ep->Attrs[i].attr.attrId == attrId) {
+            return &ep->Attrs[i];
+        }
+    }
+    return NULL;
+}
+
+// what the ZCL task does before serving a read or write of an AUTH attribute
+ZStatus_t hostZcl_Authorize(uint8 endpoint, uint16 clusterId, uint16 attrId, uint8 oper) {
+    hostZclEndpoint_t *ep = hostZcl_Endpoint(endpoint);
+    zclAttrRec_t attr;
+    afAddrType_t srcAddr = {.addrMode = afAddr16Bit, .endPoint = 1, .addr.shortAddr = 0x0000};
+
+    if (ep == NULL || ep->Authorize == NULL || hostZcl_FindAttr(endpoint, clusterId, attrId) == NULL) {
+        return ZCL_STATUS_UNSUPPORTED_ATTRIBUTE;
+    }
+    attr = *hostZcl_FindAttr(endpoint, clusterId, attrId);
+    return ep->Authorize(&srcAddr, &attr, oper);
+}
+
+// cluster specific command from the coordinator
+ZStatus_t hostZcl_Command(uint8 endpoint, uint16 clusterId, uint8 commandId, uint8 *payload, uint16 len) {
+    afIncomingMSGPacket_t msg;
+    zclIncoming_t inMsg;
+
+    memset(&msg, 0, sizeof(msg));
+    memset(&inMsg, 0, sizeof(inMsg));
+    msg.clusterId = clusterId;
+    msg.endPoint = endpoint;
+    msg.srcAddr.addrMode = afAddr16Bit;
+    msg.srcAddr.endPoint = 1;
+    msg.srcAddr.addr.shortAddr = 0x0000;
+    inMsg.msg = &msg;
+    inMsg.hdr.fc.type = 1;
+    inMsg.hdr.fc.direction = ZCL_FRAME_CLIENT_SERVER_DIR;
+    inMsg.hdr.transSeqNum = hostZcl_Seq++;
+    inMsg.hdr.commandID = commandId;
+    inMsg.pData = payload;
+    inMsg.pDataLen = len;
+
+    for (uint8 i = 0; i < HOST_ZCL_MAX_PLUGINS; i++) {
+        hostZclPlugin_t *plugin = &hostZcl_Plugins[i];
+        if (plugin->Handler != NULL && clusterId >= plugin->Start && clusterId <= plugin->End) {
+            return plugin->Handler(&inMsg);
+        }
+    }
+    return ZCL_STATUS_UNSUP_CLUSTER_COMMAND;
+}
+
+// what the ZCL task posts for a Read Attributes response, the receiver frees attrCmd
+void hostZcl_TimeResponse(uint16 srcAddr, uint32 time) {
+    zclIncomingMsg_t *msg = (zclIncomingMsg_t *)osal_msg_allocate(sizeof(zclIncomingMsg_t));
+    zclReadRspCmd_t *rsp = osal_mem_alloc(sizeof(zclReadRspCmd_t) + sizeof(zclReadRspStatus_t) + sizeof(time));
+    uint8 *data = (uint8 *)&rsp->attrList[1];
+
+    data[0] = BREAK_UINT32(time, 0);
+    data[1] = BREAK_UINT32(time, 1);
+    data[2] = BREAK_UINT32(time, 2);
+    data[3] = BREAK_UINT32(time, 3);
+    rsp->numAttr = 1;
+    rsp->attrList[0] = (zclReadRspStatus_t){.attrID = ATTRID_TIME_TIME, .status = ZCL_STATUS_SUCCESS, .dataType = ZCL_DATATYPE_UTC, .data = data};
+    msg->hdr.event = ZCL_INCOMING_MSG;
+    msg->zclHdr.commandID = ZCL_CMD_READ_RSP;
+    msg->clusterId = ZCL_CLUSTER_ID_GEN_TIME;
+    msg->srcAddr.addrMode = afAddr16Bit;
+    msg->srcAddr.endPoint = 1;
+    msg->srcAddr.addr.shortAddr = srcAddr;
+    msg->endPoint = 1;
+    msg->attrCmd = rsp;
+    osal_msg_send(hostZcl_MsgTask, (uint8 *)msg);
+}
+
+static hostZclEndpoint_t *hostZcl_Endpoint(uint8 endpoint) {
+    for (uint8 i = 0; i < HOST_ZCL_MAX_ENDPOINTS; i++) {
+        if (hostZcl_Endpoints[i].Endpoint == endpoint && endpoint != 0) {
+            return &hostZcl_Endpoints[i];
+        }
+    }
+    for (uint8 i = 0; i < HOST_ZCL_MAX_ENDPOINTS; i++) {
+        if (hostZcl_Endpoints[i].Endpoint == 0) {
+            hostZcl_Endpoints[i].Endpoint = endpoint;
+            return &hostZcl_Endpoints[i];
+        }
+    }
+    return NULL;
+}
+
+static hostZclFrame_t *hostZcl_NewFrame(uint8 endpoint, afAddrType_t *dstAddr, uint16 clusterId, uint8 commandId) {
+    hostZclFrame_t *frame;
+
+    if (hostZcl_Frames_Count == HOST_ZCL_MAX_FRAMES) {
+        // keep the latest ones
+        memmove(hostZcl_Frames, &hostZcl_Frames[1], sizeof(hostZcl_Frames) - sizeof(hostZcl_Frames[0]));
+        hostZcl_Frames_Count--;
+    }
+    frame = &hostZcl_Frames[hostZcl_Frames_Count++];
+    memset(frame, 0, sizeof(*frame));
+    frame->Endpoint = endpoint;
+    frame->ClusterId = clusterId;
+    frame->CommandId = commandId;
+    frame->AddrMode = dstAddr->addrMode;
+    frame->ShortAddr = dstAddr->addr.shortAddr;
+    return frame;
+}
+
+/*********************************************************************
+ * ZCL
+ */
+ZStatus_t zcl_registerPlugin(uint16 startClusterID, uint16 endClusterID, zclInHdlr_t pfnIncomingHdlr) {
+    for (uint8 i = 0; i < HOST_ZCL_MAX_PLUGINS; i++) {
+        if (hostZcl_Plugins[i].Handler == NULL) {
+            hostZcl_Plugins[i] = (hostZclPlugin_t){startClusterID, endClusterID, pfnIncomingHdlr};
+            return ZSuccess;
+        }
+    }
+    return ZMemError;
+}
+
+ZStatus_t zcl_registerAttrList(uint8 endpoint, uint8 numAttr, const zclAttrRec_t attrList[]) {
+    hostZclEndpoint_t *ep = hostZcl_Endpoint(endpoint);
+
+    if (ep == NULL) {
+        return ZMemError;
+    }
+    ep->NumAttr = numAttr;
+    ep->Attrs = attrList;
+    return ZSuccess;
+}
+
+ZStatus_t zcl_registerReadWriteCB(uint8 endpoint, zclReadWriteCB_t pfnReadWriteCB, zclAuthorizeCB_t pfnAuthorizeCB) {
+    hostZclEndpoint_t *ep = hostZcl_Endpoint(endpoint);
+
+    (void)pfnReadWriteCB;
+    if (ep == NULL) {
+        return ZMemError;
+    }
+    ep->Authorize = pfnAuthorizeCB;
+    return ZSuccess;
+}
+
+uint8 zcl_registerForMsg(uint8 taskId) {
+    hostZcl_MsgTask = taskId;
+    return TRUE;
+}
+
+ZStatus_t zcl_SendCommand(uint8 srcEP, afAddrType_t *dstAddr, uint16 clusterID, uint8 cmd, uint8 specific, uint8 direction,
+                          uint8 disableDefaultRsp, uint16 manuCode, uint8 seqNum, uint16 cmdFormatLen, uint8 *cmdFormat) {
+    hostZclFrame_t *frame = hostZcl_NewFrame(srcEP, dstAddr, clusterID, cmd);
+
+    (void)direction;
+    (void)disableDefaultRsp;
+    (void)manuCode;
+    (void)seqNum;
+    frame->Specific = specific;
+    frame->PayloadLen = MIN(cmdFormatLen, HOST_ZCL_MAX_PAYLOAD);
+    if (cmdFormat != NULL) {
+        memcpy(frame->Payload, cmdFormat, frame->PayloadLen);
+    }
+    return ZSuccess;
+}
+
+ZStatus_t zcl_SendRead(uint8 srcEP, afAddrType_t *dstAddr, uint16 realClusterID, zclReadCmd_t *readCmd, uint8 direction,
+                       uint8 disableDefaultRsp, uint8 seqNum) {
+    hostZclFrame_t *frame = hostZcl_NewFrame(srcEP, dstAddr, realClusterID, ZCL_CMD_READ);
+
+    (void)direction;
+    (void)disableDefaultRsp;
+    (void)seqNum;
+    frame->NumAttr = MIN(readCmd->numAttr, HOST_ZCL_MAX_ATTRS);
+    for (uint8 i = 0; i < frame->NumAttr; i++) {
+        frame->AttrId[i] = readCmd->attrID[i];
+    }
+    return ZSuccess;
+}
+
+ZStatus_t zcl_SendReportCmd(uint8 srcEP, afAddrType_t *dstAddr, uint16 clusterID, zclReportCmd_t *reportCmd, uint8 direction,
+                            uint8 disableDefaultRsp, uint8 seqNum) {
+    hostZclFrame_t *frame;
+
+    (void)direction;
+    (void)disableDefaultRsp;
+    (void)seqNum;
+    if (hostZcl_SendStatus != ZSuccess) {
+        return hostZcl_SendStatus;
+    }
+    frame = hostZcl_NewFrame(srcEP, dstAddr, clusterID, ZCL_CMD_REPORT);
+    frame->NumAttr = MIN(reportCmd->numAttr, HOST_ZCL_MAX_ATTRS);
+    for (uint8 i = 0; i < frame->NumAttr; i++) {
+        zclReport_t *attr = &reportCmd->attrList[i];
+        uint8 size = 4;
+        switch (attr->dataType) {
+        case ZCL_DATATYPE_UINT8:
+        case ZCL_DATATYPE_INT8:
+        case ZCL_DATATYPE_ENUM8:
+            size = 1;
+            break;
+        case ZCL_DATATYPE_UINT16:
+        case ZCL_DATATYPE_INT16:
+        case ZCL_DATATYPE_BITMAP16:
+            size = 2;
+            break;
+        default:
+            break;
+        }
+        frame->AttrId[i] = attr->attrID;
+        memcpy(&frame->AttrValue[i], attr->attrData, size);
+    }
+    return ZSuccess;
+}
+
+ZStatus_t zclGeneral_RegisterCmdCallbacks(uint8 endpoint, zclGeneral_AppCallbacks_t *callbacks) {
+    (void)endpoint;
+    (void)callbacks;
+    return ZSuccess;
+}
+
+ZStatus_t zclGeneral_SendAlarm(uint8 srcEP, afAddrType_t *dstAddr, uint8 alarmCode, uint16 clusterID, uint8 disableDefaultRsp,
+                               uint8 seqNum) {
+    uint8 payload[3] = {alarmCode, LO_UINT16(clusterID), HI_UINT16(clusterID)};
+    return zcl_SendCommand(srcEP, dstAddr, ZCL_CLUSTER_ID_GEN_ALARMS, COMMAND_ALARMS_ALARM, TRUE, ZCL_FRAME_SERVER_CLIENT_DIR,
+                           disableDefaultRsp, 0, seqNum, sizeof(payload), payload);
+}
+
+uint8 zclDiagnostic_InitStats(void) { return ZSuccess; }
+
+ZStatus_t zclDiagnostic_ReadWriteAttrCB(uint16 clusterId, uint16 attrId, uint8 oper, uint8 *pValue, uint16 *pLen) {
+    (void)clusterId;
+    (void)attrId;
+    (void)oper;
+    (void)pValue;
+    (void)pLen;
+    return ZFailure;
+}
+
+/*********************************************************************
+ * BDB / NWK
+ */
+void bdb_RegisterSimpleDescriptor(SimpleDescriptionFormat_t *simpleDesc) { (void)simpleDesc; }
+
+void bdb_RepChangedAttrValue(uint8 endpoint, uint16 cluster, uint16 attrID) {
+    (void)endpoint;
+    (void)cluster;
+    (void)attrID;
+    hostZcl_ChangedAttrs++;
+}
+
+uint8 bdb_getZCLFrameCounter(void) { return hostZcl_Seq++; }
+
+uint8 *NLME_GetExtAddr(void) { return hostNwk_ExtAddr; }
+
+uint16 NLME_GetShortAddr(void) { return 0x1234; }
+
+/*********************************************************************
+ * Commissioning and factory reset, their state machines need the real stack
+ */
+void hostCommissioning_Connect(void) {
+    devState = DEV_END_DEVICE;
+    if (hostCommissioning_ConnectCB != NULL) {
+        hostCommissioning_ConnectCB();
+    }
+}
+
+void zclCommissioning_RegisterConnectCB(zclCommissioning_ConnectCB_t cb) { hostCommissioning_ConnectCB = cb; }
+
+void zclCommissioning_SetPollRate(uint16 rate) { hostCommissioning_PollRate = rate; }
+
+void zclCommissioning_FastPoll(void) { hostCommissioning_FastPolls++; }
+
+void zclCommissioning_HandleKeys(uint8 portAndAction, uint8 keyCode) {
+    (void)portAndAction;
+    (void)keyCode;
+}
+
+void zclFactoryResetter_HandleKeys(uint8 portAndAction, uint8 keyCode) {
+    (void)portAndAction;
+    (void)keyCode;
+}
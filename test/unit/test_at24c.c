@@ -0,0 +1,106 @@
+#include "at24c.h"
+#include "eeprom_i2c.h"
+#include "eeprom_log.h"
+#include "unit.h"
+#include <string.h>
+
+static void test_at24c_ReadWrite(void) {
+    uint8 data[AT24C_PAGE_SIZE];
+    uint8 back[AT24C_PAGE_SIZE];
+
+    eepromI2c_Reset();
+    for (uint8 i = 0; i < sizeof(data); i++) {
+        data[i] = i;
+    }
+    // word address goes high byte first
+    UNIT_EQUAL(EEPROM_SUCCESS, at24c_dev.Write(0x1240, data, sizeof(data)));
+    UNIT_EQUAL(0x1240, eepromI2c_LastAddress);
+    UNIT_EQUAL(0, eepromI2c_Memory[0x1240]);
+    UNIT_EQUAL(63, eepromI2c_Memory[0x127F]);
+    UNIT_EQUAL(0xFF, eepromI2c_Memory[0x1280]);
+
+    UNIT_EQUAL(EEPROM_SUCCESS, at24c_dev.Read(0x1250, back, 16));
+    UNIT_CHECK(memcmp(&data[16], back, 16) == 0);
+
+    // sequential read rolls over at the end of memory
+    eepromI2c_Memory[0] = 0xA5;
+    UNIT_EQUAL(EEPROM_SUCCESS, at24c_dev.Read((uint16)(AT24C_SIZE - 1), back, 2));
+    UNIT_EQUAL(0xFF, back[0]);
+    UNIT_EQUAL(0xA5, back[1]);
+}
+
+static void test_at24c_PageBoundary(void) {
+    uint8 data[AT24C_PAGE_SIZE + 1];
+
+    eepromI2c_Reset();
+    memset(data, 0x11, sizeof(data));
+    // the part would wrap to the start of the page, the driver refuses instead
+    UNIT_EQUAL(EEPROM_ERROR, at24c_dev.Write(0x0030, data, 32));
+    UNIT_EQUAL(EEPROM_ERROR, at24c_dev.Write(0x0000, data, sizeof(data)));
+    UNIT_EQUAL(0, eepromI2c_Transfers);
+    UNIT_EQUAL(0xFF, eepromI2c_Memory[0x0000]);
+
+    UNIT_EQUAL(EEPROM_SUCCESS, at24c_dev.Write(0x0030, data, 16));
+    UNIT_EQUAL(0x11, eepromI2c_Memory[0x003F]);
+    UNIT_EQUAL(0xFF, eepromI2c_Memory[0x0040]);
+}
+
+static void test_at24c_WriteCycle(void) {
+    uint8 data[4] = {1, 2, 3, 4};
+    uint8 back[4];
+
+    eepromI2c_Reset();
+    // Write returns only once the part acknowledges again, the next read needs no retry
+    eepromI2c_SetWriteCycle(5);
+    UNIT_EQUAL(EEPROM_SUCCESS, at24c_dev.Write(0x0100, data, sizeof(data)));
+    UNIT_EQUAL(6, eepromI2c_AckPolls);
+    UNIT_EQUAL(EEPROM_SUCCESS, at24c_dev.Read(0x0100, back, sizeof(back)));
+    UNIT_CHECK(memcmp(data, back, sizeof(data)) == 0);
+
+    // part stuck in its write cycle
+    eepromI2c_SetWriteCycle(1000);
+    UNIT_EQUAL(EEPROM_ERROR, at24c_dev.Write(0x0100, data, sizeof(data)));
+}
+
+static void test_at24c_Absent(void) {
+    uint8 data[4] = {1, 2, 3, 4};
+
+    eepromI2c_Reset();
+    eepromI2c_SetPresent(false);
+    UNIT_EQUAL(EEPROM_ERROR, at24c_dev.Write(0x0000, data, sizeof(data)));
+    UNIT_EQUAL(EEPROM_ERROR, at24c_dev.Read(0x0000, data, sizeof(data)));
+    UNIT_EQUAL(0, eepromI2c_Transfers);
+}
+
+// the log on the real driver, down to the bus
+static void test_at24c_Log(void) {
+    uint8 payload[EEPROM_LOG_PAYLOAD_SIZE];
+    eepromLogRecord_t record;
+
+    eepromI2c_Reset();
+    zclEepromLog_Init(&at24c_dev);
+    UNIT_EQUAL((AT24C_SIZE - AT24C_PAGE_SIZE) / EEPROM_LOG_RECORD_SIZE, zclEepromLog_Capacity());
+    for (uint8 i = 1; i <= 18; i++) {
+        memset(payload, i, sizeof(payload));
+        UNIT_EQUAL(EEPROM_SUCCESS, zclEepromLog_Append(5000 + i, payload));
+    }
+
+    zclEepromLog_Init(&at24c_dev);
+    UNIT_EQUAL(18, zclEepromLog_Count());
+    UNIT_EQUAL(EEPROM_SUCCESS, zclEepromLog_Read(0, &record));
+    UNIT_EQUAL(18, record.Seq);
+    UNIT_EQUAL(5018, record.Time);
+    UNIT_EQUAL(18, record.Payload[0]);
+
+    eepromI2c_SetPresent(false);
+    UNIT_EQUAL(EEPROM_ERROR, zclEepromLog_Append(6000, payload));
+    UNIT_EQUAL(18, zclEepromLog_Count());
+}
+
+void test_at24c(void) {
+    test_at24c_ReadWrite();
+    test_at24c_PageBoundary();
+    test_at24c_WriteCycle();
+    test_at24c_Absent();
+    test_at24c_Log();
+}
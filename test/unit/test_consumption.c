@@ -0,0 +1,81 @@
+#include "OSAL_Nv.h"
+#include "consumption.h"
+#include "host.h"
+#include "unit.h"
+#include <string.h>
+
+#define JAN_31_NOON ((uint32)760017600)    // 2024-01-31 12:00
+#define FEB_01_0030 ((uint32)760062600)    // 2024-02-01 00:30
+#define FEB_03_10AM ((uint32)760269600)    // 2024-02-03 10:00
+
+// an item the first boot creates holds no snapshots, not erased flash
+static void test_consumption_Blank(void) {
+    uint8 erased[64];
+
+    hostNv_Reset();
+    zclConsumption_Init();
+    zclConsumption_Init();
+    UNIT_EQUAL(0, zclConsumption.PreviousDay);
+    UNIT_EQUAL(0, zclConsumption.PreviousMonth);
+
+    // left erased by an earlier build
+    memset(erased, 0xFF, sizeof(erased));
+    osal_nv_write(CONSUMPTION_NV_ID, 0, osal_nv_item_len(CONSUMPTION_NV_ID), erased);
+    zclConsumption_Init();
+    UNIT_EQUAL(0, zclConsumption.PreviousDay);
+    UNIT_EQUAL(0, zclConsumption.PreviousMonth);
+    uint32 tiers[CONSUMPTION_TIERS] = {1000, 2000, 0, 0};
+    zclConsumption_Refresh(tiers);
+    UNIT_EQUAL(0, zclConsumption.CurrentDay);
+    UNIT_EQUAL(0, zclConsumption.CurrentMonth);
+    hostNv_Reset();
+}
+
+void test_consumption(void) {
+    uint32 tiers[CONSUMPTION_TIERS] = {1000, 2000, 0, 0};
+
+    test_consumption_Blank();
+    zclConsumption_Init();
+    zclConsumption_Update(tiers, JAN_31_NOON);
+    UNIT_EQUAL(0, zclConsumption.CurrentDay);
+    UNIT_EQUAL(0, zclConsumption.PreviousDay);
+
+    tiers[0] += 70;
+    tiers[1] += 30;
+    zclConsumption_Update(tiers, JAN_31_NOON + 3600);
+    UNIT_EQUAL(100, zclConsumption.CurrentDay);
+    UNIT_EQUAL(100, zclConsumption.CurrentMonth);
+
+    // midnight and the first of the month
+    tiers[0] += 5;
+    uint32 writes = hostNv_Writes;
+    zclConsumption_Update(tiers, FEB_01_0030);
+    UNIT_EQUAL(writes + 1, hostNv_Writes);
+    UNIT_EQUAL(105, zclConsumption.PreviousDay);
+    UNIT_EQUAL(0, zclConsumption.CurrentDay);
+    UNIT_EQUAL(105, zclConsumption.PreviousMonth);
+    UNIT_EQUAL(0, zclConsumption.CurrentMonth);
+
+    // snapshots survive a reboot, current figures come back before the clock is synced
+    zclConsumption.PreviousDay = 0;
+    zclConsumption.CurrentDay = 0;
+    zclConsumption_Init();
+    UNIT_EQUAL(105, zclConsumption.PreviousDay);
+    tiers[1] += 10;
+    zclConsumption_Refresh(tiers);
+    UNIT_EQUAL(10, zclConsumption.CurrentDay);
+    UNIT_EQUAL(10, zclConsumption.CurrentMonth);
+    zclConsumption_Update(tiers, FEB_01_0030 + 60);
+    UNIT_EQUAL(10, zclConsumption.CurrentDay);
+
+    // a skipped day leaves the previous day unknown, the month goes on
+    zclConsumption_Update(tiers, FEB_03_10AM);
+    UNIT_EQUAL(0, zclConsumption.PreviousDay);
+    UNIT_EQUAL(10, zclConsumption.CurrentMonth);
+
+    // meter replaced, registers went back
+    tiers[0] = 0;
+    tiers[1] = 0;
+    zclConsumption_Update(tiers, FEB_03_10AM + 60);
+    UNIT_EQUAL(0, zclConsumption.CurrentDay);
+}
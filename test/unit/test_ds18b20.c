@@ -0,0 +1,26 @@
+#include "ds18b20.h"
+#include "unit.h"
+
+void test_ds18b20(void) {
+    // datasheet table, 12 bit
+    UNIT_EQUAL(12500, ds18b20_convertTemperature(0xD0, 0x07, DS18B20_TEMP_12_BIT));
+    UNIT_EQUAL(8500, ds18b20_convertTemperature(0x50, 0x05, DS18B20_TEMP_12_BIT));
+    UNIT_EQUAL(2506, ds18b20_convertTemperature(0x91, 0x01, DS18B20_TEMP_12_BIT));
+    UNIT_EQUAL(50, ds18b20_convertTemperature(0x08, 0x00, DS18B20_TEMP_12_BIT));
+    UNIT_EQUAL(0, ds18b20_convertTemperature(0x00, 0x00, DS18B20_TEMP_12_BIT));
+    UNIT_EQUAL(-50, ds18b20_convertTemperature(0xF8, 0xFF, DS18B20_TEMP_12_BIT));
+    UNIT_EQUAL(-1012, ds18b20_convertTemperature(0x5E, 0xFF, DS18B20_TEMP_12_BIT));
+    UNIT_EQUAL(-2506, ds18b20_convertTemperature(0x6F, 0xFE, DS18B20_TEMP_12_BIT));
+    UNIT_EQUAL(-5500, ds18b20_convertTemperature(0x90, 0xFC, DS18B20_TEMP_12_BIT));
+
+    // undefined low bits are dropped, the high byte is kept whole
+    UNIT_EQUAL(8500, ds18b20_convertTemperature(0x50, 0x05, DS18B20_TEMP_10_BIT));
+    UNIT_EQUAL(2500, ds18b20_convertTemperature(0x93, 0x01, DS18B20_TEMP_10_BIT));
+    UNIT_EQUAL(-1025, ds18b20_convertTemperature(0x5F, 0xFF, DS18B20_TEMP_10_BIT));
+    UNIT_EQUAL(2500, ds18b20_convertTemperature(0x97, 0x01, DS18B20_TEMP_9_BIT));
+    UNIT_EQUAL(-1050, ds18b20_convertTemperature(0x5F, 0xFF, DS18B20_TEMP_9_BIT));
+    UNIT_EQUAL(2500, ds18b20_convertTemperature(0x91, 0x01, DS18B20_TEMP_11_BIT));
+
+    // the line stub never pulls low: no presence, no data
+    UNIT_EQUAL(1, readTemperature());
+}
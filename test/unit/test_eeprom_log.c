@@ -0,0 +1,84 @@
+#include "eeprom_log.h"
+#include "eeprom_ram.h"
+#include "unit.h"
+#include <string.h>
+
+static void test_eeprom_log_Payload(uint8 *payload, uint8 value) { memset(payload, value, EEPROM_LOG_PAYLOAD_SIZE); }
+
+static void test_eeprom_log_AppendRead(void) {
+    uint8 payload[EEPROM_LOG_PAYLOAD_SIZE];
+    eepromLogRecord_t record;
+
+    eepromRam_Reset();
+    zclEepromLog_Init(&eepromRam_dev);
+    UNIT_EQUAL((EEPROM_RAM_SIZE - EEPROM_RAM_PAGE_SIZE) / EEPROM_LOG_RECORD_SIZE, zclEepromLog_Capacity());
+    UNIT_EQUAL(0, zclEepromLog_Count());
+    UNIT_EQUAL(EEPROM_ERROR, zclEepromLog_Read(0, &record));
+
+    for (uint8 i = 1; i <= 20; i++) {
+        test_eeprom_log_Payload(payload, i);
+        UNIT_EQUAL(EEPROM_SUCCESS, zclEepromLog_Append(1000 + i, payload));
+    }
+    UNIT_EQUAL(20, zclEepromLog_Count());
+    UNIT_EQUAL(EEPROM_SUCCESS, zclEepromLog_Read(0, &record));
+    UNIT_EQUAL(20, record.Seq);
+    UNIT_EQUAL(1020, record.Time);
+    UNIT_EQUAL(20, record.Payload[EEPROM_LOG_PAYLOAD_SIZE - 1]);
+    UNIT_EQUAL(EEPROM_SUCCESS, zclEepromLog_Read(19, &record));
+    UNIT_EQUAL(1, record.Seq);
+
+    // header holds 16, the records after it are found by sequence
+    zclEepromLog_Init(&eepromRam_dev);
+    UNIT_EQUAL(20, zclEepromLog_Count());
+    zclEepromLog_Read(0, &record);
+    UNIT_EQUAL(20, record.Seq);
+}
+
+static void test_eeprom_log_PowerCut(void) {
+    uint8 payload[EEPROM_LOG_PAYLOAD_SIZE];
+    eepromLogRecord_t record;
+
+    test_eeprom_log_Payload(payload, 0xAA);
+    eepromRam_CutPowerAfter(EEPROM_LOG_RECORD_SIZE / 2);
+    UNIT_EQUAL(EEPROM_ERROR, zclEepromLog_Append(2000, payload));
+
+    // torn record is ignored after the reboot and rewritten by the next append
+    eepromRam_SetOffline(false);
+    zclEepromLog_Init(&eepromRam_dev);
+    UNIT_EQUAL(20, zclEepromLog_Count());
+    UNIT_EQUAL(EEPROM_SUCCESS, zclEepromLog_Append(2001, payload));
+    zclEepromLog_Read(0, &record);
+    UNIT_EQUAL(21, record.Seq);
+    UNIT_EQUAL(2001, record.Time);
+
+    eepromRam_SetOffline(true);
+    UNIT_EQUAL(EEPROM_ERROR, zclEepromLog_Append(2002, payload));
+    UNIT_EQUAL(21, zclEepromLog_Count());
+    eepromRam_SetOffline(false);
+}
+
+static void test_eeprom_log_Wrap(void) {
+    uint8 payload[EEPROM_LOG_PAYLOAD_SIZE];
+    eepromLogRecord_t record;
+    uint16 capacity = zclEepromLog_Capacity();
+
+    eepromRam_Reset();
+    zclEepromLog_Init(&eepromRam_dev);
+    test_eeprom_log_Payload(payload, 0x55);
+    for (uint16 i = 1; i <= capacity + 10; i++) {
+        zclEepromLog_Append(i, payload);
+    }
+    UNIT_EQUAL(capacity, zclEepromLog_Count());
+    zclEepromLog_Init(&eepromRam_dev);
+    UNIT_EQUAL(capacity, zclEepromLog_Count());
+    zclEepromLog_Read(0, &record);
+    UNIT_EQUAL(capacity + 10, record.Time);
+    zclEepromLog_Read(capacity - 1, &record);
+    UNIT_EQUAL(11, record.Time);
+}
+
+void test_eeprom_log(void) {
+    test_eeprom_log_AppendRead();
+    test_eeprom_log_PowerCut();
+    test_eeprom_log_Wrap();
+}
@@ -0,0 +1,50 @@
+#include "load_limit.h"
+#include "unit.h"
+
+static void test_load_limit_Power(void) {
+    loadLimitConfig_t config = {.PowerLimit = 3000, .CurrentLimit = 0, .Hysteresis = 10, .HoldTime = 5, .FastPollPeriod = 5};
+    loadLimit_t limit = {.State = LOAD_LIMIT_NORMAL};
+
+    UNIT_EQUAL(LOAD_LIMIT_ACTION_NONE, zclLoadLimit_Update(&limit, &config, 2000, 0, 0));
+    UNIT_CHECK(!zclLoadLimit_NeedsFastPoll(&limit));
+    // between the restore level and the limit
+    UNIT_EQUAL(LOAD_LIMIT_ACTION_NONE, zclLoadLimit_Update(&limit, &config, 2900, 0, 1000));
+    UNIT_EQUAL(LOAD_LIMIT_NORMAL, limit.State);
+    UNIT_CHECK(zclLoadLimit_NeedsFastPoll(&limit));
+
+    UNIT_EQUAL(LOAD_LIMIT_ACTION_NONE, zclLoadLimit_Update(&limit, &config, 3500, 0, 2000));
+    UNIT_EQUAL(LOAD_LIMIT_PENDING_OFF, limit.State);
+    // a short dip resets the hold time
+    zclLoadLimit_Update(&limit, &config, 2900, 0, 3000);
+    UNIT_EQUAL(LOAD_LIMIT_NORMAL, limit.State);
+    zclLoadLimit_Update(&limit, &config, 3500, 0, 4000);
+    UNIT_EQUAL(LOAD_LIMIT_ACTION_NONE, zclLoadLimit_Update(&limit, &config, 3500, 0, 8999));
+    UNIT_EQUAL(LOAD_LIMIT_ACTION_OFF, zclLoadLimit_Update(&limit, &config, 3500, 0, 9000));
+    UNIT_EQUAL(LOAD_LIMIT_TRIPPED, limit.State);
+
+    // must go under limit minus hysteresis to come back
+    zclLoadLimit_Update(&limit, &config, 2800, 0, 10000);
+    UNIT_EQUAL(LOAD_LIMIT_TRIPPED, limit.State);
+    zclLoadLimit_Update(&limit, &config, 2600, 0, 11000);
+    UNIT_EQUAL(LOAD_LIMIT_PENDING_ON, limit.State);
+    UNIT_EQUAL(LOAD_LIMIT_ACTION_ON, zclLoadLimit_Update(&limit, &config, 2600, 0, 16000));
+    UNIT_EQUAL(LOAD_LIMIT_NORMAL, limit.State);
+}
+
+static void test_load_limit_Current(void) {
+    loadLimitConfig_t config = {.PowerLimit = 0, .CurrentLimit = 1600, .Hysteresis = 10, .HoldTime = 0};
+    loadLimit_t limit = {.State = LOAD_LIMIT_NORMAL};
+
+    UNIT_EQUAL(LOAD_LIMIT_ACTION_OFF, zclLoadLimit_Update(&limit, &config, 0, 1700, 0));
+    UNIT_EQUAL(LOAD_LIMIT_ACTION_ON, zclLoadLimit_Update(&limit, &config, 0, 100, 1));
+
+    // no limits, nothing happens
+    config.CurrentLimit = 0;
+    UNIT_EQUAL(LOAD_LIMIT_ACTION_NONE, zclLoadLimit_Update(&limit, &config, 32000, 60000, 2));
+    UNIT_CHECK(!zclLoadLimit_NeedsFastPoll(&limit));
+}
+
+void test_load_limit(void) {
+    test_load_limit_Power();
+    test_load_limit_Current();
+}
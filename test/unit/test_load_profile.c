@@ -0,0 +1,92 @@
+#include "load_profile.h"
+#include "unit.h"
+
+#define INTERVAL LOAD_PROFILE_INTERVAL_SEC
+#define START ((uint32)760017600)
+
+static uint32 test_load_profile_Value(uint8 const *buf, uint8 index) {
+    return BUILD_UINT32(buf[index * 3], buf[index * 3 + 1], buf[index * 3 + 2], 0);
+}
+
+static void test_load_profile_PushRead(void) {
+    uint8 buf[20 * 3];
+    uint32 endTime = 0;
+
+    zclLoadProfile_Init();
+    UNIT_EQUAL(0, zclLoadProfile_Read(0, 4, &endTime, buf));
+
+    for (uint8 i = 0; i < 6; i++) {
+        zclLoadProfile_Push(START + i * INTERVAL, 100 + i);
+    }
+    UNIT_EQUAL(4, zclLoadProfile_Read(0, 4, &endTime, buf));
+    UNIT_EQUAL(START + 5 * INTERVAL, endTime);
+    UNIT_EQUAL(105, test_load_profile_Value(buf, 0));
+    UNIT_EQUAL(102, test_load_profile_Value(buf, 3));
+
+    // ending at or before the requested time
+    UNIT_EQUAL(3, zclLoadProfile_Read(START + 2 * INTERVAL + 60, 10, &endTime, buf));
+    UNIT_EQUAL(START + 2 * INTERVAL, endTime);
+    UNIT_EQUAL(100, test_load_profile_Value(buf, 2));
+
+    // values over uint24 saturate
+    zclLoadProfile_Push(START + 6 * INTERVAL, 0x12345678);
+    zclLoadProfile_Read(0, 1, &endTime, buf);
+    UNIT_EQUAL(0xFFFFFF, test_load_profile_Value(buf, 0));
+}
+
+static void test_load_profile_Gap(void) {
+    uint8 buf[20 * 3];
+    uint32 endTime = 0;
+
+    // an interval missed while powered off, only the contiguous part is returned
+    zclLoadProfile_Push(START + 9 * INTERVAL, 900);
+    zclLoadProfile_Push(START + 10 * INTERVAL, 1000);
+    UNIT_EQUAL(2, zclLoadProfile_Read(0, 10, &endTime, buf));
+    UNIT_EQUAL(1000, test_load_profile_Value(buf, 0));
+    UNIT_EQUAL(3, zclLoadProfile_Read(START + 8 * INTERVAL, 3, &endTime, buf));
+    UNIT_EQUAL(START + 6 * INTERVAL, endTime);
+}
+
+static void test_load_profile_Restore(void) {
+    uint8 buf[20 * 3];
+    uint32 endTime = 0;
+
+    zclLoadProfile_Flush();
+    zclLoadProfile_Init();
+    UNIT_EQUAL(2, zclLoadProfile_Read(0, 10, &endTime, buf));
+    UNIT_EQUAL(START + 10 * INTERVAL, endTime);
+    zclLoadProfile_Push(START + 11 * INTERVAL, 1100);
+    UNIT_EQUAL(3, zclLoadProfile_Read(0, 10, &endTime, buf));
+}
+
+static void test_load_profile_Wrap(void) {
+    uint8 buf[20 * 3];
+    uint32 endTime = 0;
+    uint32 base = START + 100 * INTERVAL;
+
+    // more than the ring holds, the oldest blocks are overwritten
+    for (uint16 i = 0; i < LOAD_PROFILE_CAPACITY + LOAD_PROFILE_BLOCK_RECORDS / 2; i++) {
+        zclLoadProfile_Push(base + i * INTERVAL, i);
+    }
+    zclLoadProfile_Init();
+    UNIT_EQUAL(20, zclLoadProfile_Read(0, 20, &endTime, buf));
+    UNIT_EQUAL(LOAD_PROFILE_CAPACITY + LOAD_PROFILE_BLOCK_RECORDS / 2 - 1, test_load_profile_Value(buf, 0));
+    UNIT_EQUAL(LOAD_PROFILE_CAPACITY + LOAD_PROFILE_BLOCK_RECORDS / 2 - 20, test_load_profile_Value(buf, 19));
+
+    // oldest kept interval is the first one of the oldest block
+    uint32 oldest = base + (LOAD_PROFILE_CAPACITY + LOAD_PROFILE_BLOCK_RECORDS / 2 - 1) * INTERVAL;
+    uint16 kept = 0;
+    while (zclLoadProfile_Read(oldest, 1, &endTime, buf) == 1 && endTime == oldest) {
+        kept++;
+        oldest -= INTERVAL;
+    }
+    UNIT_CHECK(kept > LOAD_PROFILE_CAPACITY - LOAD_PROFILE_BLOCK_RECORDS);
+    UNIT_CHECK(kept <= LOAD_PROFILE_CAPACITY);
+}
+
+void test_load_profile(void) {
+    test_load_profile_PushRead();
+    test_load_profile_Gap();
+    test_load_profile_Restore();
+    test_load_profile_Wrap();
+}
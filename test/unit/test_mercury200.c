@@ -0,0 +1,88 @@
+#include "mercury.h"
+#include "mercury200.h"
+#include "mercury_emu.h"
+#include "unit.h"
+#include <string.h>
+
+static mercuryEmu_t test_mercury200_Meter;
+
+static void test_mercury200_Request(void) {
+    uint8 check[] = "123456789";
+    uint8 expected[MERCURY_EMU_REQUEST_LENGTH];
+    uint16 len;
+
+    // CRC-16/MODBUS check value
+    UNIT_EQUAL(0x4B37, mercuryEmu_Crc16(check, 9));
+
+    mercury200_dev.RequestMeasure(11111111, 0x63);
+    uint8 const *sent = hostUart_Sent(MERCURY_PORT, &len);
+    mercuryEmu_Request(expected, 11111111, 0x63);
+    UNIT_EQUAL(MERCURY_EMU_REQUEST_LENGTH, len);
+    UNIT_CHECK(memcmp(expected, sent, MERCURY_EMU_REQUEST_LENGTH) == 0);
+    UNIT_EQUAL(0x00, sent[0]);
+    UNIT_EQUAL(0xA9, sent[1]);
+    UNIT_EQUAL(0x8A, sent[2]);
+    UNIT_EQUAL(0xC7, sent[3]);
+}
+
+static void test_mercury200_CurrentValues(void) {
+    uint8 frame[MERCURY_EMU_CV_LENGTH];
+
+    mercuryEmu_Reply(&test_mercury200_Meter, MERCURY_EMU_CMD_CURRENT_VALUES, frame);
+    hostUart_Feed(MERCURY_PORT, frame, sizeof(frame));
+    current_values_t values = mercury200_dev.ReadCurrentValues();
+    UNIT_EQUAL(2305, values.Voltage);
+    UNIT_EQUAL(123, values.Current);
+    UNIT_EQUAL(2835, values.Power);
+    UNIT_EQUAL(0, Hal_UART_RxBufLen(MERCURY_PORT));
+}
+
+static void test_mercury200_Energy(void) {
+    uint8 frame[MERCURY_EMU_ENERGY_LENGTH];
+    uint32 tiers[] = {1234567, 89, 99999999, 0};
+
+    memcpy(test_mercury200_Meter.Tiers, tiers, sizeof(tiers));
+    mercuryEmu_Reply(&test_mercury200_Meter, MERCURY_EMU_CMD_ENERGY, frame);
+    hostUart_Feed(MERCURY_PORT, frame, sizeof(frame));
+    energy_t energy = mercury200_dev.ReadEnergy();
+    UNIT_EQUAL(1234567, energy.Energy_T1);
+    UNIT_EQUAL(89, energy.Energy_T2);
+    UNIT_EQUAL(99999999, energy.Energy_T3);
+    UNIT_EQUAL(0, energy.Energy_T4);
+}
+
+static void test_mercury200_BadCrc(void) {
+    uint8 frame[MERCURY_EMU_CV_LENGTH];
+    uint8 tail[] = {0x55, 0x55, 0x55};
+
+    mercuryEmu_Reply(&test_mercury200_Meter, MERCURY_EMU_CMD_CURRENT_VALUES, frame);
+    frame[MERCURY_EMU_CV_LENGTH - 1] ^= 0x01;
+    hostUart_Feed(MERCURY_PORT, frame, sizeof(frame));
+    hostUart_Feed(MERCURY_PORT, tail, sizeof(tail));
+    current_values_t values = mercury200_dev.ReadCurrentValues();
+    UNIT_EQUAL(MERCURY_INVALID_RESPONSE, values.Voltage);
+    // whatever followed the broken frame is flushed
+    UNIT_EQUAL(0, Hal_UART_RxBufLen(MERCURY_PORT));
+}
+
+static void test_mercury200_ShortFrame(void) {
+    uint8 frame[MERCURY_EMU_ENERGY_LENGTH];
+
+    mercuryEmu_Reply(&test_mercury200_Meter, MERCURY_EMU_CMD_ENERGY, frame);
+    hostUart_Feed(MERCURY_PORT, frame, MERCURY_EMU_ENERGY_LENGTH - 5);
+    energy_t energy = mercury200_dev.ReadEnergy();
+    UNIT_EQUAL(MERCURY_INVALID_RESPONSE, energy.Energy_T1);
+
+    // nothing at all
+    current_values_t values = mercury200_dev.ReadCurrentValues();
+    UNIT_EQUAL(MERCURY_INVALID_RESPONSE, values.Voltage);
+}
+
+void test_mercury200(void) {
+    mercuryEmu_Init(&test_mercury200_Meter, 11111111);
+    test_mercury200_Request();
+    test_mercury200_CurrentValues();
+    test_mercury200_Energy();
+    test_mercury200_BadCrc();
+    test_mercury200_ShortFrame();
+}
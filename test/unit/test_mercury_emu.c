@@ -0,0 +1,154 @@
+#include "mercury.h"
+#include "mercury200.h"
+#include "mercury_emu.h"
+#include "unit.h"
+#include <string.h>
+
+static mercuryEmu_t test_mercury_emu_Meter;
+
+static bool test_mercury_emu_Ask(uint32 address, uint8 cmd, mercuryEmuReply_t *reply) {
+    uint8 request[MERCURY_EMU_REQUEST_LENGTH];
+
+    mercuryEmu_Request(request, address, cmd);
+    return mercuryEmu_Receive(&test_mercury_emu_Meter, request, sizeof(request), reply);
+}
+
+static void test_mercury_emu_Encoding(void) {
+    mercuryEmuReply_t reply;
+
+    UNIT_CHECK(test_mercury_emu_Ask(11111111, MERCURY_EMU_CMD_CURRENT_VALUES, &reply));
+    UNIT_EQUAL(MERCURY_EMU_CV_LENGTH, reply.Length);
+    UNIT_EQUAL(0, reply.Fault);
+    uint8 cv[] = {0x00, 0xA9, 0x8A, 0xC7, 0x63, 0x23, 0x05, 0x01, 0x23, 0x00, 0x28, 0x35};
+    UNIT_CHECK(memcmp(cv, reply.Data, sizeof(cv)) == 0);
+    // CRC-16/MODBUS over a sealed frame leaves no residue
+    UNIT_EQUAL(0, mercuryEmu_Crc16(reply.Data, reply.Length));
+
+    UNIT_CHECK(test_mercury_emu_Ask(11111111, MERCURY_EMU_CMD_ENERGY, &reply));
+    UNIT_EQUAL(MERCURY_EMU_ENERGY_LENGTH, reply.Length);
+    uint8 t1[] = {0x01, 0x23, 0x45, 0x67};
+    UNIT_CHECK(memcmp(t1, &reply.Data[5], sizeof(t1)) == 0);
+    UNIT_EQUAL(0, mercuryEmu_Crc16(reply.Data, reply.Length));
+
+    test_mercury_emu_Meter.Clock = (mercuryEmuClock_t){.Weekday = 3, .Hours = 23, .Minutes = 59, .Seconds = 7, .Day = 31, .Month = 12, .Year = 25};
+    UNIT_CHECK(test_mercury_emu_Ask(11111111, MERCURY_EMU_CMD_TIME, &reply));
+    uint8 time[] = {0x03, 0x23, 0x59, 0x07, 0x31, 0x12, 0x25};
+    UNIT_EQUAL(MERCURY_EMU_TIME_LENGTH, reply.Length);
+    UNIT_CHECK(memcmp(time, &reply.Data[5], sizeof(time)) == 0);
+
+    UNIT_CHECK(test_mercury_emu_Ask(11111111, MERCURY_EMU_CMD_SERIAL, &reply));
+    UNIT_EQUAL(MERCURY_EMU_SERIAL_LENGTH, reply.Length);
+    UNIT_EQUAL(11111111, BUILD_UINT32(reply.Data[8], reply.Data[7], reply.Data[6], reply.Data[5]));
+}
+
+static void test_mercury_emu_Addressing(void) {
+    mercuryEmuStats_t *stats = &test_mercury_emu_Meter.Stats;
+    mercuryEmuReply_t reply;
+    uint8 request[MERCURY_EMU_REQUEST_LENGTH];
+    uint8 noise[] = {0x55, 0xAA, 0x00};
+
+    UNIT_CHECK(!test_mercury_emu_Ask(22222222, MERCURY_EMU_CMD_CURRENT_VALUES, &reply));
+    UNIT_EQUAL(1, stats->Foreign);
+    UNIT_CHECK(test_mercury_emu_Ask(MERCURY_EMU_BROADCAST, MERCURY_EMU_CMD_CURRENT_VALUES, &reply));
+    UNIT_EQUAL(0xC7, reply.Data[3]);
+    UNIT_CHECK(!test_mercury_emu_Ask(11111111, 0x99, &reply));
+    UNIT_EQUAL(1, stats->Unsupported);
+
+    // noise in front, request split over two reads
+    mercuryEmu_Request(request, 11111111, MERCURY_EMU_CMD_ENERGY);
+    UNIT_CHECK(!mercuryEmu_Receive(&test_mercury_emu_Meter, noise, sizeof(noise), &reply));
+    UNIT_CHECK(!mercuryEmu_Receive(&test_mercury_emu_Meter, request, 4, &reply));
+    UNIT_CHECK(mercuryEmu_Receive(&test_mercury_emu_Meter, &request[4], 3, &reply));
+    UNIT_EQUAL(MERCURY_EMU_ENERGY_LENGTH, reply.Length);
+    UNIT_EQUAL(sizeof(noise), stats->BadBytes);
+
+    // an incomplete request is dropped when the line goes quiet
+    UNIT_CHECK(!mercuryEmu_Receive(&test_mercury_emu_Meter, request, 5, &reply));
+    mercuryEmu_Idle(&test_mercury_emu_Meter);
+    UNIT_EQUAL(0, test_mercury_emu_Meter.RxLength);
+    UNIT_CHECK(test_mercury_emu_Ask(11111111, MERCURY_EMU_CMD_CURRENT_VALUES, &reply));
+}
+
+static void test_mercury_emu_Faults(void) {
+    mercuryEmu_t *emu = &test_mercury_emu_Meter;
+    mercuryEmuReply_t reply;
+
+    emu->Latency = 50;
+    emu->Baud = 9600;
+    UNIT_CHECK(test_mercury_emu_Ask(11111111, MERCURY_EMU_CMD_CURRENT_VALUES, &reply));
+    UNIT_EQUAL(50 + 15, reply.Delay);
+
+    emu->FaultPercent = 100;
+    emu->Faults = MERCURY_EMU_FAULT_CRC;
+    UNIT_CHECK(test_mercury_emu_Ask(11111111, MERCURY_EMU_CMD_CURRENT_VALUES, &reply));
+    UNIT_EQUAL(MERCURY_EMU_CV_LENGTH, reply.Length);
+    UNIT_CHECK(mercuryEmu_Crc16(reply.Data, reply.Length) != 0);
+
+    emu->Faults = MERCURY_EMU_FAULT_DROP;
+    emu->DropCount = 2;
+    UNIT_CHECK(test_mercury_emu_Ask(11111111, MERCURY_EMU_CMD_CURRENT_VALUES, &reply));
+    UNIT_EQUAL(MERCURY_EMU_CV_LENGTH - 2, reply.Length);
+
+    emu->Faults = MERCURY_EMU_FAULT_PARTIAL;
+    emu->PartialLength = 9;
+    UNIT_CHECK(test_mercury_emu_Ask(11111111, MERCURY_EMU_CMD_ENERGY, &reply));
+    UNIT_EQUAL(9, reply.Length);
+    UNIT_EQUAL(50 + 10, reply.Delay);
+
+    emu->Faults = MERCURY_EMU_FAULT_LATE;
+    emu->LateBy = 800;
+    UNIT_CHECK(test_mercury_emu_Ask(11111111, MERCURY_EMU_CMD_CURRENT_VALUES, &reply));
+    UNIT_EQUAL(50 + 800 + 15, reply.Delay);
+    UNIT_EQUAL(0, mercuryEmu_Crc16(reply.Data, reply.Length));
+
+    emu->Faults = MERCURY_EMU_FAULT_SILENT;
+    UNIT_CHECK(!test_mercury_emu_Ask(11111111, MERCURY_EMU_CMD_CURRENT_VALUES, &reply));
+    UNIT_EQUAL(5, emu->Stats.Faults);
+
+    // same seed, same faults
+    uint8 first[16], second[16];
+    for (uint8 run = 0; run < 2; run++) {
+        uint8 *picked = run == 0 ? first : second;
+        emu->Seed = 42;
+        emu->FaultPercent = 50;
+        emu->Faults = MERCURY_EMU_FAULT_CRC | MERCURY_EMU_FAULT_DROP | MERCURY_EMU_FAULT_SILENT;
+        for (uint8 i = 0; i < sizeof(first); i++) {
+            reply.Fault = 0xFF;
+            test_mercury_emu_Ask(11111111, MERCURY_EMU_CMD_CURRENT_VALUES, &reply);
+            picked[i] = reply.Fault;
+        }
+    }
+    UNIT_CHECK(memcmp(first, second, sizeof(first)) == 0);
+    UNIT_CHECK(memchr(first, 0, sizeof(first)) != NULL);
+    UNIT_CHECK(memchr(first, MERCURY_EMU_FAULT_CRC, sizeof(first)) != NULL);
+}
+
+static void test_mercury_emu_Host(void) {
+    mercuryEmu_Init(&test_mercury_emu_Meter, 11111111);
+    test_mercury_emu_Meter.Latency = 40;
+    mercuryEmuHost_Attach(&test_mercury_emu_Meter, MERCURY_PORT);
+
+    // the reply shows up in RX once its latency has passed in virtual time
+    mercury200_dev.RequestMeasure(11111111, MERCURY_EMU_CMD_CURRENT_VALUES);
+    UNIT_EQUAL(1, mercuryEmuHost_Pending());
+    hostOsal_Run(39);
+    UNIT_EQUAL(0, Hal_UART_RxBufLen(MERCURY_PORT));
+    hostOsal_Run(1);
+    UNIT_EQUAL(MERCURY_EMU_CV_LENGTH, Hal_UART_RxBufLen(MERCURY_PORT));
+    UNIT_EQUAL(0, mercuryEmuHost_Pending());
+    UNIT_EQUAL(2305, mercury200_dev.ReadCurrentValues().Voltage);
+
+    // no latency, answered from the write
+    test_mercury_emu_Meter.Latency = 0;
+    mercury200_dev.RequestMeasure(11111111, MERCURY_EMU_CMD_ENERGY);
+    UNIT_EQUAL(1234567, mercury200_dev.ReadEnergy().Energy_T1);
+}
+
+void test_mercury_emu(void) {
+    mercuryEmu_Init(&test_mercury_emu_Meter, 11111111);
+    test_mercury_emu_Encoding();
+    test_mercury_emu_Addressing();
+    mercuryEmu_Init(&test_mercury_emu_Meter, 11111111);
+    test_mercury_emu_Faults();
+    test_mercury_emu_Host();
+}
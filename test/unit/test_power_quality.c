@@ -0,0 +1,68 @@
+#include "power_quality.h"
+#include "unit.h"
+
+static void test_power_quality_Sag(void) {
+    powerQualityConfig_t config = {.SagLevel = 2070, .SwellLevel = 2530, .SagPeriod = 2, .SwellPeriod = 0};
+    powerQuality_t pq = {.State = POWER_QUALITY_NORMAL};
+
+    UNIT_EQUAL(0, zclPowerQuality_Update(&pq, &config, 2300, 0));
+    UNIT_EQUAL(0, zclPowerQuality_Update(&pq, &config, 2000, 1000));
+    UNIT_EQUAL(POWER_QUALITY_SAG, pq.State);
+    UNIT_EQUAL(0, zclPowerQuality_Update(&pq, &config, 1950, 2000));
+    UNIT_EQUAL(POWER_QUALITY_EVENT_START, zclPowerQuality_Update(&pq, &config, 2010, 3000));
+    UNIT_EQUAL(1, pq.SagCount);
+    UNIT_EQUAL(1950, pq.Extreme);
+    UNIT_EQUAL(POWER_QUALITY_EVENT_END, zclPowerQuality_Update(&pq, &config, 2300, 4500));
+    UNIT_EQUAL(POWER_QUALITY_SAG, pq.LastType);
+    UNIT_EQUAL(1950, pq.LastVoltage);
+    UNIT_EQUAL(3500, pq.LastDuration);
+
+    // shorter than the period, not counted
+    zclPowerQuality_Update(&pq, &config, 2000, 5000);
+    UNIT_EQUAL(0, zclPowerQuality_Update(&pq, &config, 2300, 6000));
+    UNIT_EQUAL(1, pq.SagCount);
+}
+
+static void test_power_quality_Swell(void) {
+    powerQualityConfig_t config = {.SagLevel = 0, .SwellLevel = 2530, .SagPeriod = 0, .SwellPeriod = 0};
+    powerQuality_t pq = {.State = POWER_QUALITY_NORMAL};
+
+    UNIT_EQUAL(0, zclPowerQuality_Update(&pq, &config, 1000, 0));
+    UNIT_EQUAL(POWER_QUALITY_EVENT_START, zclPowerQuality_Update(&pq, &config, 2600, 100));
+    UNIT_EQUAL(1, pq.SwellCount);
+    zclPowerQuality_Update(&pq, &config, 2700, 200);
+    UNIT_EQUAL(2700, pq.Extreme);
+}
+
+static void test_power_quality_Outage(void) {
+    powerQualityConfig_t config = {.SagLevel = 2070, .SwellLevel = 2530};
+    powerQuality_t pq = {.State = POWER_QUALITY_NORMAL};
+
+    for (uint8 i = 1; i < POWER_QUALITY_OUTAGE_MISSES; i++) {
+        UNIT_EQUAL(0, zclPowerQuality_Miss(&pq, i * 1000));
+    }
+    UNIT_EQUAL(POWER_QUALITY_EVENT_START, zclPowerQuality_Miss(&pq, POWER_QUALITY_OUTAGE_MISSES * 1000));
+    UNIT_EQUAL(POWER_QUALITY_OUTAGE, pq.State);
+    UNIT_EQUAL(1, pq.OutageCount);
+    UNIT_EQUAL(0, zclPowerQuality_Miss(&pq, 10000));
+
+    // duration from the first unanswered request
+    UNIT_EQUAL(POWER_QUALITY_EVENT_END, zclPowerQuality_Update(&pq, &config, 2300, 21000));
+    UNIT_EQUAL(POWER_QUALITY_OUTAGE, pq.LastType);
+    UNIT_EQUAL(20000, pq.LastDuration);
+
+    // a garbled reply in between, the meter is powered
+    for (uint8 i = 1; i < POWER_QUALITY_OUTAGE_MISSES; i++) {
+        UNIT_EQUAL(0, zclPowerQuality_Miss(&pq, 30000 + i * 1000));
+    }
+    zclPowerQuality_Garbled(&pq);
+    UNIT_EQUAL(0, zclPowerQuality_Miss(&pq, 40000));
+    UNIT_EQUAL(POWER_QUALITY_NORMAL, pq.State);
+    UNIT_EQUAL(1, pq.OutageCount);
+}
+
+void test_power_quality(void) {
+    test_power_quality_Sag();
+    test_power_quality_Swell();
+    test_power_quality_Outage();
+}
@@ -0,0 +1,57 @@
+#include "rejoin.h"
+#include "unit.h"
+
+static void test_rejoin_Stages(void) {
+    rejoin_t rejoin = {.Stage = REJOIN_STAGE_IDLE, .Parent = REJOIN_NO_PARENT};
+    uint32 now = 1000;
+
+    for (uint8 i = 0; i < REJOIN_CACHED_TRIES; i++) {
+        UNIT_EQUAL(REJOIN_CACHED_DELAY, zclRejoin_Failed(&rejoin, now));
+        UNIT_EQUAL(REJOIN_STAGE_CACHED, rejoin.Stage);
+    }
+    for (uint8 i = 0; i < REJOIN_MASK_TRIES; i++) {
+        UNIT_EQUAL(REJOIN_MASK_DELAY, zclRejoin_Failed(&rejoin, now));
+        UNIT_EQUAL(REJOIN_STAGE_MASK, rejoin.Stage);
+    }
+
+    uint32 previous = REJOIN_BACKOFF_START_DELAY;
+    for (uint8 i = 0; i < REJOIN_BACKOFF_TRIES; i++) {
+        uint32 delay = zclRejoin_Failed(&rejoin, now);
+        UNIT_EQUAL(REJOIN_STAGE_BACKOFF, rejoin.Stage);
+        UNIT_CHECK(delay > previous);
+        UNIT_CHECK(delay <= REJOIN_BACKOFF_MAX_DELAY);
+        previous = delay;
+    }
+    // out of tries, keeps trying at the longest delay
+    UNIT_EQUAL(REJOIN_BACKOFF_MAX_DELAY, zclRejoin_Failed(&rejoin, now));
+    UNIT_EQUAL(REJOIN_CACHED_TRIES + REJOIN_MASK_TRIES + REJOIN_BACKOFF_TRIES, rejoin.Stats.Failures);
+
+    zclRejoin_Restored(&rejoin, now + 60000, 0x1234);
+    UNIT_EQUAL(REJOIN_STAGE_IDLE, rejoin.Stage);
+    UNIT_EQUAL(1, rejoin.Stats.Count);
+    UNIT_EQUAL(1, rejoin.Stats.BackoffCount);
+    UNIT_EQUAL(60000, rejoin.Stats.LastLatency);
+    UNIT_EQUAL(60000, rejoin.Stats.MaxLatency);
+    UNIT_EQUAL(0, rejoin.Stats.ParentChanges);
+}
+
+static void test_rejoin_Cached(void) {
+    rejoin_t rejoin = {.Stage = REJOIN_STAGE_IDLE, .Parent = REJOIN_NO_PARENT};
+
+    // start-up restore isn't a rejoin
+    zclRejoin_Restored(&rejoin, 0, 0x0001);
+    UNIT_EQUAL(0, rejoin.Stats.Count);
+
+    zclRejoin_Failed(&rejoin, 5000);
+    zclRejoin_Restored(&rejoin, 6500, 0x0002);
+    UNIT_EQUAL(1, rejoin.Stats.Count);
+    UNIT_EQUAL(1, rejoin.Stats.CachedCount);
+    UNIT_EQUAL(1500, rejoin.Stats.LastLatency);
+    UNIT_EQUAL(1, rejoin.Stats.ParentChanges);
+    UNIT_EQUAL(0x0002, rejoin.Parent);
+}
+
+void test_rejoin(void) {
+    test_rejoin_Stages();
+    test_rejoin_Cached();
+}
@@ -0,0 +1,69 @@
+#include "report_phase.h"
+#include "unit.h"
+
+static void test_report_phase_Offset(void) {
+    uint8 a[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8 b[8] = {1, 2, 3, 4, 5, 6, 7, 9};
+
+    UNIT_EQUAL(0, zclReportPhase_Offset(a, 0));
+    UNIT_CHECK(zclReportPhase_Offset(a, 30000) < 30000);
+    UNIT_EQUAL(zclReportPhase_Offset(a, 30000), zclReportPhase_Offset(a, 30000));
+    UNIT_CHECK(zclReportPhase_Offset(a, 30000) != zclReportPhase_Offset(b, 30000));
+}
+
+static void test_report_phase_Slots(void) {
+    reportPhase_t phase = {.Period = 30000, .Jitter = 0};
+    uint32 now = 1000;
+
+    UNIT_EQUAL(5000, zclReportPhase_Start(&phase, 5000, now, 0));
+    now += 5000;
+    UNIT_EQUAL(30000, zclReportPhase_Next(&phase, now, 0));
+    // late timer doesn't shift the slot
+    now += 30200;
+    UNIT_EQUAL(29800, zclReportPhase_Next(&phase, now, 0));
+    // blocked for whole periods, no backlog
+    now += 100000;
+    UNIT_EQUAL(30000, zclReportPhase_Next(&phase, now, 0));
+}
+
+static void test_report_phase_Jitter(void) {
+    reportPhase_t phase = {.Period = 30000, .Jitter = 10};
+
+    // rand 0 and 0xFFFF are the edges of +-10%
+    UNIT_EQUAL(10000 - 3000, zclReportPhase_Start(&phase, 10000, 0, 0));
+    UNIT_CHECK(zclReportPhase_Start(&phase, 10000, 0, 0xFFFF) <= 10000 + 3000);
+    UNIT_CHECK(zclReportPhase_Start(&phase, 10000, 0, 0xFFFF) > 10000 + 2990);
+    // jitter is capped so reports don't swap
+    phase.Jitter = 100;
+    UNIT_EQUAL(20000 - 13500, zclReportPhase_Start(&phase, 20000, 0, 0));
+}
+
+static void test_report_phase_SetPeriod(void) {
+    reportPhase_t phase = {.Period = 30000, .Jitter = 0};
+
+    zclReportPhase_Start(&phase, 0, 0, 0);
+    zclReportPhase_Next(&phase, 0, 0);
+    // last slot at 0, the new period counts from it
+    UNIT_EQUAL(60000, zclReportPhase_SetPeriod(&phase, 60000, 0, 0));
+    UNIT_EQUAL(10000, zclReportPhase_SetPeriod(&phase, 10000, 0, 0));
+    UNIT_EQUAL(5000, zclReportPhase_SetPeriod(&phase, 10000, 25000, 0));
+}
+
+static void test_report_phase_Off(void) {
+    reportPhase_t phase = {.Period = 0, .Jitter = 0};
+
+    // period 0 is off, never a 1 ms timer
+    UNIT_EQUAL(0, zclReportPhase_Start(&phase, 0, 1000, 0));
+    UNIT_EQUAL(0, zclReportPhase_Next(&phase, 5000, 0));
+    // back on, slots count from the last check at 5000
+    UNIT_EQUAL(29000, zclReportPhase_SetPeriod(&phase, 30000, 6000, 0));
+    UNIT_EQUAL(0, zclReportPhase_SetPeriod(&phase, 0, 7000, 0));
+}
+
+void test_report_phase(void) {
+    test_report_phase_Offset();
+    test_report_phase_Slots();
+    test_report_phase_Jitter();
+    test_report_phase_SetPeriod();
+    test_report_phase_Off();
+}
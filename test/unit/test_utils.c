@@ -0,0 +1,14 @@
+#include "hal_adc.h"
+#include "unit.h"
+#include "utils.h"
+
+void test_utils(void) {
+    UNIT_EQUAL(50, mapRange(0, 100, 0, 100, 50));
+    UNIT_EQUAL(75, mapRange(2000, 3000, 0, 100, 2750));
+    // clamped to the target range
+    UNIT_EQUAL(0, mapRange(2000, 3000, 0, 100, 1000));
+    UNIT_EQUAL(100, mapRange(2000, 3000, 0, 100, 4000));
+
+    hostAdc_Value = 1234;
+    UNIT_EQUAL(1234, adcReadSampled(HAL_ADC_CHANNEL_7, HAL_ADC_RESOLUTION_12, HAL_ADC_REF_AVDD, 8));
+}
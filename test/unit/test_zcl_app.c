@@ -0,0 +1,436 @@
+#include "OSAL.h"
+#include "OSAL_Clock.h"
+#include "OSAL_Nv.h"
+#include "load_profile.h"
+#include "mem_stats.h"
+#include "mercury_emu.h"
+#include "time_sync.h"
+#include "unit.h"
+#include "zcl_app.h"
+#include "zcl_electrical_measurement.h"
+#include "zcl_general.h"
+#include "zcl_ms.h"
+#include <string.h>
+
+// one poll cycle: request and read current values, request and read energy, DS18B20, reports
+#define CYCLE_MS 3000
+
+static uint8 test_zcl_app_TaskId;
+static mercuryEmu_t test_zcl_app_Meter;
+
+// emulated meter at the configured address, the reply waits in RX for the next phase
+static void test_zcl_app_Start(void) {
+    test_zcl_app_TaskId = hostOsal_AddTask(zclApp_event_loop);
+    zclApp_Init(test_zcl_app_TaskId);
+    mercuryEmu_Init(&test_zcl_app_Meter, zclApp_Config.DeviceAddress);
+    mercuryEmuHost_Attach(&test_zcl_app_Meter, MERCURY_PORT);
+}
+
+// lets a cycle started by the report timer finish
+static void test_zcl_app_Idle(void) {
+    while (osal_get_timeoutEx(test_zcl_app_TaskId, APP_READ_SENSORS_EVT) != 0) {
+        hostOsal_Run(CYCLE_MS);
+    }
+}
+
+static void test_zcl_app_PollNow(void) {
+    uint8 mask = 0;
+    UNIT_EQUAL(ZSuccess, hostZcl_Command(FIRST_ENDPOINT, MERCURY_POLL, COMMAND_MERCURY_POLL_NOW, &mask, 1));
+}
+
+// voltage reports sent from frame first on, their values in order
+static uint8 test_zcl_app_VoltageReports(uint8 first, uint16 *values) {
+    uint8 count = 0;
+
+    for (uint8 i = first; i < hostZcl_FrameCount(); i++) {
+        hostZclFrame_t const *frame = hostZcl_Frame(i);
+        if (frame->ClusterId == ELECTRICAL && frame->CommandId == ZCL_CMD_REPORT &&
+            frame->AttrId[0] == ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE) {
+            values[count++] = (uint16)frame->AttrValue[0];
+        }
+    }
+    return count;
+}
+
+void test_zcl_app_init(void) {
+    test_zcl_app_Start();
+
+    UNIT_EQUAL(11111111, zclApp_Config.DeviceAddress);
+    UNIT_EQUAL(30, zclApp_Config.MeasurementPeriod);
+    UNIT_EQUAL(zclApp_Config.PollRate, hostCommissioning_PollRate);
+    UNIT_CHECK(hostZcl_FindAttr(FIRST_ENDPOINT, ELECTRICAL, ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE) != NULL);
+    UNIT_CHECK(hostZcl_FindAttr(SECOND_ENDPOINT, SE_METERING, ATTRID_SE_METERING_CURR_TIER1_SUMM_DLVD) != NULL);
+    // blank NV, every config section is written once
+    UNIT_EQUAL(5, zclApp_NvWrites);
+    UNIT_CHECK(osal_nv_item_len(NW_APP_CONFIG_METER) == sizeof(uint32) + 2);
+    // the checkpoint item starts out empty, not with erased registers
+    uint8 checkpoint[sizeof(energy_t) + sizeof(uint32)];
+    osal_nv_read(NW_APP_ENERGY_CHECKPOINT, 0, sizeof(checkpoint), checkpoint);
+    uint8 const *utc = &checkpoint[sizeof(energy_t)];
+    UNIT_EQUAL(0, BUILD_UINT32(checkpoint[4], checkpoint[5], checkpoint[6], checkpoint[7]));
+    UNIT_EQUAL(0xFFFFFFFF, BUILD_UINT32(utc[0], utc[1], utc[2], utc[3]));
+
+    // first values right away
+    hostOsal_Run(500);
+    uint16 len;
+    uint8 expected[MERCURY_EMU_REQUEST_LENGTH];
+    uint8 const *sent = hostUart_Sent(MERCURY_PORT, &len);
+    mercuryEmu_Request(expected, 11111111, MERCURY_EMU_CMD_CURRENT_VALUES);
+    UNIT_EQUAL(MERCURY_EMU_REQUEST_LENGTH, len);
+    UNIT_CHECK(memcmp(expected, sent, MERCURY_EMU_REQUEST_LENGTH) == 0);
+    hostOsal_Run(CYCLE_MS);
+    UNIT_EQUAL(2305, zclApp_CurrentValues.Voltage);
+    UNIT_EQUAL(1234567, zclApp_Energies.Energy_T1);
+}
+
+void test_zcl_app_migrate(void) {
+    application_config_t legacy = zclApp_Config;
+
+    // older firmware stored the config up to MaxAge in one item
+    legacy.DeviceAddress = 12345678;
+    legacy.MeasurementPeriod = 60;
+    osal_nv_item_init(NW_APP_CONFIG, offsetof(application_config_t, LoadLimit), &legacy);
+    // and created the checkpoint item without data
+    osal_nv_item_init(NW_APP_ENERGY_CHECKPOINT, sizeof(energy_t) + sizeof(uint32), NULL);
+    test_zcl_app_Start();
+    UNIT_EQUAL(0, zclApp_Energies.Energy_T1);
+    UNIT_EQUAL(0, zclApp_EnergiesUtc);
+
+    UNIT_EQUAL(12345678, zclApp_Config.DeviceAddress);
+    UNIT_EQUAL(60, zclApp_Config.MeasurementPeriod);
+    UNIT_EQUAL(2070, zclApp_Config.PowerQuality.SagLevel);
+    UNIT_EQUAL(0, osal_nv_item_len(NW_APP_CONFIG));
+    UNIT_EQUAL(5, zclApp_NvWrites);
+
+    uint8 buf[sizeof(uint32) + 2];
+    osal_nv_read(NW_APP_CONFIG_METER, 0, sizeof(buf), buf);
+    UNIT_EQUAL(12345678, BUILD_UINT32(buf[0], buf[1], buf[2], buf[3]));
+    UNIT_EQUAL(1, BUILD_UINT16(buf[4], buf[5]));
+}
+
+void test_zcl_app_cycle(void) {
+    test_zcl_app_Start();
+    hostOsal_Run(CYCLE_MS);
+    uint32 requests = test_zcl_app_Meter.Stats.Requests;
+
+    // on demand poll is answered with reports to the requester
+    test_zcl_app_PollNow();
+    hostOsal_Run(CYCLE_MS);
+    UNIT_EQUAL(requests + 2, test_zcl_app_Meter.Stats.Requests);
+
+    hostZclFrame_t const *electrical = hostZcl_FindFrame(ELECTRICAL, ZCL_CMD_REPORT);
+    UNIT_CHECK(electrical != NULL);
+    if (electrical != NULL) {
+        UNIT_EQUAL(3, electrical->NumAttr);
+        UNIT_EQUAL(ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE, electrical->AttrId[0]);
+        UNIT_EQUAL(2305, electrical->AttrValue[0]);
+        UNIT_EQUAL(123, electrical->AttrValue[1]);
+        UNIT_EQUAL(2835, electrical->AttrValue[2]);
+        UNIT_EQUAL(0x0000, electrical->ShortAddr);
+    }
+    hostZclFrame_t const *metering = hostZcl_FindFrame(SE_METERING, ZCL_CMD_REPORT);
+    UNIT_CHECK(metering != NULL);
+    if (metering != NULL) {
+        UNIT_EQUAL(6, metering->NumAttr);
+        UNIT_EQUAL(ATTRID_SE_METERING_CURR_TIER1_SUMM_DLVD, metering->AttrId[1]);
+        UNIT_EQUAL(1234567, metering->AttrValue[1]);
+        UNIT_EQUAL(7654321, metering->AttrValue[2]);
+    }
+    // no sensor on the bus, the cached temperature isn't passed off as a fresh one
+    UNIT_CHECK(hostZcl_FindFrame(TEMP, ZCL_CMD_REPORT) == NULL);
+    UNIT_CHECK(hostCommissioning_FastPolls > 0);
+    UNIT_EQUAL(0, hostOsal_Allocated());
+
+    // a request arriving after the running cycle read the values is answered by the next cycle
+    uint16 voltages[HOST_ZCL_MAX_FRAMES];
+    test_zcl_app_Idle();
+    uint8 first = hostZcl_FrameCount();
+    test_zcl_app_PollNow();
+    hostOsal_Run(1500);
+    test_zcl_app_Meter.Voltage = 2310;
+    test_zcl_app_PollNow();
+    test_zcl_app_Idle();
+    UNIT_EQUAL(2, test_zcl_app_VoltageReports(first, voltages));
+    UNIT_EQUAL(2305, voltages[0]);
+    UNIT_EQUAL(2310, voltages[1]);
+
+    // read-through is off by default, a stale value is served from the cache
+    test_zcl_app_Idle();
+    hostCommissioning_FastPolls = 0;
+    hostOsal_Run(60000);
+    test_zcl_app_Idle();
+    // periodic cycles send no poll reports, nothing to fast poll for
+    UNIT_EQUAL(0, hostCommissioning_FastPolls);
+    hostZcl_Authorize(FIRST_ENDPOINT, ELECTRICAL, ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE, ZCL_OPER_READ);
+    UNIT_EQUAL(0, osal_get_timeoutEx(test_zcl_app_TaskId, APP_READ_SENSORS_EVT));
+
+    // with a max age, a stale value read starts a poll, a fresh one doesn't
+    zclApp_Config.MaxAge = 10;
+    test_zcl_app_PollNow();
+    test_zcl_app_Idle();
+    UNIT_EQUAL(ZSuccess, hostZcl_Authorize(FIRST_ENDPOINT, ELECTRICAL, ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE, ZCL_OPER_READ));
+    UNIT_EQUAL(0, osal_get_timeoutEx(test_zcl_app_TaskId, APP_READ_SENSORS_EVT));
+    hostOsal_Run((uint32)zclApp_Config.MaxAge * 1000 + CYCLE_MS);
+    test_zcl_app_Idle();
+    hostZcl_Authorize(FIRST_ENDPOINT, ELECTRICAL, ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE, ZCL_OPER_READ);
+    UNIT_CHECK(osal_get_timeoutEx(test_zcl_app_TaskId, APP_READ_SENSORS_EVT) != 0);
+    test_zcl_app_Idle();
+
+    // one frame reading three stale attributes polls the meter once,
+    // read well between two periodic cycles
+    hostOsal_Run(osal_get_timeoutEx(test_zcl_app_TaskId, APP_REPORT_EVT) + 1);
+    test_zcl_app_Idle();
+    hostOsal_Run((uint32)zclApp_Config.MaxAge * 1000 + 1000);
+    requests = test_zcl_app_Meter.Stats.Requests;
+    first = hostZcl_FrameCount();
+    test_zcl_app_Meter.Voltage = 2320;
+    hostZcl_Authorize(FIRST_ENDPOINT, ELECTRICAL, ATTRID_ELECTRICAL_MEASUREMENT_RMS_VOLTAGE, ZCL_OPER_READ);
+    hostZcl_Authorize(FIRST_ENDPOINT, ELECTRICAL, ATTRID_ELECTRICAL_MEASUREMENT_RMS_CURRENT, ZCL_OPER_READ);
+    hostZcl_Authorize(FIRST_ENDPOINT, ELECTRICAL, ATTRID_ELECTRICAL_MEASUREMENT_ACTIVE_POWER, ZCL_OPER_READ);
+    test_zcl_app_Idle();
+    UNIT_EQUAL(requests + 1, test_zcl_app_Meter.Stats.Requests);
+    // the reader gets the fresh values as a report, whatever reporting it configured
+    UNIT_EQUAL(1, test_zcl_app_VoltageReports(first, voltages));
+    UNIT_EQUAL(2320, voltages[0]);
+    UNIT_EQUAL(0x0000, hostZcl_Frame((uint8)(hostZcl_FrameCount() - 1))->ShortAddr);
+}
+
+void test_zcl_app_invalid(void) {
+    uint16 voltages[HOST_ZCL_MAX_FRAMES];
+
+    test_zcl_app_Start();
+    test_zcl_app_Meter.Faults = MERCURY_EMU_FAULT_CRC;
+    test_zcl_app_Meter.FaultPercent = 100;
+    hostOsal_Run(CYCLE_MS);
+
+    // broken replies leave the values untouched, the meter is powered so it's no outage
+    UNIT_EQUAL(0, zclApp_CurrentValues.Voltage);
+    for (uint8 i = 1; i < 2 * POWER_QUALITY_OUTAGE_MISSES; i++) {
+        test_zcl_app_PollNow();
+        hostOsal_Run(CYCLE_MS);
+    }
+    UNIT_EQUAL(4 * POWER_QUALITY_OUTAGE_MISSES, zclApp_MeterErrors);
+    UNIT_EQUAL(0, zclApp_PowerQuality.OutageCount);
+    UNIT_EQUAL(POWER_QUALITY_NORMAL, zclApp_PowerQuality.State);
+    UNIT_CHECK(hostZcl_FindFrame(ALARMS, COMMAND_ALARMS_ALARM) == NULL);
+    // nothing was read, the requester gets no reports
+    UNIT_EQUAL(0, test_zcl_app_VoltageReports(0, voltages));
+    UNIT_CHECK(hostZcl_FindFrame(SE_METERING, ZCL_CMD_REPORT) == NULL);
+
+    // no reply at all, repeated, is an outage
+    test_zcl_app_Meter.Faults = MERCURY_EMU_FAULT_SILENT;
+    for (uint8 i = 0; i < POWER_QUALITY_OUTAGE_MISSES; i++) {
+        test_zcl_app_PollNow();
+        hostOsal_Run(CYCLE_MS);
+    }
+    UNIT_EQUAL(1, zclApp_PowerQuality.OutageCount);
+    UNIT_EQUAL(POWER_QUALITY_OUTAGE, zclApp_PowerQuality.State);
+    hostZclFrame_t const *alarm = hostZcl_FindFrame(ALARMS, COMMAND_ALARMS_ALARM);
+    UNIT_CHECK(alarm != NULL);
+    if (alarm != NULL) {
+        UNIT_EQUAL(APP_ALARM_EXTREME_UNDER_VOLTAGE, alarm->Payload[0]);
+    }
+
+    // meter back
+    test_zcl_app_Meter.Faults = 0;
+    test_zcl_app_PollNow();
+    hostOsal_Run(CYCLE_MS);
+    UNIT_EQUAL(2305, zclApp_CurrentValues.Voltage);
+    UNIT_EQUAL(POWER_QUALITY_NORMAL, zclApp_PowerQuality.State);
+    UNIT_EQUAL(POWER_QUALITY_OUTAGE, zclApp_PowerQuality.LastType);
+}
+
+void test_zcl_app_save(void) {
+    test_zcl_app_Start();
+    hostOsal_Run(CYCLE_MS);
+    uint32 nvWrites = hostNv_Writes;
+    uint32 appWrites = zclApp_NvWrites;
+
+    // a burst of writes is saved once, only the section that changed
+    zclApp_Config.LoadLimit.PowerLimit = 3000;
+    hostZcl_Authorize(FIRST_ENDPOINT, ELECTRICAL, ZCL_ATTRID_CUSTOM_POWER_LIMIT, ZCL_OPER_WRITE);
+    hostOsal_Run(1000);
+    zclApp_Config.LoadLimit.HoldTime = 10;
+    hostZcl_Authorize(FIRST_ENDPOINT, ELECTRICAL, ZCL_ATTRID_CUSTOM_LIMIT_HOLD_TIME, ZCL_OPER_WRITE);
+    hostOsal_Run(2000);
+    UNIT_EQUAL(appWrites + 1, zclApp_NvWrites);
+    UNIT_EQUAL(nvWrites + 1, hostNv_Writes);
+
+    uint8 buf[sizeof(loadLimitConfig_t) + 2];
+    UNIT_EQUAL(sizeof(buf), osal_nv_item_len(NW_APP_CONFIG_LOAD_LIMIT));
+    osal_nv_read(NW_APP_CONFIG_LOAD_LIMIT, 0, sizeof(buf), buf);
+    UNIT_CHECK(memcmp(buf, &zclApp_Config.LoadLimit, sizeof(loadLimitConfig_t)) == 0);
+
+    // poll rate goes to commissioning
+    zclApp_Config.PollRate = 7500;
+    hostZcl_Authorize(SECOND_ENDPOINT, SE_METERING, ZCL_ATTRID_CUSTOM_POLL_RATE, ZCL_OPER_WRITE);
+    hostOsal_Run(2000);
+    UNIT_EQUAL(7500, hostCommissioning_PollRate);
+    UNIT_EQUAL(appWrites + 2, zclApp_NvWrites);
+
+    // period 0 stops the periodic cycle instead of running it every millisecond,
+    // the limit is off so it doesn't poll either
+    zclApp_Config.LoadLimit.PowerLimit = 0;
+    test_zcl_app_PollNow();
+    zclApp_Config.MeasurementPeriod = 0;
+    hostZcl_Authorize(SECOND_ENDPOINT, SE_METERING, ZCL_ATTRID_CUSTOM_MEASUREMENT_PERIOD, ZCL_OPER_WRITE);
+    hostOsal_Run(2000);
+    test_zcl_app_Idle();
+    UNIT_EQUAL(0, osal_get_timeoutEx(test_zcl_app_TaskId, APP_REPORT_EVT));
+    uint32 requests = test_zcl_app_Meter.Stats.Requests;
+    hostOsal_Run(120000);
+    UNIT_EQUAL(requests, test_zcl_app_Meter.Stats.Requests);
+    UNIT_EQUAL(0, osal_get_timeoutEx(test_zcl_app_TaskId, APP_REPORT_EVT));
+    zclApp_Config.MeasurementPeriod = 30;
+    hostZcl_Authorize(SECOND_ENDPOINT, SE_METERING, ZCL_ATTRID_CUSTOM_MEASUREMENT_PERIOD, ZCL_OPER_WRITE);
+    hostOsal_Run(2000);
+    UNIT_CHECK(osal_get_timeoutEx(test_zcl_app_TaskId, APP_REPORT_EVT) != 0);
+}
+
+// stamps are sleep timer ticks, about 30 us each
+#define TICK_US 31
+
+void test_zcl_app_latency(void) {
+    test_zcl_app_Start();
+    test_zcl_app_Meter.Latency = 120;
+    test_zcl_app_Meter.Baud = 9600;
+    hostOsal_Run(CYCLE_MS);
+
+    // reply starts after the meter latency and takes its line time, 14 and 23 bytes at 9600
+    latencyRequest_t const *cv = &zclApp_LatencyCurrentValues;
+    UNIT_EQUAL(2305, zclApp_CurrentValues.Voltage);
+    UNIT_CHECK(cv->FirstRx + TICK_US >= 135000 && cv->FirstRx <= 135000 + TICK_US);
+    UNIT_EQUAL(cv->FirstRx, cv->Frame);
+    UNIT_EQUAL(1, cv->Total.Count);
+    UNIT_CHECK(cv->Total.Min >= cv->Frame);
+    latencyRequest_t const *energy = &zclApp_LatencyEnergy;
+    UNIT_EQUAL(1234567, zclApp_Energies.Energy_T1);
+    UNIT_CHECK(energy->FirstRx + TICK_US >= 144000 && energy->FirstRx <= 144000 + TICK_US);
+    UNIT_EQUAL(0, mercuryEmuHost_Pending());
+
+    // a reply that misses its read phase isn't timed
+    test_zcl_app_Idle();
+    test_zcl_app_Meter.Latency = 600;
+    test_zcl_app_PollNow();
+    hostOsal_Run(CYCLE_MS);
+    UNIT_EQUAL(1, cv->Total.Count);
+}
+
+void test_zcl_app_late(void) {
+    test_zcl_app_Start();
+    test_zcl_app_Meter.Faults = MERCURY_EMU_FAULT_LATE;
+    test_zcl_app_Meter.FaultPercent = 100;
+    test_zcl_app_Meter.LateBy = 700;
+    hostOsal_Run(500);
+    test_zcl_app_Meter.Faults = 0;
+    hostOsal_Run(CYCLE_MS);
+
+    // the late current values land in front of the energy reply, both reads fail
+    // and the flush leaves RX empty for the next cycle
+    UNIT_EQUAL(1, test_zcl_app_Meter.Stats.Faults);
+    UNIT_EQUAL(0, zclApp_CurrentValues.Voltage);
+    UNIT_EQUAL(0, zclApp_Energies.Energy_T1);
+    UNIT_EQUAL(0, zclApp_LatencyEnergy.Total.Count);
+    UNIT_EQUAL(0, Hal_UART_RxBufLen(MERCURY_PORT));
+
+    test_zcl_app_Idle();
+    test_zcl_app_PollNow();
+    hostOsal_Run(CYCLE_MS);
+    UNIT_EQUAL(2305, zclApp_CurrentValues.Voltage);
+    UNIT_EQUAL(1234567, zclApp_Energies.Energy_T1);
+}
+
+void test_zcl_app_faults(void) {
+    uint16 cycles = 60;
+
+    test_zcl_app_Start();
+    test_zcl_app_Meter.Faults = MERCURY_EMU_FAULT_DROP | MERCURY_EMU_FAULT_CRC | MERCURY_EMU_FAULT_LATE |
+                                MERCURY_EMU_FAULT_PARTIAL | MERCURY_EMU_FAULT_SILENT;
+    test_zcl_app_Meter.FaultPercent = 30;
+    test_zcl_app_Meter.Seed = 7;
+    hostOsal_Run(CYCLE_MS);
+
+    // whatever the line does, a value is either the meter's or none at all
+    for (uint16 i = 0; i < cycles; i++) {
+        test_zcl_app_PollNow();
+        hostOsal_Run(CYCLE_MS);
+        UNIT_CHECK(zclApp_CurrentValues.Voltage == 0 || zclApp_CurrentValues.Voltage == 2305);
+        UNIT_CHECK(zclApp_CurrentValues.Power == 0 || zclApp_CurrentValues.Power == 2835);
+        UNIT_CHECK(zclApp_Energies.Energy_T1 == 0 || zclApp_Energies.Energy_T1 == 1234567);
+        UNIT_CHECK(zclApp_Energies.Energy_T2 == 0 || zclApp_Energies.Energy_T2 == 7654321);
+    }
+    UNIT_CHECK(test_zcl_app_Meter.Stats.Faults > 0);
+    UNIT_CHECK(zclApp_LatencyCurrentValues.Total.Count > 0);
+    UNIT_CHECK(zclApp_LatencyCurrentValues.Total.Count < test_zcl_app_Meter.Stats.Requests / 2);
+    UNIT_EQUAL(0, hostOsal_Allocated());
+
+    // a clean line recovers within a cycle
+    test_zcl_app_Meter.Faults = 0;
+    hostOsal_Run(CYCLE_MS);
+    test_zcl_app_Idle();
+    zclApp_CurrentValues.Voltage = 0;
+    test_zcl_app_PollNow();
+    hostOsal_Run(CYCLE_MS);
+    UNIT_EQUAL(2305, zclApp_CurrentValues.Voltage);
+    UNIT_EQUAL(0, Hal_UART_RxBufLen(MERCURY_PORT));
+}
+
+void test_zcl_app_load_limit(void) {
+    bool tripped = TRUE;
+
+    // relay switched off before the reboot, the load is fine now
+    osal_nv_item_init(NW_APP_LOAD_LIMIT_TRIPPED, sizeof(tripped), &tripped);
+    test_zcl_app_Start();
+    UNIT_EQUAL(LOAD_LIMIT_TRIPPED, zclApp_LoadLimit.State);
+    hostOsal_Run((uint32)zclApp_Config.LoadLimit.HoldTime * 1000 + 2 * CYCLE_MS);
+    hostZclFrame_t const *on = hostZcl_FindFrame(GEN_ON_OFF, COMMAND_ON_OFF_ON);
+    UNIT_CHECK(on != NULL);
+    UNIT_EQUAL(LOAD_LIMIT_NORMAL, zclApp_LoadLimit.State);
+    osal_nv_read(NW_APP_LOAD_LIMIT_TRIPPED, 0, sizeof(tripped), &tripped);
+    UNIT_EQUAL(FALSE, tripped);
+
+    // tripping is saved for the next boot
+    zclApp_Config.LoadLimit.PowerLimit = 2000;
+    test_zcl_app_PollNow();
+    hostOsal_Run((uint32)zclApp_Config.LoadLimit.HoldTime * 1000 + 2 * CYCLE_MS);
+    UNIT_CHECK(hostZcl_FindFrame(GEN_ON_OFF, COMMAND_ON_OFF_OFF) != NULL);
+    UNIT_EQUAL(LOAD_LIMIT_TRIPPED, zclApp_LoadLimit.State);
+    osal_nv_read(NW_APP_LOAD_LIMIT_TRIPPED, 0, sizeof(tripped), &tripped);
+    UNIT_EQUAL(TRUE, tripped);
+}
+
+void test_zcl_app_time_sync(void) {
+    uint32 now = (uint32)800000000 / LOAD_PROFILE_INTERVAL_SEC * LOAD_PROFILE_INTERVAL_SEC + 100;
+
+    // no wall clock yet: no intervals, no reading time
+    test_zcl_app_Start();
+    test_zcl_app_PollNow();
+    test_zcl_app_Idle();
+    UNIT_EQUAL(1234567, zclApp_Energies.Energy_T1);
+    UNIT_EQUAL(0, zclApp_EnergiesUtc);
+    UNIT_EQUAL(0, osal_get_timeoutEx(test_zcl_app_TaskId, APP_LOAD_PROFILE_EVT));
+
+    // the request goes to the coordinator, nobody else sets the clock
+    hostZcl_TimeResponse(0x1234, now);
+    hostOsal_Run(1);
+    UNIT_CHECK(!zclTimeSync_IsSynced());
+    UNIT_EQUAL(0, osal_get_timeoutEx(test_zcl_app_TaskId, APP_LOAD_PROFILE_EVT));
+
+    hostZcl_TimeResponse(0x0000, now);
+    hostOsal_Run(1);
+    UNIT_CHECK(zclTimeSync_IsSynced());
+    UNIT_EQUAL(now, osal_getClock());
+    // first interval ends on the next boundary
+    uint32 remaining = osal_get_timeoutEx(test_zcl_app_TaskId, APP_LOAD_PROFILE_EVT);
+    UNIT_CHECK(remaining <= (LOAD_PROFILE_INTERVAL_SEC - 100) * 1000 && remaining > (LOAD_PROFILE_INTERVAL_SEC - 101) * 1000);
+
+    test_zcl_app_PollNow();
+    test_zcl_app_Idle();
+    UNIT_CHECK(zclApp_EnergiesUtc >= now);
+
+    // an out of heap request is counted with the other application allocations
+    uint16 failures = zclMemStats.AllocFailures;
+    hostOsal_FailAllocs(1);
+    zclTimeSync_Request(FIRST_ENDPOINT);
+    UNIT_EQUAL(failures + 1, zclMemStats.AllocFailures);
+}
@@ -0,0 +1,27 @@
+#ifndef UNIT_H
+#define UNIT_H
+
+#include "hal_uart.h"
+#include "host.h"
+#include <stdio.h>
+
+// Minimal checks for the host build, a failed check is reported and the suite goes on.
+typedef void (*unitCase_t)(void);
+
+typedef struct {
+    char const *Name;
+    unitCase_t Run;
+} unitSuite_t;
+
+extern uint16 unit_Failures;
+
+#define UNIT_CHECK(cond) unit_Check((cond), #cond, __FILE__, __LINE__)
+#define UNIT_EQUAL(expected, actual) unit_Equal((int64)(expected), (int64)(actual), #actual, __FILE__, __LINE__)
+
+extern void unit_Check(bool ok, char const *expr, char const *file, int line);
+extern void unit_Equal(int64 expected, int64 actual, char const *expr, char const *file, int line);
+
+// fresh OSAL, NV, UART and ZCL stubs
+extern void unit_ResetHost(void);
+
+#endif // UNIT_H
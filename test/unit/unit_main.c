@@ -0,0 +1,98 @@
+#include "unit.h"
+#include <string.h>
+
+extern void test_at24c(void);
+extern void test_consumption(void);
+extern void test_ds18b20(void);
+extern void test_eeprom_log(void);
+extern void test_load_limit(void);
+extern void test_load_profile(void);
+extern void test_mercury200(void);
+extern void test_mercury_emu(void);
+extern void test_power_quality(void);
+extern void test_rejoin(void);
+extern void test_report_phase(void);
+extern void test_utils(void);
+extern void test_zcl_app_init(void);
+extern void test_zcl_app_migrate(void);
+extern void test_zcl_app_cycle(void);
+extern void test_zcl_app_invalid(void);
+extern void test_zcl_app_save(void);
+extern void test_zcl_app_latency(void);
+extern void test_zcl_app_late(void);
+extern void test_zcl_app_faults(void);
+extern void test_zcl_app_load_limit(void);
+extern void test_zcl_app_time_sync(void);
+
+// zcl_app suites leave the application in statics, ctest runs each one in its own process
+static const unitSuite_t unit_Suites[] = {
+    {"at24c", test_at24c},
+    {"consumption", test_consumption},
+    {"ds18b20", test_ds18b20},
+    {"eeprom_log", test_eeprom_log},
+    {"load_limit", test_load_limit},
+    {"load_profile", test_load_profile},
+    {"mercury200", test_mercury200},
+    {"mercury_emu", test_mercury_emu},
+    {"power_quality", test_power_quality},
+    {"rejoin", test_rejoin},
+    {"report_phase", test_report_phase},
+    {"utils", test_utils},
+    {"zcl_app_init", test_zcl_app_init},
+    {"zcl_app_migrate", test_zcl_app_migrate},
+    {"zcl_app_cycle", test_zcl_app_cycle},
+    {"zcl_app_invalid", test_zcl_app_invalid},
+    {"zcl_app_save", test_zcl_app_save},
+    {"zcl_app_latency", test_zcl_app_latency},
+    {"zcl_app_late", test_zcl_app_late},
+    {"zcl_app_faults", test_zcl_app_faults},
+    {"zcl_app_load_limit", test_zcl_app_load_limit},
+    {"zcl_app_time_sync", test_zcl_app_time_sync},
+};
+
+#define UNIT_SUITES (sizeof(unit_Suites) / sizeof(unit_Suites[0]))
+
+uint16 unit_Failures = 0;
+
+void unit_Check(bool ok, char const *expr, char const *file, int line) {
+    if (!ok) {
+        printf("%s:%d: check failed: %s\n", file, line, expr);
+        unit_Failures++;
+    }
+}
+
+void unit_Equal(int64 expected, int64 actual, char const *expr, char const *file, int line) {
+    if (expected != actual) {
+        printf("%s:%d: %s is %lld, expected %lld\n", file, line, expr, (long long)actual, (long long)expected);
+        unit_Failures++;
+    }
+}
+
+void unit_ResetHost(void) {
+    hostOsal_Reset();
+    hostNv_Reset();
+    hostUart_Reset();
+    hostZcl_Reset();
+}
+
+// unit [suite], all non zcl_app suites without an argument
+int main(int argc, char **argv) {
+    uint8 run = 0;
+
+    for (uint8 i = 0; i < UNIT_SUITES; i++) {
+        unitSuite_t const *suite = &unit_Suites[i];
+        uint16 failures = unit_Failures;
+        if (argc > 1 ? strcmp(argv[1], suite->Name) != 0 : strncmp(suite->Name, "zcl_app", 7) == 0) {
+            continue;
+        }
+        unit_ResetHost();
+        suite->Run();
+        printf("%s: %s\n", suite->Name, unit_Failures != failures ? "FAILED" : "ok");
+        run++;
+    }
+    if (run == 0) {
+        printf("unknown suite %s\n", argv[1]);
+        return 2;
+    }
+    return unit_Failures ? 1 : 0;
+}
@@ -0,0 +1,85 @@
+"""Decodes binary trace records written by zstack-lib/trace.c.
+
+Usage:
+    python trace_decode.py capture.bin
+    python trace_decode.py COM5        (needs pyserial, 115200 baud)
+
+Bytes outside trace frames (LREP output) are printed as is.
+"""
+import re
+import struct
+import sys
+from os.path import dirname, exists, join
+
+cwd = dirname(__file__)
+TRACE_SYNC = 0xA5
+HEADER = struct.Struct('<BBBI')
+
+
+def load_events(path):
+    events = {}
+    pattern = re.compile(r'#define\s+(TRACE_\w+)\s+(0x[0-9A-Fa-f]+|\d+)\s*//\s*(.*)$')
+    with open(path) as f:
+        for line in f:
+            match = pattern.match(line.strip())
+            if match:
+                events[int(match.group(2), 0)] = (match.group(1), match.group(3).strip())
+    return events
+
+
+def format_record(events, event_id, timestamp, payload):
+    name, fmt = events.get(event_id, ('0x%02X' % event_id, '{hex}'))
+    args = [struct.unpack_from('<I', payload, i)[0] for i in range(0, len(payload) - len(payload) % 4, 4)]
+    try:
+        text = fmt.format(*args, hex=payload.hex(' ').upper())
+    except (IndexError, ValueError):
+        text = payload.hex(' ').upper()
+    return '[{0:10.3f}] {1}: {2}'.format(timestamp / 1000.0, name, text)
+
+
+def decode(events, stream, follow=False):
+    buf = bytearray()
+    text = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            if follow:
+                continue
+            break
+        buf += chunk
+        while buf:
+            if buf[0] != TRACE_SYNC or (len(buf) > 1 and buf[1] not in events):
+                text.append(buf.pop(0))
+                if text.endswith(b'\n'):
+                    sys.stdout.write(text.decode('ascii', 'replace'))
+                    text.clear()
+                continue
+            if len(buf) < HEADER.size:
+                break
+            _, event_id, length, timestamp = HEADER.unpack_from(buf)
+            if len(buf) < HEADER.size + length:
+                break
+            payload = bytes(buf[HEADER.size:HEADER.size + length])
+            del buf[:HEADER.size + length]
+            print(format_record(events, event_id, timestamp, payload))
+    if text:
+        sys.stdout.write(text.decode('ascii', 'replace'))
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+    events = load_events(join(cwd, 'zstack-lib', 'trace_events.h'))
+    source = sys.argv[1]
+    if exists(source):
+        with open(source, 'rb') as f:
+            decode(events, f)
+    else:
+        import serial
+        with serial.Serial(source, 115200, timeout=1) as port:
+            decode(events, port, follow=True)
+
+
+if __name__ == '__main__':
+    main()
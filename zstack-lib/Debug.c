@@ -5,18 +5,17 @@
 #include "OSAL_Memory.h"
 
 
+#if DEBUG_TEXT
 void vprint(const char *fmt, va_list argp) {
-    uint8 string[100];
+    uint8 string[BUFFER];
     if (0 < vsprintf((char *)string, fmt, argp)) // build string
     {
         LREPMaster(string);
     }
 }
+#endif
 
 #ifdef DO_DEBUG_UART
-#ifndef UART_PORT
-#define UART_PORT HAL_UART_PORT_0
-#endif
 bool DebugInit() {
     halUARTCfg_t halUARTConfig;
     halUARTConfig.configured = TRUE;
@@ -31,12 +30,13 @@ bool DebugInit() {
     halUARTConfig.callBackFunc = NULL;
     HalUARTInit();
     if (HalUARTOpen(UART_PORT, &halUARTConfig) == HAL_UART_SUCCESS) {
-        LREPMaster("Initialized debug module \r\n");
+        LREPMaster((uint8 *)"Initialized debug module \r\n");
         return true;
     }
     return false;
 }
 
+#if DEBUG_TEXT
 void LREPMaster(uint8 *data) {
     if (data == NULL) {
         return;
@@ -59,11 +59,12 @@ void LREP(char *format, ...) {
     vprint(format, argp);
     va_end(argp);
 }
+#endif
 #elif defined(DO_DEBUG_MT)
 
 bool DebugInit() {
     debugThreshold = 0x04; // increase threshold as soon as we initialize debug module
-    LREPMaster("Initialized debug module \r\n");
+    LREPMaster((uint8 *)"Initialized debug module \r\n");
     return TRUE;
 }
 void LREP(char *format, ...) {
@@ -75,14 +76,5 @@ void LREP(char *format, ...) {
 }
 void LREPMaster(uint8 *data) { debug_str(data); }
 #else
-bool DebugInit() {return true;};
-void LREP(char *format, ...) {
-    va_list argp;
-    va_start(argp, format);
-    printf(format, argp);
-    va_end(argp);
-};
-void LREPMaster(uint8 *data) {
-    printf((const char*)data);
-};
+bool DebugInit() { return true; }
 #endif
@@ -19,6 +19,10 @@
 
 #define PRINT_IMMEDIATE_PRINT 0
 
+#ifndef UART_PORT
+#define UART_PORT HAL_UART_PORT_0
+#endif
+
 
 #define BYTE_TO_BINARY_PATTERN "%c%c%c%c%c%c%c%c"
 #define BYTE_TO_BINARY(byte)  \
@@ -32,9 +36,98 @@
   (byte & 0x01 ? '1' : '0')
 
 
-void vprint(const char *fmt, va_list argp);
+// Log levels. LOG_LEVEL is the default for every module, LOG_LEVEL_<MODULE> overrides it.
+// A source file selects its module with LOG_MODULE_LEVEL before including Debug.h,
+// calls above the module level expand to nothing, strings included.
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_TRACE 4
+
+#ifndef LOG_LEVEL
+    #if defined(DO_DEBUG_UART) || defined(DO_DEBUG_MT)
+        #define LOG_LEVEL LOG_LEVEL_TRACE
+    #else
+        #define LOG_LEVEL LOG_LEVEL_NONE
+    #endif
+#endif
+
+#ifndef LOG_LEVEL_APP
+    #define LOG_LEVEL_APP LOG_LEVEL
+#endif
+
+#ifndef LOG_LEVEL_MERCURY
+    #define LOG_LEVEL_MERCURY LOG_LEVEL
+#endif
+
+#ifndef LOG_LEVEL_DS18B20
+    #define LOG_LEVEL_DS18B20 LOG_LEVEL
+#endif
+
+#ifndef LOG_LEVEL_COMMISSIONING
+    #define LOG_LEVEL_COMMISSIONING LOG_LEVEL
+#endif
+
+#ifndef LOG_LEVEL_FACTORY_RESET
+    #define LOG_LEVEL_FACTORY_RESET LOG_LEVEL
+#endif
+
+#ifndef LOG_MODULE_LEVEL
+    #define LOG_MODULE_LEVEL LOG_LEVEL
+#endif
+
+// A call that is compiled out still sees its arguments, so a value kept only for the log
+// is not left unused. if (0) drops the call together with its strings at any optimization.
+static inline void LOG_Discard(char *format, ...) {}
+#define LOG_OFF(...)                                                                                                               \
+    do {                                                                                                                           \
+        if (0) {                                                                                                                   \
+            LOG_Discard(__VA_ARGS__);                                                                                              \
+        }                                                                                                                          \
+    } while (0)
+
+#if LOG_MODULE_LEVEL >= LOG_LEVEL_ERROR
+    #define LOGE(...) LREP(__VA_ARGS__)
+#else
+    #define LOGE(...) LOG_OFF(__VA_ARGS__)
+#endif
+
+#if LOG_MODULE_LEVEL >= LOG_LEVEL_WARN
+    #define LOGW(...) LREP(__VA_ARGS__)
+#else
+    #define LOGW(...) LOG_OFF(__VA_ARGS__)
+#endif
+
+#if LOG_MODULE_LEVEL >= LOG_LEVEL_INFO
+    #define LOGI(...) LREP(__VA_ARGS__)
+#else
+    #define LOGI(...) LOG_OFF(__VA_ARGS__)
+#endif
+
+#if LOG_MODULE_LEVEL >= LOG_LEVEL_TRACE
+    #define LOGT(...) LREP(__VA_ARGS__)
+#else
+    #define LOGT(...) LOG_OFF(__VA_ARGS__)
+#endif
+
+// TRACE frames own the debug UART, text in between would break them for trace_decode.py
+#if defined(DO_DEBUG_UART) && defined(TRACE) && TRACE
+    #define DEBUG_TEXT FALSE
+#elif defined(DO_DEBUG_UART) || defined(DO_DEBUG_MT)
+    #define DEBUG_TEXT TRUE
+#else
+    #define DEBUG_TEXT FALSE
+#endif
+
 extern bool DebugInit(void);
+#if DEBUG_TEXT
+void vprint(const char *fmt, va_list argp);
 extern void LREP(char *format, ...);
 extern void LREPMaster(uint8 *data);
+#else
+    #define LREP(...) LOG_OFF(__VA_ARGS__)
+    #define LREPMaster(data) LOG_OFF((char *)(data))
+#endif
 //void LREPHex(const unsigned char *buf, char *data);
 #endif
\ No newline at end of file
@@ -0,0 +1,37 @@
+#include "at24c.h"
+#include "Debug.h"
+#include "hal_i2c.h"
+
+#define AT24C_ADDRESS (0x50 | AT24C_HW_ADDRESS)
+
+static int8 at24c_Read(uint16 address, uint8 *buf, uint16 len);
+static int8 at24c_Write(uint16 address, uint8 *buf, uint16 len);
+
+zclEeprom_t at24c_dev = {&at24c_Read, &at24c_Write, AT24C_PAGE_SIZE, AT24C_SIZE};
+
+static int8 at24c_Read(uint16 address, uint8 *buf, uint16 len) {
+    uint8 wordAddress[2] = {HI_UINT16(address), LO_UINT16(address)};
+
+    // random read: word address, repeated start, sequential read
+    if (HalI2CReadBlock(AT24C_ADDRESS, wordAddress, sizeof(wordAddress), buf, len) != I2C_SUCCESS) {
+        return EEPROM_ERROR;
+    }
+    return EEPROM_SUCCESS;
+}
+
+static int8 at24c_Write(uint16 address, uint8 *buf, uint16 len) {
+    uint8 wordAddress[2] = {HI_UINT16(address), LO_UINT16(address)};
+
+    if (len > AT24C_PAGE_SIZE || (address % AT24C_PAGE_SIZE) + len > AT24C_PAGE_SIZE) {
+        LOGE("at24c_Write crosses page address=0x%X len=%d\r\n", address, len);
+        return EEPROM_ERROR;
+    }
+    if (HalI2CWriteBlock(AT24C_ADDRESS, wordAddress, sizeof(wordAddress), buf, len) != I2C_SUCCESS) {
+        return EEPROM_ERROR;
+    }
+    // the part doesn't acknowledge until its write cycle is finished
+    if (HalI2CAckPoll(AT24C_ADDRESS) != I2C_SUCCESS) {
+        return EEPROM_ERROR;
+    }
+    return EEPROM_SUCCESS;
+}
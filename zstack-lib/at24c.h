@@ -0,0 +1,22 @@
+#ifndef AT24C_H
+#define AT24C_H
+
+#include "eeprom.h"
+
+// 24C256 by default, 24C512 - 65536 / 128
+#ifndef AT24C_SIZE
+    #define AT24C_SIZE ((uint32)32768)
+#endif
+
+#ifndef AT24C_PAGE_SIZE
+    #define AT24C_PAGE_SIZE 64
+#endif
+
+// A2..A0 pins strapping
+#ifndef AT24C_HW_ADDRESS
+    #define AT24C_HW_ADDRESS 0
+#endif
+
+extern zclEeprom_t at24c_dev;
+
+#endif // AT24C_H
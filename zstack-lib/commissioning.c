@@ -1,27 +1,34 @@
 #include "commissioning.h"
+#define LOG_MODULE_LEVEL LOG_LEVEL_COMMISSIONING
 #include "Debug.h"
 #include "OSAL_PwrMgr.h"
 #include "ZDApp.h"
+#include "ZGlobals.h"
+#include "nwk_globals.h"
 #include "bdb_interface.h"
 #include "hal_key.h"
 #include "hal_led.h"
 
 static void zclCommissioning_ProcessCommissioningStatus(bdbCommissioningModeMsg_t *bdbCommissioningModeMsg);
-static void zclCommissioning_ResetBackoffRetry(void);
+static void zclCommissioning_AttemptRejoin(void);
 static void zclCommissioning_BindNotification(bdbBindNotificationData_t *data);
 extern bool requestNewTrustCenterLinkKey;
 
-byte rejoinsLeft = APP_COMMISSIONING_END_DEVICE_REJOIN_TRIES;
-uint32 rejoinDelay = APP_COMMISSIONING_END_DEVICE_REJOIN_START_DELAY;
+rejoin_t zclCommissioning_Rejoin = {.Stage = REJOIN_STAGE_IDLE, .Parent = REJOIN_NO_PARENT};
 
 uint8 zclCommissioning_TaskId = 0;
 
+static zclCommissioning_ConnectCB_t zclCommissioning_ConnectCB = NULL;
+static uint16 zclCommissioning_PollRate = POLL_RATE;
+static uint32 zclCommissioning_ChannelMask = 0; // configured, zgDefaultChannelList is narrowed while rejoining
+
 #ifndef APP_TX_POWER
     #define APP_TX_POWER TX_PWR_PLUS_4
 #endif
 
 void zclCommissioning_Init(uint8 task_id) {
     zclCommissioning_TaskId = task_id;
+    zclCommissioning_ChannelMask = zgDefaultChannelList;
 
     bdb_RegisterCommissioningStatusCB(zclCommissioning_ProcessCommissioningStatus);
     bdb_RegisterBindNotificationCB(zclCommissioning_BindNotification);
@@ -34,26 +41,71 @@ void zclCommissioning_Init(uint8 task_id) {
     bdb_StartCommissioning(BDB_COMMISSIONING_MODE_NWK_STEERING | BDB_COMMISSIONING_MODE_FINDING_BINDING);
 }
 
-static void zclCommissioning_ResetBackoffRetry(void) {
-    rejoinsLeft = APP_COMMISSIONING_END_DEVICE_REJOIN_TRIES;
-    rejoinDelay = APP_COMMISSIONING_END_DEVICE_REJOIN_START_DELAY;
+#if ZG_BUILD_ENDDEVICE_TYPE
+static void zclCommissioning_AttemptRejoin(void) {
+    LOGI("Rejoin stage=%d tries left=%d\r\n", zclCommissioning_Rejoin.Stage, zclCommissioning_Rejoin.Tries);
+    // rejoin goes over zgDefaultChannelList once the current channel fails,
+    // in the first stage the list is just the last channel
+    if (zclCommissioning_Rejoin.Stage == REJOIN_STAGE_CACHED) {
+        zgDefaultChannelList = (uint32)1 << _NIB.nwkLogicalChannel;
+    } else {
+        zgDefaultChannelList = zclCommissioning_ChannelMask;
+    }
+    bdb_ZedAttemptRecoverNwk();
 }
+#endif
 
 static void zclCommissioning_OnConnect(void) {
-    LREPMaster("zclCommissioning_OnConnect \r\n");
-    zclCommissioning_ResetBackoffRetry();
+    LOGT("zclCommissioning_OnConnect \r\n");
+    zclRejoin_Restored(&zclCommissioning_Rejoin, osal_GetSystemClock(), _NIB.nwkCoordAddress);
+    zgDefaultChannelList = zclCommissioning_ChannelMask;
+    LOGI("Rejoins=%d last latency=%ld ms\r\n", zclCommissioning_Rejoin.Stats.Count, zclCommissioning_Rejoin.Stats.LastLatency);
+#if ZG_BUILD_ENDDEVICE_TYPE
+    // routers keep the receiver on, there is no poll rate to clock down
+    NLME_SetPollRate(APP_COMMISSIONING_FAST_POLL_RATE);
     osal_start_timerEx(zclCommissioning_TaskId, APP_COMMISSIONING_CLOCK_DOWN_POLING_RATE_EVT, 30 * 1000);
+#endif
+    if (zclCommissioning_ConnectCB != NULL) {
+        zclCommissioning_ConnectCB();
+    }
+}
+
+void zclCommissioning_RegisterConnectCB(zclCommissioning_ConnectCB_t cb) { zclCommissioning_ConnectCB = cb; }
+
+void zclCommissioning_SetPollRate(uint16 rate) {
+    LOGI("zclCommissioning_SetPollRate %d\r\n", rate);
+    zclCommissioning_PollRate = rate;
+#if ZG_BUILD_ENDDEVICE_TYPE
+    // a running fast poll window applies the rate when it ends
+    if (devState == DEV_END_DEVICE && osal_get_timeoutEx(zclCommissioning_TaskId, APP_COMMISSIONING_CLOCK_DOWN_POLING_RATE_EVT) == 0) {
+        NLME_SetPollRate(rate);
+    }
+#endif
+}
+
+void zclCommissioning_FastPoll(void) {
+#if ZG_BUILD_ENDDEVICE_TYPE
+    // rejoin runs its own poll rate
+    if (devState != DEV_END_DEVICE) {
+        return;
+    }
+    NLME_SetPollRate(APP_COMMISSIONING_FAST_POLL_RATE);
+    // don't cut a longer window short
+    if (osal_get_timeoutEx(zclCommissioning_TaskId, APP_COMMISSIONING_CLOCK_DOWN_POLING_RATE_EVT) < APP_COMMISSIONING_FAST_POLL_WINDOW) {
+        osal_start_timerEx(zclCommissioning_TaskId, APP_COMMISSIONING_CLOCK_DOWN_POLING_RATE_EVT, APP_COMMISSIONING_FAST_POLL_WINDOW);
+    }
+#endif
 }
 
 static void zclCommissioning_ProcessCommissioningStatus(bdbCommissioningModeMsg_t *bdbCommissioningModeMsg) {
-    LREP("bdbCommissioningMode=%d bdbCommissioningStatus=%d bdbRemainingCommissioningModes=0x%X\r\n",
+    LOGT("bdbCommissioningMode=%d bdbCommissioningStatus=%d bdbRemainingCommissioningModes=0x%X\r\n",
          bdbCommissioningModeMsg->bdbCommissioningMode, bdbCommissioningModeMsg->bdbCommissioningStatus,
          bdbCommissioningModeMsg->bdbRemainingCommissioningModes);
     switch (bdbCommissioningModeMsg->bdbCommissioningMode) {
     case BDB_COMMISSIONING_INITIALIZATION:
         switch (bdbCommissioningModeMsg->bdbCommissioningStatus) {
         case BDB_COMMISSIONING_NO_NETWORK:
-            LREP("No network\r\n");
+            LOGI("No network\r\n");
             HalLedBlink(HAL_LED_1, 2, 100, 800);
             break;
         case BDB_COMMISSIONING_NETWORK_RESTORED:
@@ -67,7 +119,7 @@ static void zclCommissioning_ProcessCommissioningStatus(bdbCommissioningModeMsg_
         switch (bdbCommissioningModeMsg->bdbCommissioningStatus) {
         case BDB_COMMISSIONING_SUCCESS:
             HalLedBlink(HAL_LED_1, 5, 80, 600);
-            LREPMaster("BDB_COMMISSIONING_SUCCESS\r\n");
+            LOGI("BDB_COMMISSIONING_SUCCESS\r\n");
             zclCommissioning_OnConnect();
             break;
 
@@ -79,25 +131,21 @@ static void zclCommissioning_ProcessCommissioningStatus(bdbCommissioningModeMsg_
         break;
 
     case BDB_COMMISSIONING_PARENT_LOST:
-        LREPMaster("BDB_COMMISSIONING_PARENT_LOST\r\n");
+        LOGW("BDB_COMMISSIONING_PARENT_LOST\r\n");
         switch (bdbCommissioningModeMsg->bdbCommissioningStatus) {
         case BDB_COMMISSIONING_NETWORK_RESTORED:
-            zclCommissioning_ResetBackoffRetry();
+            zclCommissioning_OnConnect();
             break;
 
-        default:
+        default: {
             HalLedSet(HAL_LED_1, HAL_LED_MODE_BLINK);
-            // // Parent not found, attempt to rejoin again after a exponential backoff delay
-            LREP("rejoinsLeft %d rejoinDelay=%ld\r\n", rejoinsLeft, rejoinDelay);
-            if (rejoinsLeft > 0) {
-                rejoinDelay *= APP_COMMISSIONING_END_DEVICE_REJOIN_BACKOFF;
-                rejoinsLeft -= 1;
-            } else {
-                rejoinDelay = APP_COMMISSIONING_END_DEVICE_REJOIN_MAX_DELAY;
-            }
-            osal_start_timerEx(zclCommissioning_TaskId, APP_COMMISSIONING_END_DEVICE_REJOIN_EVT, rejoinDelay);
+            // parent not found, next attempt per rejoin stage
+            uint32 delay = zclRejoin_Failed(&zclCommissioning_Rejoin, osal_GetSystemClock());
+            LOGI("Rejoin stage=%d in %ld ms\r\n", zclCommissioning_Rejoin.Stage, delay);
+            osal_start_timerEx(zclCommissioning_TaskId, APP_COMMISSIONING_END_DEVICE_REJOIN_EVT, delay);
             break;
         }
+        }
         break;
     default:
         break;
@@ -111,12 +159,12 @@ static void zclCommissioning_ProcessIncomingMsg(zclIncomingMsg_t *pInMsg) {
 }
 
 void zclCommissioning_Sleep(uint8 allow) {
-    LREP("zclCommissioning_Sleep %d\r\n", allow);
-#if defined(POWER_SAVING)
+    LOGT("zclCommissioning_Sleep %d\r\n", allow);
+#if ZG_BUILD_ENDDEVICE_TYPE
     if (allow) {
-        NLME_SetPollRate(0);
+        NLME_SetPollRate(zclCommissioning_PollRate);
     } else {
-        NLME_SetPollRate(POLL_RATE);
+        NLME_SetPollRate(APP_COMMISSIONING_FAST_POLL_RATE);
     }
 #endif
 }
@@ -131,8 +179,8 @@ uint16 zclCommissioning_event_loop(uint8 task_id, uint16 events) {
             case ZDO_STATE_CHANGE:
                 HalLedSet(HAL_LED_1, HAL_LED_MODE_BLINK);
                 zclApp_NwkState = (devStates_t)(MSGpkt->hdr.status);
-                LREP("NwkState=%d\r\n", zclApp_NwkState);
-                if (zclApp_NwkState == DEV_END_DEVICE) {
+                LOGT("NwkState=%d\r\n", zclApp_NwkState);
+                if (zclApp_NwkState == DEV_END_DEVICE || zclApp_NwkState == DEV_ROUTER) {
                     HalLedSet(HAL_LED_1, HAL_LED_MODE_OFF);
                 }
                 break;
@@ -153,15 +201,15 @@ uint16 zclCommissioning_event_loop(uint8 task_id, uint16 events) {
         return (events ^ SYS_EVENT_MSG);
     }
     if (events & APP_COMMISSIONING_END_DEVICE_REJOIN_EVT) {
-        LREPMaster("APP_END_DEVICE_REJOIN_EVT\r\n");
+        LOGT("APP_END_DEVICE_REJOIN_EVT\r\n");
 #if ZG_BUILD_ENDDEVICE_TYPE
-        bdb_ZedAttemptRecoverNwk();
+        zclCommissioning_AttemptRejoin();
 #endif
         return (events ^ APP_COMMISSIONING_END_DEVICE_REJOIN_EVT);
     }
 
     if (events & APP_COMMISSIONING_CLOCK_DOWN_POLING_RATE_EVT) {
-        LREPMaster("APP_CLOCK_DOWN_POLING_RATE_EVT\r\n");
+        LOGT("APP_CLOCK_DOWN_POLING_RATE_EVT\r\n");
         zclCommissioning_Sleep(true);
         return (events ^ APP_COMMISSIONING_CLOCK_DOWN_POLING_RATE_EVT);
     }
@@ -172,22 +220,20 @@ uint16 zclCommissioning_event_loop(uint8 task_id, uint16 events) {
 
 static void zclCommissioning_BindNotification(bdbBindNotificationData_t *data) {
     HalLedSet(HAL_LED_1, HAL_LED_MODE_BLINK);
-    LREP("Recieved bind request clusterId=0x%X dstAddr=0x%X ep=%d\r\n", data->clusterId, data->dstAddr, data->ep);
+    LOGT("Recieved bind request clusterId=0x%X dstAddr=0x%X ep=%d\r\n", data->clusterId, data->dstAddr, data->ep);
     uint16 maxEntries = 0, usedEntries = 0;
     bindCapacity(&maxEntries, &usedEntries);
-    LREP("bindCapacity %d %usedEntries %d \r\n", maxEntries, usedEntries);
+    LOGT("bindCapacity %d %usedEntries %d \r\n", maxEntries, usedEntries);
 }
 
 void zclCommissioning_HandleKeys(uint8 portAndAction, uint8 keyCode) {
     if (portAndAction & HAL_KEY_PRESS) {
 #if ZG_BUILD_ENDDEVICE_TYPE
         if (devState == DEV_NWK_ORPHAN) {
-            LREP("devState=%d try to restore network\r\n", devState);
+            LOGI("devState=%d try to restore network\r\n", devState);
             bdb_ZedAttemptRecoverNwk();
         }
 #endif
+        zclCommissioning_FastPoll();
     }
-    #if defined(POWER_SAVING)
-        NLME_SetPollRate(0);
-    #endif
 }
\ No newline at end of file
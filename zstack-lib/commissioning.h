@@ -1,20 +1,36 @@
 #ifndef commissioning_h
 #define commissioning_h
 
+#include "rejoin.h"
+
 #define APP_COMMISSIONING_CLOCK_DOWN_POLING_RATE_EVT  0x0001
 #define APP_COMMISSIONING_END_DEVICE_REJOIN_EVT       0x0002
 
-#define APP_COMMISSIONING_END_DEVICE_REJOIN_MAX_DELAY ((uint32)2700000) // 45 minutes 45 * 60 * 1000
-#define APP_COMMISSIONING_END_DEVICE_REJOIN_START_DELAY 10 * 1000 // 10 seconds
-#define APP_COMMISSIONING_END_DEVICE_REJOIN_BACKOFF ((float) 1.4)
-#define APP_COMMISSIONING_END_DEVICE_REJOIN_TRIES 5
+// end devices poll the parent this often after inbound traffic or a report, ms
+#ifndef APP_COMMISSIONING_FAST_POLL_RATE
+    #define APP_COMMISSIONING_FAST_POLL_RATE 250
+#endif
+// and for this long before going back to the configured rate, ms
+#ifndef APP_COMMISSIONING_FAST_POLL_WINDOW
+    #define APP_COMMISSIONING_FAST_POLL_WINDOW 10000
+#endif
+
+
 
 
+typedef void (*zclCommissioning_ConnectCB_t)(void);
 
+extern rejoin_t zclCommissioning_Rejoin;
 
 extern void zclCommissioning_Init(uint8 task_id);
 extern uint16 zclCommissioning_event_loop(uint8 task_id, uint16 events);
 extern void zclCommissioning_Sleep( uint8 allow );
 extern void zclCommissioning_HandleKeys(uint8 portAndAction, uint8 keyCode);
+// called on join, network restore at start-up and parent recovery
+extern void zclCommissioning_RegisterConnectCB(zclCommissioning_ConnectCB_t cb);
+// parent poll rate outside of fast poll windows, ms, 0 - don't poll
+extern void zclCommissioning_SetPollRate(uint16 rate);
+// polls fast for APP_COMMISSIONING_FAST_POLL_WINDOW, so the coordinator's follow-up commands aren't held by the parent
+extern void zclCommissioning_FastPoll(void);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "consumption.h"
+#include "Debug.h"
+#include "OSAL.h"
+#include "OSAL_Clock.h"
+#include "OSAL_Nv.h"
+#include "ZComDef.h"
+
+#define CONSUMPTION_DAY_SEC ((uint32)24 * 60 * 60)
+
+typedef struct {
+    uint16 Day;   // local days since 2000-01-01 of DayTiers, 0 - no snapshot yet
+    uint16 Month; // year * 12 + month of MonthTiers
+    uint32 DayTiers[CONSUMPTION_TIERS];
+    uint32 MonthTiers[CONSUMPTION_TIERS];
+    uint32 PreviousDay;
+    uint32 PreviousMonth;
+} consumptionSnapshot_t;
+
+static bool zclConsumption_Valid(consumptionSnapshot_t const *snapshot);
+static void zclConsumption_Current(uint32 const *tiers);
+static uint32 zclConsumption_Since(uint32 const *tiers, uint32 const *snapshot);
+static void zclConsumption_Save(void);
+
+consumption_t zclConsumption = {.CurrentDay = 0, .PreviousDay = 0, .CurrentMonth = 0, .PreviousMonth = 0};
+
+static consumptionSnapshot_t zclConsumption_Snapshot;
+
+void zclConsumption_Init(void) {
+    // a new item starts without snapshots rather than with erased flash
+    osal_memset(&zclConsumption_Snapshot, 0, sizeof(consumptionSnapshot_t));
+    uint8 status = osal_nv_item_init(CONSUMPTION_NV_ID, sizeof(consumptionSnapshot_t), &zclConsumption_Snapshot);
+
+    if ((status != ZSUCCESS && status != NV_ITEM_UNINIT) ||
+        osal_nv_read(CONSUMPTION_NV_ID, 0, sizeof(consumptionSnapshot_t), &zclConsumption_Snapshot) != ZSUCCESS ||
+        !zclConsumption_Valid(&zclConsumption_Snapshot)) {
+        osal_memset(&zclConsumption_Snapshot, 0, sizeof(consumptionSnapshot_t));
+    }
+    zclConsumption.PreviousDay = zclConsumption_Snapshot.PreviousDay;
+    zclConsumption.PreviousMonth = zclConsumption_Snapshot.PreviousMonth;
+    LOGI("zclConsumption_Init status=%d day=%d month=%d\r\n", status, zclConsumption_Snapshot.Day, zclConsumption_Snapshot.Month);
+}
+
+void zclConsumption_Refresh(uint32 const *tiers) {
+    if (zclConsumption_Snapshot.Day == 0) {
+        return;
+    }
+    zclConsumption_Current(tiers);
+}
+
+void zclConsumption_Update(uint32 const *tiers, uint32 localTime) {
+    consumptionSnapshot_t *snapshot = &zclConsumption_Snapshot;
+    UTCTimeStruct tm;
+    bool changed = false;
+
+    osal_ConvertUTCTime(&tm, localTime);
+    uint16 day = (uint16)(localTime / CONSUMPTION_DAY_SEC);
+    uint16 month = tm.year * 12 + tm.month;
+
+    if (snapshot->Day != day) {
+        // previous day is known only if the snapshot was taken on the day before
+        snapshot->PreviousDay = snapshot->Day != 0 && (uint16)(day - snapshot->Day) == 1 ? zclConsumption_Since(tiers, snapshot->DayTiers) : 0;
+        osal_memcpy(snapshot->DayTiers, tiers, sizeof(snapshot->DayTiers));
+        snapshot->Day = day;
+        changed = true;
+    }
+    if (snapshot->Month != month) {
+        snapshot->PreviousMonth =
+            snapshot->Month != 0 && (uint16)(month - snapshot->Month) == 1 ? zclConsumption_Since(tiers, snapshot->MonthTiers) : 0;
+        osal_memcpy(snapshot->MonthTiers, tiers, sizeof(snapshot->MonthTiers));
+        snapshot->Month = month;
+        changed = true;
+    }
+    if (changed) {
+        zclConsumption_Save();
+    }
+    zclConsumption_Current(tiers);
+}
+
+// erased flash, an item written by a build that created it without data
+static bool zclConsumption_Valid(consumptionSnapshot_t const *snapshot) {
+    return snapshot->Day != 0xFFFF && snapshot->Month != 0xFFFF && (snapshot->Day == 0) == (snapshot->Month == 0) &&
+           snapshot->PreviousDay != 0xFFFFFFFF && snapshot->PreviousMonth != 0xFFFFFFFF;
+}
+
+static void zclConsumption_Current(uint32 const *tiers) {
+    zclConsumption.CurrentDay = zclConsumption_Since(tiers, zclConsumption_Snapshot.DayTiers);
+    zclConsumption.PreviousDay = zclConsumption_Snapshot.PreviousDay;
+    zclConsumption.CurrentMonth = zclConsumption_Since(tiers, zclConsumption_Snapshot.MonthTiers);
+    zclConsumption.PreviousMonth = zclConsumption_Snapshot.PreviousMonth;
+}
+
+static uint32 zclConsumption_Since(uint32 const *tiers, uint32 const *snapshot) {
+    uint32 total = 0;
+    for (uint8 i = 0; i < CONSUMPTION_TIERS; i++) {
+        // a register going back means the meter was replaced or reset
+        if (tiers[i] >= snapshot[i]) {
+            total += tiers[i] - snapshot[i];
+        }
+    }
+    return total;
+}
+
+static void zclConsumption_Save(void) {
+    uint8 status = osal_nv_write(CONSUMPTION_NV_ID, 0, sizeof(consumptionSnapshot_t), &zclConsumption_Snapshot);
+    LOGI("zclConsumption_Save day=%d month=%d status=%d\r\n", zclConsumption_Snapshot.Day, zclConsumption_Snapshot.Month, status);
+}
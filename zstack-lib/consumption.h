@@ -0,0 +1,41 @@
+#ifndef CONSUMPTION_H
+#define CONSUMPTION_H
+
+#include "hal_types.h"
+
+// Day and month consumption from snapshots of the tariff registers taken at local
+// midnight and at the first day of a month. Snapshots live in one NV item, written
+// once per day, so a reboot keeps the current day and month figures.
+#ifndef CONSUMPTION_NV_ID
+    #define CONSUMPTION_NV_ID 0x0403
+#endif
+
+#define CONSUMPTION_TIERS 4
+
+typedef struct {
+    uint32 CurrentDay;
+    uint32 PreviousDay;
+    uint32 CurrentMonth;
+    uint32 PreviousMonth;
+} consumption_t;
+
+extern consumption_t zclConsumption;
+
+/*
+ * Restores snapshots from NV
+ */
+extern void zclConsumption_Init(void);
+
+/*
+ * Feeds tariff registers read at localTime (seconds since 2000-01-01),
+ * takes new snapshots on day and month change and refreshes zclConsumption
+ */
+extern void zclConsumption_Update(uint32 const *tiers, uint32 localTime);
+
+/*
+ * Refreshes current day and month of zclConsumption from the stored snapshots, for
+ * registers read before the clock is known. Takes no snapshots
+ */
+extern void zclConsumption_Refresh(uint32 const *tiers);
+
+#endif // CONSUMPTION_H
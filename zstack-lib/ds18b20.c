@@ -1,17 +1,13 @@
 #include "ds18b20.h"
 #include "OnBoard.h"
+#define LOG_MODULE_LEVEL LOG_LEVEL_DS18B20
+#include "Debug.h"
 
 #define DS18B20_SKIP_ROM 0xCC
 #define DS18B20_CONVERT_T 0x44
 #define DS18B20_READ_SCRATCHPAD 0xBE
 #define DS18B20_WRITE_SCRATCHPAD 0x4E
 
-// Device resolution
-#define DS18B20_TEMP_9_BIT 0x1F  //  9 bit
-#define DS18B20_TEMP_10_BIT 0x3F // 10 bit
-#define DS18B20_TEMP_11_BIT 0x5F // 11 bit
-#define DS18B20_TEMP_12_BIT 0x7F // 12 bit
-
 #ifndef DS18B20_RESOLUTION
 #define DS18B20_RESOLUTION DS18B20_TEMP_10_BIT
 #endif
@@ -33,7 +29,6 @@ static uint8 ds18b20_read_byte(void);
 static uint8 ds18b20_Reset(void);
 static void ds18b20_GroudPins(void);
 static void ds18b20_setResolution(uint8 resolution);
-static int16 ds18b20_convertTemperature(uint8 temp1, uint8 temp2, uint8 resolution);
 
 static void _delay_us(uint16 microSecs) {
     while (microSecs--)
@@ -140,8 +135,7 @@ static void ds18b20_setResolution(uint8 resolution) {
     ds18b20_send_byte(resolution);
     ds18b20_Reset();
 }
-static int16 ds18b20_convertTemperature(uint8 temp1, uint8 temp2, uint8 resolution) {
-    float temperature = 0;
+int16 ds18b20_convertTemperature(uint8 temp1, uint8 temp2, uint8 resolution) {
     uint8 ignoreMask = 0;
     switch (resolution) {
     case DS18B20_TEMP_9_BIT:
@@ -163,16 +157,9 @@ static int16 ds18b20_convertTemperature(uint8 temp1, uint8 temp2, uint8 resoluti
     default:
         break;
     }
-    temperature = (uint16)temp1 | (uint16)(ignoreMask ? temp2 & ignoreMask : temp2) << 8;
-    // neg. temp
-    if (temp2 & (BV(3))) {
-        temperature = temperature / 16.0 - 128.0;
-    }
-    // pos. temp
-    else {
-        temperature = temperature / 16.0;
-    }
-    return (int16)(temperature * 100);
+    // two's complement in 1/16 C, undefined low bits of the LSB dropped
+    int16 raw = (int16)(((uint16)temp2 << 8) | (temp1 & ~ignoreMask));
+    return (int16)((int32)raw * 100 / 16);
 }
 
 int16 readTemperature(void) {
@@ -195,11 +182,13 @@ int16 readTemperature(void) {
 
         if (temp1 == 0xff && temp2 == 0xff) {
             // No sensor found.
+            LOGW("DS18B20 not found\r\n");
             ds18b20_GroudPins();
             return 1;
         }
         if (temp1 == 0x50 && temp2 == 0x05) {
             // Power-up State, not ready yet
+            LOGT("DS18B20 not ready, retries left %d\r\n", retry_count);
             retry_count--;
             continue;
         }
@@ -208,6 +197,7 @@ int16 readTemperature(void) {
         return ds18b20_convertTemperature(temp1, temp2, DS18B20_RESOLUTION);
     }
 
+    LOGW("DS18B20 conversion timeout\r\n");
     ds18b20_GroudPins();
     return 1;
 }
\ No newline at end of file
@@ -1,4 +1,12 @@
 #ifndef ds18b20_h
+// Device resolution
+#define DS18B20_TEMP_9_BIT 0x1F  //  9 bit
+#define DS18B20_TEMP_10_BIT 0x3F // 10 bit
+#define DS18B20_TEMP_11_BIT 0x5F // 11 bit
+#define DS18B20_TEMP_12_BIT 0x7F // 12 bit
+
 int16 readTemperature(void);
+// scratchpad LSB and MSB to 0.01 C
+int16 ds18b20_convertTemperature(uint8 temp1, uint8 temp2, uint8 resolution);
 #define ds18b20_h
 #endif
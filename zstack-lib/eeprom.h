@@ -0,0 +1,22 @@
+#ifndef EEPROM_H
+#define EEPROM_H
+
+#include "hal_types.h"
+
+#define EEPROM_SUCCESS 0
+#define EEPROM_ERROR 1
+
+// Reads len bytes starting at address
+typedef int8 (*eeprom_read_t)(uint16 address, uint8 *buf, uint16 len);
+// Writes len bytes starting at address, data must not cross a page boundary.
+// Returns when the write cycle is finished.
+typedef int8 (*eeprom_write_t)(uint16 address, uint8 *buf, uint16 len);
+
+typedef struct {
+    eeprom_read_t Read;
+    eeprom_write_t Write;
+    uint16 PageSize;
+    uint32 Size;
+} zclEeprom_t;
+
+#endif // EEPROM_H
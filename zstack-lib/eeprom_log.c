@@ -0,0 +1,184 @@
+#include "eeprom_log.h"
+#include "Debug.h"
+#include "OSAL.h"
+
+#define EEPROM_LOG_MAGIC 0x4C4D // "ML"
+#define EEPROM_LOG_VERSION 1
+#define EEPROM_LOG_HEADER_SIZE 12
+#define EEPROM_LOG_HEADER_SLOT_SIZE 16
+
+typedef struct {
+    uint16 Seq;   // sequence number of the record at Head
+    uint16 Head;  // index of the last written record
+    uint16 Count; // number of valid records
+} eepromLogState_t;
+
+static bool zclEepromLog_ReadHeader(uint8 slot, eepromLogState_t *state);
+static void zclEepromLog_WriteHeader(void);
+static bool zclEepromLog_ReadRecord(uint16 index, eepromLogRecord_t *record);
+static uint16 zclEepromLog_Crc(uint8 const *buf, uint8 len);
+static uint16 zclEepromLog_RecordAddress(uint16 index);
+
+static zclEeprom_t const *zclEepromLog_Dev = NULL;
+static eepromLogState_t zclEepromLog_State;
+static uint16 zclEepromLog_Records = 0;
+
+void zclEepromLog_Init(zclEeprom_t const *dev) {
+    eepromLogState_t slotState;
+    eepromLogRecord_t record;
+    bool found = false;
+
+    zclEepromLog_Dev = dev;
+    zclEepromLog_Records = (dev->Size - dev->PageSize) / EEPROM_LOG_RECORD_SIZE;
+
+    for (uint8 slot = 0; slot < 2; slot++) {
+        if (zclEepromLog_ReadHeader(slot, &slotState) && (!found || (int16)(slotState.Seq - zclEepromLog_State.Seq) > 0)) {
+            zclEepromLog_State = slotState;
+            found = true;
+        }
+    }
+    if (!found) {
+        zclEepromLog_State.Seq = 0;
+        zclEepromLog_State.Head = zclEepromLog_Records - 1;
+        zclEepromLog_State.Count = 0;
+    }
+
+    // header is only a hint, records written after it are found by their sequence numbers
+    for (uint16 i = 0; i < zclEepromLog_Records; i++) {
+        uint16 next = (zclEepromLog_State.Head + 1) % zclEepromLog_Records;
+        if (!zclEepromLog_ReadRecord(next, &record) || record.Seq != (uint16)(zclEepromLog_State.Seq + 1)) {
+            break;
+        }
+        zclEepromLog_State.Head = next;
+        zclEepromLog_State.Seq = record.Seq;
+        if (zclEepromLog_State.Count < zclEepromLog_Records) {
+            zclEepromLog_State.Count++;
+        }
+    }
+    LOGI("zclEepromLog_Init head=%d seq=%d count=%d\r\n", zclEepromLog_State.Head, zclEepromLog_State.Seq, zclEepromLog_State.Count);
+}
+
+int8 zclEepromLog_Append(uint32 time, uint8 const *payload) {
+    uint8 buf[EEPROM_LOG_RECORD_SIZE];
+    uint16 next = (zclEepromLog_State.Head + 1) % zclEepromLog_Records;
+    uint16 seq = zclEepromLog_State.Seq + 1;
+
+    if (zclEepromLog_Dev == NULL) {
+        return EEPROM_ERROR;
+    }
+
+    buf[0] = LO_UINT16(seq);
+    buf[1] = HI_UINT16(seq);
+    buf[2] = BREAK_UINT32(time, 0);
+    buf[3] = BREAK_UINT32(time, 1);
+    buf[4] = BREAK_UINT32(time, 2);
+    buf[5] = BREAK_UINT32(time, 3);
+    osal_memcpy(&buf[6], payload, EEPROM_LOG_PAYLOAD_SIZE);
+    uint16 crc = zclEepromLog_Crc(buf, EEPROM_LOG_RECORD_SIZE - 2);
+    buf[EEPROM_LOG_RECORD_SIZE - 2] = LO_UINT16(crc);
+    buf[EEPROM_LOG_RECORD_SIZE - 1] = HI_UINT16(crc);
+
+    // record size divides the page size, so a record is always a single page write
+    if ((*zclEepromLog_Dev->Write)(zclEepromLog_RecordAddress(next), buf, EEPROM_LOG_RECORD_SIZE) != EEPROM_SUCCESS) {
+        LOGE("zclEepromLog_Append write failed\r\n");
+        return EEPROM_ERROR;
+    }
+
+    zclEepromLog_State.Head = next;
+    zclEepromLog_State.Seq = seq;
+    if (zclEepromLog_State.Count < zclEepromLog_Records) {
+        zclEepromLog_State.Count++;
+    }
+    if (seq % EEPROM_LOG_HEADER_EVERY == 0) {
+        zclEepromLog_WriteHeader();
+    }
+    return EEPROM_SUCCESS;
+}
+
+int8 zclEepromLog_Read(uint16 index, eepromLogRecord_t *record) {
+    if (zclEepromLog_Dev == NULL || index >= zclEepromLog_State.Count) {
+        return EEPROM_ERROR;
+    }
+    uint16 position = (zclEepromLog_State.Head + zclEepromLog_Records - index) % zclEepromLog_Records;
+    return zclEepromLog_ReadRecord(position, record) ? EEPROM_SUCCESS : EEPROM_ERROR;
+}
+
+uint16 zclEepromLog_Count(void) { return zclEepromLog_State.Count; }
+
+uint16 zclEepromLog_Capacity(void) { return zclEepromLog_Records; }
+
+static bool zclEepromLog_ReadHeader(uint8 slot, eepromLogState_t *state) {
+    uint8 buf[EEPROM_LOG_HEADER_SIZE];
+
+    if ((*zclEepromLog_Dev->Read)(slot * EEPROM_LOG_HEADER_SLOT_SIZE, buf, sizeof(buf)) != EEPROM_SUCCESS) {
+        return false;
+    }
+    if (BUILD_UINT16(buf[0], buf[1]) != EEPROM_LOG_MAGIC || buf[2] != EEPROM_LOG_VERSION || buf[3] != EEPROM_LOG_RECORD_SIZE ||
+        BUILD_UINT16(buf[10], buf[11]) != zclEepromLog_Crc(buf, EEPROM_LOG_HEADER_SIZE - 2)) {
+        return false;
+    }
+    state->Seq = BUILD_UINT16(buf[4], buf[5]);
+    state->Head = BUILD_UINT16(buf[6], buf[7]);
+    state->Count = BUILD_UINT16(buf[8], buf[9]);
+    return state->Head < zclEepromLog_Records && state->Count <= zclEepromLog_Records;
+}
+
+static void zclEepromLog_WriteHeader(void) {
+    uint8 buf[EEPROM_LOG_HEADER_SIZE];
+    // alternate slots, so an interrupted write leaves the previous copy intact
+    uint8 slot = (zclEepromLog_State.Seq / EEPROM_LOG_HEADER_EVERY) & 0x01;
+
+    buf[0] = LO_UINT16(EEPROM_LOG_MAGIC);
+    buf[1] = HI_UINT16(EEPROM_LOG_MAGIC);
+    buf[2] = EEPROM_LOG_VERSION;
+    buf[3] = EEPROM_LOG_RECORD_SIZE;
+    buf[4] = LO_UINT16(zclEepromLog_State.Seq);
+    buf[5] = HI_UINT16(zclEepromLog_State.Seq);
+    buf[6] = LO_UINT16(zclEepromLog_State.Head);
+    buf[7] = HI_UINT16(zclEepromLog_State.Head);
+    buf[8] = LO_UINT16(zclEepromLog_State.Count);
+    buf[9] = HI_UINT16(zclEepromLog_State.Count);
+    uint16 crc = zclEepromLog_Crc(buf, EEPROM_LOG_HEADER_SIZE - 2);
+    buf[10] = LO_UINT16(crc);
+    buf[11] = HI_UINT16(crc);
+
+    uint8 status = (*zclEepromLog_Dev->Write)(slot * EEPROM_LOG_HEADER_SLOT_SIZE, buf, sizeof(buf));
+    LOGT("zclEepromLog_WriteHeader slot=%d status=%d\r\n", slot, status);
+}
+
+static bool zclEepromLog_ReadRecord(uint16 index, eepromLogRecord_t *record) {
+    uint8 buf[EEPROM_LOG_RECORD_SIZE];
+
+    if ((*zclEepromLog_Dev->Read)(zclEepromLog_RecordAddress(index), buf, EEPROM_LOG_RECORD_SIZE) != EEPROM_SUCCESS) {
+        return false;
+    }
+    record->Crc = BUILD_UINT16(buf[EEPROM_LOG_RECORD_SIZE - 2], buf[EEPROM_LOG_RECORD_SIZE - 1]);
+    if (record->Crc != zclEepromLog_Crc(buf, EEPROM_LOG_RECORD_SIZE - 2)) {
+        return false;
+    }
+    record->Seq = BUILD_UINT16(buf[0], buf[1]);
+    record->Time = BUILD_UINT32(buf[2], buf[3], buf[4], buf[5]);
+    osal_memcpy(record->Payload, &buf[6], EEPROM_LOG_PAYLOAD_SIZE);
+    return true;
+}
+
+static uint16 zclEepromLog_RecordAddress(uint16 index) {
+    return zclEepromLog_Dev->PageSize + index * EEPROM_LOG_RECORD_SIZE;
+}
+
+// CRC-16/MODBUS
+static uint16 zclEepromLog_Crc(uint8 const *buf, uint8 len) {
+    uint16 crc = 0xFFFF;
+
+    for (uint8 i = 0; i < len; i++) {
+        crc ^= buf[i];
+        for (uint8 bit = 0; bit < 8; bit++) {
+            if (crc & 0x0001) {
+                crc = (crc >> 1) ^ 0xA001;
+            } else {
+                crc >>= 1;
+            }
+        }
+    }
+    return crc;
+}
@@ -0,0 +1,52 @@
+#ifndef EEPROM_LOG_H
+#define EEPROM_LOG_H
+
+#include "eeprom.h"
+
+#ifndef EEPROM_LOG
+    #define EEPROM_LOG FALSE
+#endif
+
+#ifndef EEPROM_LOG_INTERVAL_MIN
+    #define EEPROM_LOG_INTERVAL_MIN 60
+#endif
+
+// record is Seq(2) + Time(4) + payload + Crc(2), keep it a divisor of the page size
+#ifndef EEPROM_LOG_RECORD_SIZE
+    #define EEPROM_LOG_RECORD_SIZE 32
+#endif
+
+#define EEPROM_LOG_PAYLOAD_SIZE (EEPROM_LOG_RECORD_SIZE - 8)
+
+// header position hint is rewritten once per this many records
+#ifndef EEPROM_LOG_HEADER_EVERY
+    #define EEPROM_LOG_HEADER_EVERY 16
+#endif
+
+typedef struct {
+    uint16 Seq;
+    uint32 Time;
+    uint8 Payload[EEPROM_LOG_PAYLOAD_SIZE];
+    uint16 Crc;
+} eepromLogRecord_t;
+
+/*
+ * Restores log position from the header and the records following it.
+ * First page of the device holds two copies of the header, records start from the second page.
+ */
+extern void zclEepromLog_Init(zclEeprom_t const *dev);
+
+/*
+ * Appends a record, overwriting the oldest one when the log is full
+ */
+extern int8 zclEepromLog_Append(uint32 time, uint8 const *payload);
+
+/*
+ * Reads record written index records before the last one (0 - the last)
+ */
+extern int8 zclEepromLog_Read(uint16 index, eepromLogRecord_t *record);
+
+extern uint16 zclEepromLog_Count(void);
+extern uint16 zclEepromLog_Capacity(void);
+
+#endif // EEPROM_LOG_H
@@ -1,5 +1,6 @@
 #include "factory_reset.h"
 #include "AF.h"
+#define LOG_MODULE_LEVEL LOG_LEVEL_FACTORY_RESET
 #include "Debug.h"
 #include "OnBoard.h"
 #include "bdb.h"
@@ -15,15 +16,15 @@ static void zclFactoryResetter_ResetBootCounter(void);
 static uint8 zclFactoryResetter_TaskID;
 
 uint16 zclFactoryResetter_loop(uint8 task_id, uint16 events) {
-    LREP("zclFactoryResetter_loop 0x%X\r\n", events);
+    LOGT("zclFactoryResetter_loop 0x%X\r\n", events);
     if (events & FACTORY_RESET_EVT) {
-        LREPMaster("FACTORY_RESET_EVT\r\n");
+        LOGT("FACTORY_RESET_EVT\r\n");
         zclFactoryResetter_ResetToFN();
         return (events ^ FACTORY_RESET_EVT);
     }
 
     if (events & FACTORY_BOOTCOUNTER_RESET_EVT) {
-        LREPMaster("FACTORY_BOOTCOUNTER_RESET_EVT\r\n");
+        LOGT("FACTORY_BOOTCOUNTER_RESET_EVT\r\n");
         zclFactoryResetter_ResetBootCounter();
         return (events ^ FACTORY_BOOTCOUNTER_RESET_EVT);
     }
@@ -31,7 +32,7 @@ uint16 zclFactoryResetter_loop(uint8 task_id, uint16 events) {
 }
 void zclFactoryResetter_ResetBootCounter(void) {
     uint16 bootCnt = 0;
-    LREPMaster("Clear boot counter\r\n");
+    LOGI("Clear boot counter\r\n");
     osal_nv_write(ZCD_NV_BOOTCOUNTER, 0, sizeof(bootCnt), &bootCnt);
 }
 
@@ -49,23 +50,23 @@ void zclFactoryResetter_Init(uint8 task_id) {
 
 void zclFactoryResetter_ResetToFN(void) {
     HalLedSet(HAL_LED_1, HAL_LED_MODE_FLASH);
-    LREP("bdbAttributes.bdbNodeIsOnANetwork=%d bdbAttributes.bdbCommissioningMode=0x%X\r\n", bdbAttributes.bdbNodeIsOnANetwork, bdbAttributes.bdbCommissioningMode);
-    LREPMaster("zclFactoryResetter: Reset to FN\r\n");
+    LOGT("bdbAttributes.bdbNodeIsOnANetwork=%d bdbAttributes.bdbCommissioningMode=0x%X\r\n", bdbAttributes.bdbNodeIsOnANetwork, bdbAttributes.bdbCommissioningMode);
+    LOGI("zclFactoryResetter: Reset to FN\r\n");
     bdb_resetLocalAction();
 }
 
 void zclFactoryResetter_HandleKeys(uint8 portAndAction, uint8 keyCode) {
 #if FACTORY_RESET_BY_LONG_PRESS
     if (portAndAction & HAL_KEY_RELEASE) {
-        LREPMaster("zclFactoryResetter: Key release\r\n");
+        LOGT("zclFactoryResetter: Key release\r\n");
         osal_stop_timerEx(zclFactoryResetter_TaskID, FACTORY_RESET_EVT);
     } else {
-        LREPMaster("zclFactoryResetter: Key press\r\n");
+        LOGT("zclFactoryResetter: Key press\r\n");
         bool statTimer = true;
 #if FACTORY_RESET_BY_LONG_PRESS_PORT
         statTimer = FACTORY_RESET_BY_LONG_PRESS_PORT & portAndAction;
 #endif
-        LREP("zclFactoryResetter statTimer hold timer %d\r\n", statTimer);
+        LOGT("zclFactoryResetter statTimer hold timer %d\r\n", statTimer);
         if (statTimer) {
             uint32 timeout = bdbAttributes.bdbNodeIsOnANetwork ? FACTORY_RESET_HOLD_TIME_LONG : FACTORY_RESET_HOLD_TIME_FAST;
             osal_start_timerEx(zclFactoryResetter_TaskID, FACTORY_RESET_EVT, timeout);
@@ -75,17 +76,17 @@ void zclFactoryResetter_HandleKeys(uint8 portAndAction, uint8 keyCode) {
 }
 
 void zclFactoryResetter_ProcessBootCounter(void) {
-    LREPMaster("zclFactoryResetter_ProcessBootCounter\r\n");
+    LOGT("zclFactoryResetter_ProcessBootCounter\r\n");
     osal_start_timerEx(zclFactoryResetter_TaskID, FACTORY_BOOTCOUNTER_RESET_EVT, FACTORY_RESET_BOOTCOUNTER_RESET_TIME);
 
     uint16 bootCnt = 0;
     if (osal_nv_item_init(ZCD_NV_BOOTCOUNTER, sizeof(bootCnt), &bootCnt) == ZSUCCESS) {
         osal_nv_read(ZCD_NV_BOOTCOUNTER, 0, sizeof(bootCnt), &bootCnt);
     }
-    LREP("bootCnt %d\r\n", bootCnt);
+    LOGT("bootCnt %d\r\n", bootCnt);
     bootCnt += 1;
     if (bootCnt >= FACTORY_RESET_BOOTCOUNTER_MAX_VALUE) {
-        LREP("bootCnt =%d greater than, ressetting %d\r\n", bootCnt, FACTORY_RESET_BOOTCOUNTER_MAX_VALUE);
+        LOGI("bootCnt =%d greater than, ressetting %d\r\n", bootCnt, FACTORY_RESET_BOOTCOUNTER_MAX_VALUE);
         bootCnt = 0;
         osal_stop_timerEx(zclFactoryResetter_TaskID, FACTORY_BOOTCOUNTER_RESET_EVT);
         osal_start_timerEx(zclFactoryResetter_TaskID, FACTORY_RESET_EVT, 5000);
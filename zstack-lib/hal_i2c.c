@@ -40,6 +40,7 @@
 #include "hal_i2c.h"
 
 #include "Debug.h"
+#include "OnBoard.h"
 #include "ioCC2530.h"
 #include "zcomdef.h"
 #include "utils.h"
@@ -50,6 +51,23 @@
 #define HAL_I2C_RETRY_CNT 3
 #endif
 
+// busy-wait count per half of SCL period, 0 - as fast as the port can toggle
+#ifndef HAL_I2C_CLOCK_DIVISOR
+#define HAL_I2C_CLOCK_DIVISOR 1
+#endif
+
+// how long a slave may hold SCL low
+#ifndef HAL_I2C_STRETCH_TIMEOUT_US
+#define HAL_I2C_STRETCH_TIMEOUT_US 10000
+#endif
+
+// how long HalI2CAckPoll waits for a busy slave, covers 24Cxx write cycle
+#ifndef HAL_I2C_ACK_POLL_TIMEOUT_US
+#define HAL_I2C_ACK_POLL_TIMEOUT_US 10000
+#endif
+
+#define HAL_I2C_ACK_POLL_INTERVAL_US 50
+
 // the default cofiguration below uses P0.6 for SDA and P0.5 for SCL.
 // change these as needed.
 #ifndef OCM_CLK_PORT
@@ -116,6 +134,7 @@ STATIC void hali2cSendDeviceAddress(uint8 address);
 STATIC __near_func void hali2cWait(uint8);
 
 static void hali2cGroudPins(void);
+static void hali2cReceiveBlock(uint8 *buffer, uint16 len);
 
 void hali2cGroudPins(void) {
     IO_DIR_PORT_PIN(OCM_DATA_PORT, OCM_DATA_PIN, IO_IN);
@@ -123,6 +142,8 @@ void hali2cGroudPins(void) {
 }
 
 STATIC uint8 s_xmemIsInit;
+STATIC uint8 s_clockDivisor = HAL_I2C_CLOCK_DIVISOR;
+STATIC bool s_busError = FALSE;
 
 /*********************************************************************
  * @fn      HalI2CInit
@@ -152,6 +173,105 @@ void HalI2CInit(void) {
     }
 }
 
+/*********************************************************************
+ * @fn      HalI2CSetClockDivisor
+ * @brief   Sets busy-wait count per half of SCL period
+ * @param   divisor - 0 for the fastest clock
+ * @return  void
+ */
+void HalI2CSetClockDivisor(uint8 divisor) { s_clockDivisor = divisor; }
+
+/*********************************************************************
+ * @fn      HalI2CWriteBlock
+ * @brief   Writes prefix (register or memory address) and data in a
+ *          single transaction
+ * @param   address: 7-bit slave address
+ * @param   prefix: bytes sent before data, may be NULL
+ * @param   prefixLen: number of prefix bytes
+ * @param   buf: data to write
+ * @param   len: number of data bytes
+ * @return  I2C_SUCCESS if every byte was acknowledged
+ */
+int8 HalI2CWriteBlock(uint8 address, uint8 *prefix, uint8 prefixLen, uint8 *buf, uint16 len) {
+    uint16 i;
+    bool ack;
+
+    s_busError = FALSE;
+    hali2cStart();
+    ack = hali2cSendByte((address << 1) | OCM_WRITE);
+    for (i = 0; ack && i < prefixLen; i++) {
+        ack = hali2cSendByte(prefix[i]);
+    }
+    for (i = 0; ack && i < len; i++) {
+        ack = hali2cSendByte(buf[i]);
+    }
+    hali2cStop();
+
+    return (ack && !s_busError) ? I2C_SUCCESS : I2C_ERROR;
+}
+
+/*********************************************************************
+ * @fn      HalI2CReadBlock
+ * @brief   Writes prefix (register or memory address), then reads data
+ *          after a repeated start
+ * @param   address: 7-bit slave address
+ * @param   prefix: bytes sent before reading, may be NULL
+ * @param   prefixLen: number of prefix bytes, 0 - read from current address
+ * @param   buf: target array for read bytes
+ * @param   len: number of bytes to read
+ * @return  I2C_SUCCESS if slave acknowledged and the bus didn't time out
+ */
+int8 HalI2CReadBlock(uint8 address, uint8 *prefix, uint8 prefixLen, uint8 *buf, uint16 len) {
+    bool ack = TRUE;
+
+    if (!len) {
+        return I2C_ERROR;
+    }
+
+    s_busError = FALSE;
+    if (prefixLen) {
+        hali2cStart();
+        ack = hali2cSendByte((address << 1) | OCM_WRITE);
+        for (uint8 i = 0; ack && i < prefixLen; i++) {
+            ack = hali2cSendByte(prefix[i]);
+        }
+    }
+    if (ack) {
+        // repeated start
+        hali2cStart();
+        ack = hali2cSendByte((address << 1) | OCM_READ);
+    }
+    if (ack) {
+        hali2cReceiveBlock(buf, len);
+    }
+    hali2cStop();
+
+    return (ack && !s_busError) ? I2C_SUCCESS : I2C_ERROR;
+}
+
+/*********************************************************************
+ * @fn      HalI2CAckPoll
+ * @brief   Waits until slave acknowledges its address, e.g. EEPROM
+ *          finished internal write cycle
+ * @param   address: 7-bit slave address
+ * @return  I2C_SUCCESS when acknowledged within HAL_I2C_ACK_POLL_TIMEOUT_US
+ */
+int8 HalI2CAckPoll(uint8 address) {
+    uint16 tries = HAL_I2C_ACK_POLL_TIMEOUT_US / HAL_I2C_ACK_POLL_INTERVAL_US;
+
+    while (tries--) {
+        s_busError = FALSE;
+        hali2cStart();
+        bool ack = hali2cSendByte((address << 1) | OCM_WRITE);
+        hali2cStop();
+        if (ack && !s_busError) {
+            return I2C_SUCCESS;
+        }
+        MicroWait(HAL_I2C_ACK_POLL_INTERVAL_US);
+    }
+    return I2C_ERROR;
+}
+
 int8 HalI2CReceive(uint8 address, uint8 *buf, uint16 len) {
     hali2cReceive(address, buf, len);
 
@@ -220,7 +340,6 @@ STATIC _Bool hali2cSendByte(uint8 dByte) {
     hali2cClock(0);
     OCM_DATA_HIGH(); // set to input to receive ack...
     hali2cClock(1);
-    hali2cWait(1);
 
     return (!OCM_SDA); // Return ACK status
 }
@@ -233,7 +352,6 @@ STATIC _Bool hali2cSendByte(uint8 dByte) {
  */
 STATIC void hali2cWrite(bool dBit) {
     hali2cClock(0);
-    hali2cWait(1);
     if (dBit) {
         OCM_DATA_HIGH();
     } else {
@@ -241,7 +359,6 @@ STATIC void hali2cWrite(bool dBit) {
     }
 
     hali2cClock(1);
-    hali2cWait(1);
 }
 
 /*********************************************************************
@@ -251,24 +368,30 @@ STATIC void hali2cWrite(bool dBit) {
  *          edge is going out, the pin is set as an input and the pin
  *          pull-up drives the line high. This way, the slave device
  *          can hold the node low if longer setup time is desired.
+ *          Stretching longer than HAL_I2C_STRETCH_TIMEOUT_US marks the
+ *          transfer as failed.
  * @param   dir - clock line direction
  * @return  void
  */
 STATIC void hali2cClock(bool dir) {
-    uint8 maxWait = 10;
     if (dir) {
         IO_DIR_PORT_PIN(OCM_CLK_PORT, OCM_CLK_PIN, IO_IN);
         /* Wait until clock is high */
-        while (!OCM_SCL && maxWait) {
-            hali2cWait(1);
-            maxWait -= 1;
+        if (!OCM_SCL) {
+            uint16 stretch = HAL_I2C_STRETCH_TIMEOUT_US;
+            while (!OCM_SCL) {
+                if (!stretch--) {
+                    s_busError = TRUE;
+                    break;
+                }
+                MicroWait(1);
+            }
         }
-
     } else {
         IO_DIR_PORT_PIN(OCM_CLK_PORT, OCM_CLK_PIN, IO_OUT);
         OCM_SCL = 0;
     }
-    hali2cWait(1);
+    hali2cWait(s_clockDivisor);
 }
 
 /*********************************************************************
@@ -291,17 +414,16 @@ STATIC void hali2cStart(void) {
         {
             break;
         }
-        hali2cWait(1);
+        hali2cWait(s_clockDivisor);
     } while (--retry);
 
     // SCL low to set SDA high so the transition will be correct.
     hali2cClock(0);
     OCM_DATA_HIGH(); // SDA high
     hali2cClock(1);  // set up for transition
-    hali2cWait(1);
     OCM_DATA_LOW(); // start
 
-    hali2cWait(1);
+    hali2cWait(s_clockDivisor);
     hali2cClock(0);
 }
 
@@ -317,11 +439,10 @@ STATIC void hali2cStop(void) {
     // Wait for clock high and data low
     hali2cClock(0);
     OCM_DATA_LOW(); // force low with SCL low
-    hali2cWait(1);
 
     hali2cClock(1);
     OCM_DATA_HIGH(); // stop condition
-    hali2cWait(1);
+    hali2cWait(s_clockDivisor);
 
     hali2cGroudPins();
 }
@@ -408,9 +529,7 @@ STATIC _Bool hali2cRead(void) {
     // SCL low to let slave set SDA. SCL high for SDA
     // valid and then get bit
     hali2cClock(0);
-    hali2cWait(1);
     hali2cClock(1);
-    hali2cWait(1);
 
     return OCM_SDA;
 }
@@ -434,137 +553,48 @@ STATIC void hali2cSendDeviceAddress(uint8 address) {
     } while (--retry);
 }
 
-// http://e2e.ti.com/support/wireless-connectivity/zigbee-and-thread/f/158/t/140917
 /*********************************************************************
- * @fn      I2C_ReadMultByte
- * @brief   reads data into a buffer
- * @param   address: linear address on part from which to read
- * @param   reg: internal register address on part read from
- * @param   buffer: target array for read characters
- * @param   len: max number of bytes to read
+ * @fn      hali2cReceiveBlock
+ * @brief   Reads len bytes, acknowledging all but the last one
+ * @param   buffer: target array for read bytes
+ * @param   len: number of bytes to read
+ * @return  void
  */
-int8 I2C_ReadMultByte(uint8 address, uint8 reg, uint8 *buffer, uint16 len) {
-    uint16 i = 0;
-    uint8 _address = 0;
-
-    if (!len) {
-        return I2C_ERROR;
-    }
-
-    /* Send START condition */
-    hali2cStart();
-
-    /* Set direction of transmission */
-    // Reset the address bit0 for write
-    // _address &= OCM_WRITE;
-
-    _address = ((address << 1) | OCM_WRITE);
-
-    /* Send Address  and get acknowledgement from slave*/
-    if (!hali2cSendByte(_address)) {
-        return I2C_ERROR;
-    }
-
-    /* Send internal register to read from to */
-    if (!hali2cSendByte(reg))
-        return I2C_ERROR;
-
-    /* Send RESTART condition */
-    hali2cStart();
-
-    /* Set direction of transmission */
-    // Reset the address bit0 for read
-    // _address |= OCM_READ;
-    _address = ((address << 1) | OCM_READ);
-    /* Send Address  and get acknowledgement from slave*/
-    if (!hali2cSendByte(_address))
-        return I2C_ERROR;
-
-    while (len) {
+static void hali2cReceiveBlock(uint8 *buffer, uint16 len) {
+    while (len--) {
         // SCL may be high. set SCL low. If SDA goes high when input
         // mode is set the slave won't see a STOP
         hali2cClock(0);
         OCM_DATA_HIGH();
-        buffer[i] = hali2cReceiveByte();
-        // Acknowledgement if not sending last byte
-        if (len > 1) {
-            hali2cWrite(SMB_ACK); // write leaves SCL high
-        }
-
-        // increment buffer register
-        i++;
-        // Decrement the read bytes counter
-        len--;
+        *buffer++ = hali2cReceiveByte();
+        hali2cWrite(len ? SMB_ACK : SMB_NAK); // write leaves SCL high
     }
-
-    // condition SDA one more time...
-    hali2cClock(0);
-    OCM_DATA_HIGH();
-    hali2cWrite(SMB_NAK);
-
-    hali2cStop();
-
-    // condition SDA one more time...
-    //   hali2cClock(0);
-    //   OCM_DATA_HIGH();
-    //   buffer[i] = hali2cReceiveByte();
-    //   hali2cWrite(SMB_NAK);
-
-    //   hali2cStop();
-    return I2C_SUCCESS;
 }
 
+// http://e2e.ti.com/support/wireless-connectivity/zigbee-and-thread/f/158/t/140917
 /*********************************************************************
- * @fn      I2C_WriteMultByte
+ * @fn      I2C_ReadMultByte
  * @brief   reads data into a buffer
  * @param   address: linear address on part from which to read
  * @param   reg: internal register address on part read from
  * @param   buffer: target array for read characters
  * @param   len: max number of bytes to read
  */
-int8 I2C_WriteMultByte(uint8 address, uint8 reg, uint8 *buffer, uint16 len) {
-    uint16 i = 0;
-    uint8 _address = 0;
+int8 I2C_ReadMultByte(uint8 address, uint8 reg, uint8 *buffer, uint16 len) {
+    return HalI2CReadBlock(address, &reg, 1, buffer, len);
+}
 
+/*********************************************************************
+ * @fn      I2C_WriteMultByte
+ * @brief   writes buffer into consecutive registers
+ * @param   address: linear address on part to write to
+ * @param   reg: internal register address on part to write from
+ * @param   buffer: data to write
+ * @param   len: number of bytes to write
+ */
+int8 I2C_WriteMultByte(uint8 address, uint8 reg, uint8 *buffer, uint16 len) {
     if (!len) {
         return I2C_ERROR;
     }
-
-    /* Send START condition */
-    hali2cStart();
-    // return I2C_ERROR;
-
-    /* Set direction of transmission */
-    // Reset the address bit0 for write
-    // _address &= OCM_WRITE;
-    _address = ((address << 1) | OCM_WRITE);
-
-    /* Send Address  and get acknowledgement from slave*/
-    if (!hali2cSendByte(_address))
-        return I2C_ERROR;
-
-    /* Send internal register to read from to */
-    if (!hali2cSendByte(reg))
-        return I2C_ERROR;
-
-    /* Write data into register */
-    // read bytes of data into buffer
-    while (len) {
-        // SCL may be high. set SCL low. If SDA goes high when input
-        // mode is set the slave won't see a STOP
-        hali2cClock(0);
-        OCM_DATA_HIGH();
-
-        /* Send Address  and get acknowledgement from slave*/
-        if (!hali2cSendByte(buffer[i]))
-            return I2C_ERROR;
-
-        // increment buffer register
-        i++;
-        // Decrement the read bytes counter
-        len--;
-    }
-
-    hali2cStop();
-    return I2C_SUCCESS;
-}
\ No newline at end of file
+    return HalI2CWriteBlock(address, &reg, 1, buffer, len);
+}
@@ -77,6 +77,38 @@ int8   HalI2CSend(uint8 address, uint8 *buf, uint16 len);
 
 
 
+/*********************************************************************
+ * @fn      HalI2CSetClockDivisor
+ * @brief   Sets busy-wait count per half of SCL period, 0 - fastest
+ */
+void HalI2CSetClockDivisor(uint8 divisor);
+
+/*********************************************************************
+ * @fn      HalI2CWriteBlock
+ * @brief   Sends prefix (register/memory address) followed by buf in one
+ *          transaction, e.g. a whole EEPROM page
+ * @param   address: 7-bit address of the slave device
+ * @return  I2C_SUCCESS if every byte was acknowledged
+ */
+int8 HalI2CWriteBlock(uint8 address, uint8 *prefix, uint8 prefixLen, uint8 *buf, uint16 len);
+
+/*********************************************************************
+ * @fn      HalI2CReadBlock
+ * @brief   Sends prefix (register/memory address), then reads len bytes
+ *          after a repeated start
+ * @param   address: 7-bit address of the slave device
+ * @return  I2C_SUCCESS when successful
+ */
+int8 HalI2CReadBlock(uint8 address, uint8 *prefix, uint8 prefixLen, uint8 *buf, uint16 len);
+
+/*********************************************************************
+ * @fn      HalI2CAckPoll
+ * @brief   Waits until the slave acknowledges its address
+ * @param   address: 7-bit address of the slave device
+ * @return  I2C_SUCCESS when acknowledged before timeout
+ */
+int8 HalI2CAckPoll(uint8 address);
+
 int8 I2C_ReadMultByte( uint8 address, uint8 reg, uint8 *buffer, uint16 len );
 int8 I2C_WriteMultByte( uint8 address, uint8 reg, uint8 *buffer, uint16 len );
 #endif
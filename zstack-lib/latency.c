@@ -0,0 +1,47 @@
+#include "latency.h"
+#include "hal_mcu.h"
+
+// 1 tick = 1000000 / 32768 us = 15625 / 512 us
+#define LATENCY_MAX_TICKS ((uint32)0xFFFFFFFF / 15625)
+
+uint32 zclLatency_Now(void) {
+    halIntState_t intState;
+    uint32 ticks;
+
+    // ST0 must be read first, it latches ST1 and ST2
+    HAL_ENTER_CRITICAL_SECTION(intState);
+    ticks = ST0;
+    ticks |= (uint32)ST1 << 8;
+    ticks |= (uint32)ST2 << 16;
+    HAL_EXIT_CRITICAL_SECTION(intState);
+    return ticks;
+}
+
+uint32 zclLatency_Since(uint32 start) { return zclLatency_Between(start, zclLatency_Now()); }
+
+uint32 zclLatency_Between(uint32 start, uint32 end) {
+    uint32 ticks = (end - start) & LATENCY_TICK_MASK;
+    if (ticks > LATENCY_MAX_TICKS) {
+        ticks = LATENCY_MAX_TICKS;
+    }
+    return (ticks * 15625) >> 9;
+}
+
+void zclLatency_Update(latencyStat_t *stat, uint32 sample) {
+    if (stat->Count == 0) {
+        stat->Min = sample;
+        stat->Max = sample;
+        stat->Avg = sample;
+    } else {
+        stat->Min = MIN(stat->Min, sample);
+        stat->Max = MAX(stat->Max, sample);
+        if (sample >= stat->Avg) {
+            stat->Avg += (sample - stat->Avg) >> LATENCY_EWMA_SHIFT;
+        } else {
+            stat->Avg -= (stat->Avg - sample) >> LATENCY_EWMA_SHIFT;
+        }
+    }
+    if (stat->Count < 0xFFFF) {
+        stat->Count++;
+    }
+}
@@ -0,0 +1,44 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include "hal_types.h"
+
+// Timestamps are taken from the 24-bit sleep timer (32.768 kHz), which keeps running
+// in power modes, durations are converted to microseconds.
+#define LATENCY_TICK_MASK ((uint32)0xFFFFFF)
+
+// EWMA weight of a new sample is 1 / (1 << LATENCY_EWMA_SHIFT)
+#ifndef LATENCY_EWMA_SHIFT
+    #define LATENCY_EWMA_SHIFT 3
+#endif
+
+typedef struct {
+    uint32 Min;
+    uint32 Max;
+    uint32 Avg;
+    uint16 Count;
+} latencyStat_t;
+
+// durations of the last request, microseconds
+typedef struct {
+    uint32 FirstRx; // request TX -> first RX byte
+    uint32 Frame;   // request TX -> frame complete
+    uint32 Decode;  // read start -> decode done
+    uint32 Report;  // decode done -> report queued
+    latencyStat_t Total; // request TX -> report queued
+} latencyRequest_t;
+
+/*
+ * Current sleep timer value, ticks
+ */
+extern uint32 zclLatency_Now(void);
+
+/*
+ * Microseconds passed since start (zclLatency_Now value), saturates at about 8 s
+ */
+extern uint32 zclLatency_Since(uint32 start);
+extern uint32 zclLatency_Between(uint32 start, uint32 end);
+
+extern void zclLatency_Update(latencyStat_t *stat, uint32 sample);
+
+#endif // LATENCY_H
@@ -0,0 +1,74 @@
+#include "load_limit.h"
+
+static bool zclLoadLimit_Over(loadLimitConfig_t const *config, int16 power, uint16 current);
+static bool zclLoadLimit_Under(loadLimitConfig_t const *config, int16 power, uint16 current);
+static uint32 zclLoadLimit_Restore(uint32 limit, uint8 hysteresis);
+
+uint8 zclLoadLimit_Update(loadLimit_t *limit, loadLimitConfig_t const *config, int16 power, uint16 current, uint32 now) {
+    bool over = zclLoadLimit_Over(config, power, current);
+    bool under = zclLoadLimit_Under(config, power, current);
+    uint32 hold = (uint32)config->HoldTime * 1000;
+
+    limit->Near = !under;
+
+    switch (limit->State) {
+    case LOAD_LIMIT_NORMAL:
+        if (over) {
+            limit->State = LOAD_LIMIT_PENDING_OFF;
+            limit->Since = now;
+        }
+        break;
+    case LOAD_LIMIT_PENDING_OFF:
+        if (!over) {
+            limit->State = LOAD_LIMIT_NORMAL;
+        }
+        break;
+    case LOAD_LIMIT_TRIPPED:
+        if (under) {
+            limit->State = LOAD_LIMIT_PENDING_ON;
+            limit->Since = now;
+        }
+        break;
+    case LOAD_LIMIT_PENDING_ON:
+        if (!under) {
+            limit->State = LOAD_LIMIT_TRIPPED;
+        }
+        break;
+    default:
+        limit->State = LOAD_LIMIT_NORMAL;
+        break;
+    }
+
+    if (limit->State == LOAD_LIMIT_PENDING_OFF && now - limit->Since >= hold) {
+        limit->State = LOAD_LIMIT_TRIPPED;
+        return LOAD_LIMIT_ACTION_OFF;
+    }
+    if (limit->State == LOAD_LIMIT_PENDING_ON && now - limit->Since >= hold) {
+        limit->State = LOAD_LIMIT_NORMAL;
+        return LOAD_LIMIT_ACTION_ON;
+    }
+    return LOAD_LIMIT_ACTION_NONE;
+}
+
+bool zclLoadLimit_NeedsFastPoll(loadLimit_t const *limit) { return limit->Near || limit->State != LOAD_LIMIT_NORMAL; }
+
+static bool zclLoadLimit_Over(loadLimitConfig_t const *config, int16 power, uint16 current) {
+    return (config->PowerLimit > 0 && power > config->PowerLimit) || (config->CurrentLimit > 0 && current > config->CurrentLimit);
+}
+
+static bool zclLoadLimit_Under(loadLimitConfig_t const *config, int16 power, uint16 current) {
+    if (config->PowerLimit > 0 && power > 0 && (uint32)power > zclLoadLimit_Restore(config->PowerLimit, config->Hysteresis)) {
+        return false;
+    }
+    if (config->CurrentLimit > 0 && current > zclLoadLimit_Restore(config->CurrentLimit, config->Hysteresis)) {
+        return false;
+    }
+    return true;
+}
+
+static uint32 zclLoadLimit_Restore(uint32 limit, uint8 hysteresis) {
+    if (hysteresis >= 100) {
+        return 0;
+    }
+    return limit * (100 - hysteresis) / 100;
+}
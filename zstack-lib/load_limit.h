@@ -0,0 +1,41 @@
+#ifndef LOAD_LIMIT_H
+#define LOAD_LIMIT_H
+
+#include "hal_types.h"
+
+// Threshold engine for local overload protection. Limits are in the units of
+// the ActivePower / RMSCurrent attributes, 0 disables a limit.
+#define LOAD_LIMIT_NORMAL 0
+#define LOAD_LIMIT_PENDING_OFF 1 // over the limit, waiting for the hold time
+#define LOAD_LIMIT_TRIPPED 2
+#define LOAD_LIMIT_PENDING_ON 3 // below the limit minus hysteresis, waiting for the hold time
+
+#define LOAD_LIMIT_ACTION_NONE 0
+#define LOAD_LIMIT_ACTION_OFF 1
+#define LOAD_LIMIT_ACTION_ON 2
+
+typedef struct {
+    int16 PowerLimit;
+    uint16 CurrentLimit;
+    uint8 Hysteresis; // percent of the limit
+    uint16 HoldTime;  // seconds
+    uint16 FastPollPeriod; // seconds, poll period while close to or over the limit
+} loadLimitConfig_t;
+
+typedef struct {
+    uint8 State;
+    bool Near; // last sample was above the restore level
+    uint32 Since; // ms, start of the pending state
+} loadLimit_t;
+
+/*
+ * Feeds a new sample taken at now (ms), returns LOAD_LIMIT_ACTION_*
+ */
+extern uint8 zclLoadLimit_Update(loadLimit_t *limit, loadLimitConfig_t const *config, int16 power, uint16 current, uint32 now);
+
+/*
+ * TRUE while the load is close to, over, or recovering from the limit
+ */
+extern bool zclLoadLimit_NeedsFastPoll(loadLimit_t const *limit);
+
+#endif // LOAD_LIMIT_H
@@ -0,0 +1,166 @@
+#include "load_profile.h"
+#include "Debug.h"
+#include "OSAL.h"
+#include "OSAL_Nv.h"
+#include "mem_stats.h"
+#include "ZComDef.h"
+
+typedef struct {
+    uint16 Seq;
+    uint32 StartTime; // end time of the first interval in the block
+    uint8 Interval;   // minutes
+    uint8 Count;
+    uint8 Data[LOAD_PROFILE_BLOCK_RECORDS * LOAD_PROFILE_RECORD_SIZE];
+} loadProfileBlock_t;
+
+#define LOAD_PROFILE_UINT24_MAX ((uint32)0xFFFFFF)
+
+static bool zclLoadProfile_ReadBlock(uint8 index, loadProfileBlock_t *block);
+static uint32 zclLoadProfile_BlockEnd(loadProfileBlock_t *block);
+static uint32 zclLoadProfile_GetRecord(loadProfileBlock_t *block, uint8 record);
+static void zclLoadProfile_SetRecord(loadProfileBlock_t *block, uint8 record, uint32 value);
+
+static loadProfileBlock_t zclLoadProfile_Block; // RAM copy of the block at zclLoadProfile_Head
+static uint8 zclLoadProfile_Head = LOAD_PROFILE_BLOCKS - 1;
+static uint8 zclLoadProfile_Unflushed = 0;
+
+void zclLoadProfile_Init(void) {
+    bool found = false;
+    uint16 lastSeq = 0;
+
+    for (uint8 i = 0; i < LOAD_PROFILE_BLOCKS; i++) {
+        if (zclLoadProfile_ReadBlock(i, &zclLoadProfile_Block) && (!found || (int16)(zclLoadProfile_Block.Seq - lastSeq) > 0)) {
+            lastSeq = zclLoadProfile_Block.Seq;
+            zclLoadProfile_Head = i;
+            found = true;
+        }
+    }
+
+    if (found) {
+        zclLoadProfile_ReadBlock(zclLoadProfile_Head, &zclLoadProfile_Block);
+    } else {
+        osal_memset(&zclLoadProfile_Block, 0, sizeof(zclLoadProfile_Block));
+        zclLoadProfile_Head = LOAD_PROFILE_BLOCKS - 1;
+    }
+    LOGI("zclLoadProfile_Init head=%d seq=%d count=%d\r\n", zclLoadProfile_Head, zclLoadProfile_Block.Seq, zclLoadProfile_Block.Count);
+}
+
+void zclLoadProfile_Push(uint32 endTime, uint32 value) {
+    loadProfileBlock_t *block = &zclLoadProfile_Block;
+
+    if (block->Count == 0 || block->Count >= LOAD_PROFILE_BLOCK_RECORDS ||
+        endTime != zclLoadProfile_BlockEnd(block) + LOAD_PROFILE_INTERVAL_SEC) {
+        if (zclLoadProfile_Unflushed) {
+            zclLoadProfile_Flush();
+        }
+        zclLoadProfile_Head = (zclLoadProfile_Head + 1) % LOAD_PROFILE_BLOCKS;
+        block->Seq += 1;
+        block->StartTime = endTime;
+        block->Interval = LOAD_PROFILE_INTERVAL_MIN;
+        block->Count = 0;
+    }
+
+    zclLoadProfile_SetRecord(block, block->Count, value);
+    block->Count += 1;
+    zclLoadProfile_Unflushed += 1;
+
+    if (block->Count == LOAD_PROFILE_BLOCK_RECORDS || zclLoadProfile_Unflushed >= LOAD_PROFILE_FLUSH_RECORDS) {
+        zclLoadProfile_Flush();
+    }
+}
+
+void zclLoadProfile_Flush(void) {
+    uint8 status = osal_nv_write(LOAD_PROFILE_NV_FIRST_ID + zclLoadProfile_Head, 0, sizeof(loadProfileBlock_t), &zclLoadProfile_Block);
+    LOGT("zclLoadProfile_Flush head=%d count=%d status=%d\r\n", zclLoadProfile_Head, zclLoadProfile_Block.Count, status);
+    zclLoadProfile_Unflushed = 0;
+}
+
+uint8 zclLoadProfile_Read(uint32 endTime, uint8 count, uint32 *pEndTime, uint8 *buf) {
+    uint8 delivered = 0;
+    uint8 index = zclLoadProfile_Head;
+    uint16 seq = zclLoadProfile_Block.Seq;
+    uint32 expectedEnd = 0;
+
+    loadProfileBlock_t *block = (loadProfileBlock_t *)zclMemStats_Alloc(sizeof(loadProfileBlock_t));
+    if (block == NULL) {
+        return 0;
+    }
+
+    for (uint8 n = 0; n < LOAD_PROFILE_BLOCKS && delivered < count; n++) {
+        if (n == 0) {
+            osal_memcpy(block, &zclLoadProfile_Block, sizeof(loadProfileBlock_t));
+        } else if (!zclLoadProfile_ReadBlock(index, block) || block->Seq != seq) {
+            break;
+        }
+        if (block->Count == 0) {
+            break;
+        }
+
+        int16 record = block->Count - 1;
+        uint32 recordEnd = zclLoadProfile_BlockEnd(block);
+        if (delivered == 0) {
+            // skip intervals newer than requested
+            while (record >= 0 && endTime != 0 && recordEnd > endTime) {
+                record--;
+                recordEnd -= LOAD_PROFILE_INTERVAL_SEC;
+            }
+            *pEndTime = recordEnd;
+        } else if (recordEnd != expectedEnd) {
+            // gap between blocks, intervals must be contiguous
+            break;
+        }
+
+        while (record >= 0 && delivered < count) {
+            uint32 value = zclLoadProfile_GetRecord(block, record);
+            value = MIN(value, LOAD_PROFILE_UINT24_MAX);
+            *buf++ = BREAK_UINT32(value, 0);
+            *buf++ = BREAK_UINT32(value, 1);
+            *buf++ = BREAK_UINT32(value, 2);
+            delivered++;
+            record--;
+            recordEnd -= LOAD_PROFILE_INTERVAL_SEC;
+        }
+        expectedEnd = recordEnd;
+
+        index = (index + LOAD_PROFILE_BLOCKS - 1) % LOAD_PROFILE_BLOCKS;
+        seq -= 1;
+    }
+
+    osal_mem_free(block);
+    return delivered;
+}
+
+static bool zclLoadProfile_ReadBlock(uint8 index, loadProfileBlock_t *block) {
+    uint16 id = LOAD_PROFILE_NV_FIRST_ID + index;
+    if (osal_nv_item_init(id, sizeof(loadProfileBlock_t), NULL) != ZSUCCESS) {
+        return false;
+    }
+    if (osal_nv_read(id, 0, sizeof(loadProfileBlock_t), block) != ZSUCCESS) {
+        return false;
+    }
+    return block->Interval == LOAD_PROFILE_INTERVAL_MIN && block->Count > 0 && block->Count <= LOAD_PROFILE_BLOCK_RECORDS;
+}
+
+static uint32 zclLoadProfile_BlockEnd(loadProfileBlock_t *block) {
+    return block->StartTime + (uint32)(block->Count - 1) * LOAD_PROFILE_INTERVAL_SEC;
+}
+
+static uint32 zclLoadProfile_GetRecord(loadProfileBlock_t *block, uint8 record) {
+    uint8 *data = &block->Data[record * LOAD_PROFILE_RECORD_SIZE];
+    uint32 value = 0;
+    for (int8 i = LOAD_PROFILE_RECORD_SIZE - 1; i >= 0; i--) {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+
+static void zclLoadProfile_SetRecord(loadProfileBlock_t *block, uint8 record, uint32 value) {
+    uint8 *data = &block->Data[record * LOAD_PROFILE_RECORD_SIZE];
+#if LOAD_PROFILE_RECORD_SIZE < 4
+    value = MIN(value, ((uint32)1 << (LOAD_PROFILE_RECORD_SIZE * 8)) - 1);
+#endif
+    for (uint8 i = 0; i < LOAD_PROFILE_RECORD_SIZE; i++) {
+        data[i] = value & 0xFF;
+        value >>= 8;
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef LOAD_PROFILE_H
+#define LOAD_PROFILE_H
+
+#include "hal_types.h"
+
+// Interval records are kept in a ring of NV items, one block of records per item.
+// The block being filled lives in RAM and is written back every LOAD_PROFILE_FLUSH_RECORDS
+// records, so each item is rewritten only a few times per lap of the ring.
+#ifndef LOAD_PROFILE_NV_FIRST_ID
+    #define LOAD_PROFILE_NV_FIRST_ID 0x0410
+#endif
+
+#ifndef LOAD_PROFILE_BLOCKS
+    #define LOAD_PROFILE_BLOCKS 8
+#endif
+
+#ifndef LOAD_PROFILE_BLOCK_RECORDS
+    #define LOAD_PROFILE_BLOCK_RECORDS 16
+#endif
+
+// bytes per stored interval value, 1..4, little-endian
+#ifndef LOAD_PROFILE_RECORD_SIZE
+    #define LOAD_PROFILE_RECORD_SIZE 3
+#endif
+
+#ifndef LOAD_PROFILE_FLUSH_RECORDS
+    #define LOAD_PROFILE_FLUSH_RECORDS 4
+#endif
+
+#ifndef LOAD_PROFILE_INTERVAL_MIN
+    #define LOAD_PROFILE_INTERVAL_MIN 15
+#endif
+
+#define LOAD_PROFILE_INTERVAL_SEC ((uint32)LOAD_PROFILE_INTERVAL_MIN * 60)
+#define LOAD_PROFILE_CAPACITY (LOAD_PROFILE_BLOCKS * LOAD_PROFILE_BLOCK_RECORDS)
+
+/*
+ * Restores the ring position from NV, must be called before any other function
+ */
+extern void zclLoadProfile_Init(void);
+
+/*
+ * Appends value of the interval ending at endTime (UTC seconds).
+ * A record which doesn't directly follow the previous one starts a new block.
+ */
+extern void zclLoadProfile_Push(uint32 endTime, uint32 value);
+
+/*
+ * Writes the block being filled to NV
+ */
+extern void zclLoadProfile_Flush(void);
+
+/*
+ * Copies up to count contiguous intervals, newest first, ending at or before endTime
+ * (0 - the most recent one) into buf as uint24 little-endian values.
+ * End time of the first copied interval is stored to pEndTime.
+ * Returns number of copied intervals.
+ */
+extern uint8 zclLoadProfile_Read(uint32 endTime, uint8 count, uint32 *pEndTime, uint8 *buf);
+
+#endif
@@ -0,0 +1,56 @@
+#include "mem_stats.h"
+#include "OSAL.h"
+#include "OSAL_Memory.h"
+
+#ifdef __IAR_SYSTEMS_ICC__
+#pragma segment = "XSTACK" __xdata
+#define MEM_STATS_STACK_BEGIN ((uint8 __xdata *)__segment_begin("XSTACK"))
+#define MEM_STATS_STACK_END ((uint8 __xdata *)__segment_end("XSTACK"))
+#endif
+
+memStats_t zclMemStats = {0};
+
+void zclMemStats_Init(void) {
+#ifdef MEM_STATS_STACK_BEGIN
+    uint8 marker;
+    // stack grows down, everything below the current frame is free
+    uint8 __xdata *limit = (uint8 __xdata *)&marker - MEM_STATS_STACK_GUARD;
+
+    zclMemStats.StackSize = MEM_STATS_STACK_END - MEM_STATS_STACK_BEGIN;
+    if (limit > MEM_STATS_STACK_BEGIN && limit < MEM_STATS_STACK_END) {
+        for (uint8 __xdata *p = MEM_STATS_STACK_BEGIN; p < limit; p++) {
+            *p = MEM_STATS_STACK_PAINT;
+        }
+    }
+#endif
+    zclMemStats_Sample();
+}
+
+void zclMemStats_Sample(void) {
+#if OSALMEM_METRICS
+    zclMemStats.HeapUsed = osal_heap_mem_used();
+    zclMemStats.HeapPeak = MAX(zclMemStats.HeapPeak, zclMemStats.HeapUsed);
+#endif
+#ifdef MEM_STATS_STACK_BEGIN
+    uint8 __xdata *p = MEM_STATS_STACK_BEGIN;
+    while (p < MEM_STATS_STACK_END && *p == MEM_STATS_STACK_PAINT) {
+        p++;
+    }
+    zclMemStats.StackPeak = MEM_STATS_STACK_END - p;
+#endif
+}
+
+void *zclMemStats_Alloc(uint16 size) {
+    void *ptr = osal_mem_alloc(size);
+    if (ptr == NULL) {
+        if (zclMemStats.AllocFailures < 0xFFFF) {
+            zclMemStats.AllocFailures++;
+        }
+        return NULL;
+    }
+#if OSALMEM_METRICS
+    zclMemStats.HeapUsed = osal_heap_mem_used();
+    zclMemStats.HeapPeak = MAX(zclMemStats.HeapPeak, zclMemStats.HeapUsed);
+#endif
+    return ptr;
+}
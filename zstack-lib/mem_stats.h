@@ -0,0 +1,46 @@
+#ifndef MEM_STATS_H
+#define MEM_STATS_H
+
+#include "hal_types.h"
+
+// Heap use comes from OSAL (OSALMEM_METRICS). HeapPeak is the largest value seen by
+// zclMemStats_Sample and by allocations made through zclMemStats_Alloc, not a true high-water
+// mark: peaks inside the stack tasks between samples are missed. AllocFailures counts failed
+// application allocations, the ones made through zclMemStats_Alloc, the stack's own aren't seen.
+// Stack use is found by painting the free part of XSTACK at start-up and looking for the deepest
+// overwritten byte.
+#ifndef MEM_STATS_STACK_PAINT
+    #define MEM_STATS_STACK_PAINT 0xCD
+#endif
+
+// bytes below the current stack pointer left unpainted
+#ifndef MEM_STATS_STACK_GUARD
+    #define MEM_STATS_STACK_GUARD 16
+#endif
+
+typedef struct {
+    uint16 HeapUsed;
+    uint16 HeapPeak;
+    uint16 AllocFailures;
+    uint16 StackPeak;
+    uint16 StackSize;
+} memStats_t;
+
+extern memStats_t zclMemStats;
+
+/*
+ * Paints the unused stack, call as early as possible
+ */
+extern void zclMemStats_Init(void);
+
+/*
+ * Refreshes heap and stack figures
+ */
+extern void zclMemStats_Sample(void);
+
+/*
+ * osal_mem_alloc which counts failures, every allocation of the application goes through it
+ */
+extern void *zclMemStats_Alloc(uint16 size);
+
+#endif // MEM_STATS_H
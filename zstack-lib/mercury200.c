@@ -1,9 +1,11 @@
 #include "mercury200.h"
+#define LOG_MODULE_LEVEL LOG_LEVEL_MERCURY
 #include "Debug.h"
 #include "OSAL.h"
 #include "OnBoard.h"
 #include "hal_led.h"
 #include "hal_uart.h"
+#include "trace.h"
 
 #ifndef MERCURY_PORT
 #define MERCURY_PORT HAL_UART_PORT_1
@@ -14,7 +16,7 @@ static current_values_t Mercury200_ReadCurrentValues(void);
 static energy_t Mercury200_ReadEnergy(void);
 static uint16 MODBUS_CRC16( const unsigned char *buf, unsigned int len );
 
-extern zclMercury_t mercury200_dev = {&Mercury200_RequestMeasure, &Mercury200_ReadCurrentValues, &Mercury200_ReadEnergy};
+zclMercury_t mercury200_dev = {&Mercury200_RequestMeasure, &Mercury200_ReadCurrentValues, &Mercury200_ReadEnergy};
 
 #define MERCURY200_CV_RESPONSE_LENGTH 14
 #define MERCURY200_E_RESPONSE_LENGTH 23
@@ -36,12 +38,7 @@ void Mercury200_RequestMeasure(uint32 serial_num, uint8 cmd)
 
   HalUARTWrite(MERCURY_PORT, readMercury, sizeof(readMercury) / sizeof(readMercury[0])); 
   
-  LREP("Mercury sent: ");
-  for (int i = 0; (i < sizeof(readMercury) / sizeof(readMercury[0])); i++) 
-  {
-    LREP("0x%X ", readMercury[i]);
-  }
-  LREP("\r\n");
+  TRACE_BUF(TRACE_MERCURY_TX, readMercury, sizeof(readMercury));
 }
 
 
@@ -52,21 +49,13 @@ current_values_t Mercury200_ReadCurrentValues(void)
   uint8 response[MERCURY200_CV_RESPONSE_LENGTH] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
   HalUARTRead(MERCURY_PORT, (uint8 *)&response, sizeof(response) / sizeof(response[0]));
 
-  LREP("Mercury received: ");
-  for (int i = 0; i <= MERCURY200_CV_RESPONSE_LENGTH - 1; i++) 
-  {
-    LREP("0x%X ", response[i]);
-  }
-  LREP("\r\n");
+  TRACE_BUF(TRACE_MERCURY_RX, response, sizeof(response));
   
   uint16 crc = MODBUS_CRC16(response, MERCURY200_CV_RESPONSE_LENGTH - 2);
 
-  LREP("Real CRC: ");
-  LREP("0x%X ", crc & 0xFF);
-  LREP("0x%X\r\n", (crc>>8) & 0xFF);
-  
   if (response[MERCURY200_CV_RESPONSE_LENGTH - 2] != (crc & 0xFF) || response[MERCURY200_CV_RESPONSE_LENGTH - 1] != ((crc>>8) & 0xFF)) {
-    LREPMaster("Invalid response\r\n");
+    TRACE1(TRACE_MERCURY_BAD_CRC, crc);
+    LOGW("Invalid response\r\n");
     HalUARTRead(MERCURY_PORT, (uint8 *)&response, sizeof(response) / sizeof(response[0]));
     return result;
   }
@@ -97,21 +86,13 @@ energy_t Mercury200_ReadEnergy(void)
     uint8 response[MERCURY200_E_RESPONSE_LENGTH] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
     HalUARTRead(MERCURY_PORT, (uint8 *)&response, sizeof(response) / sizeof(response[0]));
 
-    LREP("Mercury received: ");
-    for (int i = 0; i <= MERCURY200_E_RESPONSE_LENGTH - 1; i++) 
-    {
-      LREP("0x%X ", response[i]);
-    }
-    LREP("\r\n");
+    TRACE_BUF(TRACE_MERCURY_RX, response, sizeof(response));
     
     uint16 crc = MODBUS_CRC16(response, MERCURY200_E_RESPONSE_LENGTH - 2);
 
-    LREP("Real CRC: ");
-    LREP("0x%X ", crc & 0xFF);
-    LREP("0x%X\r\n", (crc>>8) & 0xFF);
-    
     if (response[MERCURY200_E_RESPONSE_LENGTH - 2] != (crc & 0xFF) || response[MERCURY200_E_RESPONSE_LENGTH - 1] != ((crc>>8) & 0xFF)) {
-        LREPMaster("Invalid response\r\n");
+        TRACE1(TRACE_MERCURY_BAD_CRC, crc);
+        LOGW("Invalid response\r\n");
         HalUARTRead(MERCURY_PORT, (uint8 *)&response, sizeof(response) / sizeof(response[0]));
         return result;
     }
@@ -0,0 +1,96 @@
+#include "power_quality.h"
+
+static uint8 zclPowerQuality_Classify(powerQualityConfig_t const *config, uint16 voltage);
+static uint8 zclPowerQuality_Finish(powerQuality_t *pq, uint32 now);
+static void zclPowerQuality_Start(powerQuality_t *pq, uint8 state, uint16 voltage, uint32 since);
+static void zclPowerQuality_Count(powerQuality_t *pq);
+
+uint8 zclPowerQuality_Update(powerQuality_t *pq, powerQualityConfig_t const *config, uint16 voltage, uint32 now) {
+    uint8 state = zclPowerQuality_Classify(config, voltage);
+    uint8 events = 0;
+
+    pq->Misses = 0;
+    if (state != pq->State) {
+        events |= zclPowerQuality_Finish(pq, now);
+        zclPowerQuality_Start(pq, state, voltage, now);
+    } else if (state == POWER_QUALITY_SAG && voltage < pq->Extreme) {
+        pq->Extreme = voltage;
+    } else if (state == POWER_QUALITY_SWELL && voltage > pq->Extreme) {
+        pq->Extreme = voltage;
+    }
+
+    if (pq->State != POWER_QUALITY_NORMAL && !pq->Counted) {
+        uint16 period = pq->State == POWER_QUALITY_SAG ? config->SagPeriod : config->SwellPeriod;
+        if (now - pq->Since >= (uint32)period * 1000) {
+            zclPowerQuality_Count(pq);
+            events |= POWER_QUALITY_EVENT_START;
+        }
+    }
+    return events;
+}
+
+uint8 zclPowerQuality_Miss(powerQuality_t *pq, uint32 now) {
+    uint8 events = 0;
+
+    if (pq->Misses == 0) {
+        pq->FirstMiss = now;
+    }
+    if (pq->Misses < 0xFF) {
+        pq->Misses++;
+    }
+    if (pq->Misses >= POWER_QUALITY_OUTAGE_MISSES && pq->State != POWER_QUALITY_OUTAGE) {
+        // the outage started with the first unanswered request
+        events |= zclPowerQuality_Finish(pq, pq->FirstMiss);
+        zclPowerQuality_Start(pq, POWER_QUALITY_OUTAGE, 0, pq->FirstMiss);
+        zclPowerQuality_Count(pq);
+        events |= POWER_QUALITY_EVENT_START;
+    }
+    return events;
+}
+
+// line noise is not an outage, but it breaks a run of misses
+void zclPowerQuality_Garbled(powerQuality_t *pq) { pq->Misses = 0; }
+
+static uint8 zclPowerQuality_Classify(powerQualityConfig_t const *config, uint16 voltage) {
+    if (config->SagLevel > 0 && voltage < config->SagLevel) {
+        return POWER_QUALITY_SAG;
+    }
+    if (config->SwellLevel > 0 && voltage > config->SwellLevel) {
+        return POWER_QUALITY_SWELL;
+    }
+    return POWER_QUALITY_NORMAL;
+}
+
+static uint8 zclPowerQuality_Finish(powerQuality_t *pq, uint32 now) {
+    if (pq->State == POWER_QUALITY_NORMAL || !pq->Counted) {
+        return 0;
+    }
+    pq->LastType = pq->State;
+    pq->LastVoltage = pq->Extreme;
+    pq->LastDuration = now - pq->Since;
+    return POWER_QUALITY_EVENT_END;
+}
+
+static void zclPowerQuality_Start(powerQuality_t *pq, uint8 state, uint16 voltage, uint32 since) {
+    pq->State = state;
+    pq->Counted = false;
+    pq->Since = since;
+    pq->Extreme = voltage;
+}
+
+static void zclPowerQuality_Count(powerQuality_t *pq) {
+    pq->Counted = true;
+    switch (pq->State) {
+    case POWER_QUALITY_SAG:
+        pq->SagCount++;
+        break;
+    case POWER_QUALITY_SWELL:
+        pq->SwellCount++;
+        break;
+    case POWER_QUALITY_OUTAGE:
+        pq->OutageCount++;
+        break;
+    default:
+        break;
+    }
+}
@@ -0,0 +1,63 @@
+#ifndef POWER_QUALITY_H
+#define POWER_QUALITY_H
+
+#include "hal_types.h"
+
+// Voltage excursion detector. Levels are in the units of the RMSVoltage attribute,
+// 0 disables a level. An excursion is counted and alarmed once it lasts its period,
+// its extreme voltage and duration are published when it ends.
+#define POWER_QUALITY_NORMAL 0
+#define POWER_QUALITY_SAG 1
+#define POWER_QUALITY_SWELL 2
+#define POWER_QUALITY_OUTAGE 3 // meter doesn't answer
+
+// Update / Miss result bits
+#define POWER_QUALITY_EVENT_START 0x01 // excursion reached its period, State holds its type
+#define POWER_QUALITY_EVENT_END 0x02   // counted excursion finished, Last* hold its figures
+
+// failed reads in a row taken as an outage
+#ifndef POWER_QUALITY_OUTAGE_MISSES
+    #define POWER_QUALITY_OUTAGE_MISSES 3
+#endif
+
+typedef struct {
+    uint16 SagLevel;
+    uint16 SwellLevel;
+    uint16 SagPeriod;   // seconds
+    uint16 SwellPeriod; // seconds
+    uint16 WatchPeriod; // seconds between voltage reads in watch mode, 0 - off
+    uint16 AlarmsMask;  // Electrical Measurement ACAlarmsMask
+} powerQualityConfig_t;
+
+typedef struct {
+    uint8 State;
+    bool Counted;
+    uint32 Since;  // ms, start of the excursion in progress
+    uint16 Extreme; // lowest voltage of a sag, highest of a swell
+    uint8 Misses;
+    uint32 FirstMiss; // ms
+
+    uint16 SagCount;
+    uint16 SwellCount;
+    uint16 OutageCount;
+    uint8 LastType;
+    uint16 LastVoltage;
+    uint32 LastDuration; // ms
+} powerQuality_t;
+
+/*
+ * Feeds a voltage read at now (ms), returns POWER_QUALITY_EVENT_* bits
+ */
+extern uint8 zclPowerQuality_Update(powerQuality_t *pq, powerQualityConfig_t const *config, uint16 voltage, uint32 now);
+
+/*
+ * Feeds a request the meter didn't answer at now (ms), returns POWER_QUALITY_EVENT_* bits
+ */
+extern uint8 zclPowerQuality_Miss(powerQuality_t *pq, uint32 now);
+
+/*
+ * Feeds a reply that arrived but didn't decode: the meter is powered, the voltage is unknown
+ */
+extern void zclPowerQuality_Garbled(powerQuality_t *pq);
+
+#endif // POWER_QUALITY_H
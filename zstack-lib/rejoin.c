@@ -0,0 +1,75 @@
+#include "rejoin.h"
+
+static void zclRejoin_Enter(rejoin_t *rejoin, uint8 stage, uint8 tries);
+
+uint32 zclRejoin_Failed(rejoin_t *rejoin, uint32 now) {
+    if (rejoin->Stage == REJOIN_STAGE_IDLE) {
+        rejoin->LostAt = now;
+        rejoin->Delay = REJOIN_BACKOFF_START_DELAY;
+        zclRejoin_Enter(rejoin, REJOIN_STAGE_CACHED, REJOIN_CACHED_TRIES);
+    } else if (rejoin->Stats.Failures < 0xFFFF) {
+        rejoin->Stats.Failures++;
+    }
+
+    if (rejoin->Stage == REJOIN_STAGE_CACHED && rejoin->Tries == 0) {
+        zclRejoin_Enter(rejoin, REJOIN_STAGE_MASK, REJOIN_MASK_TRIES);
+    }
+    if (rejoin->Stage == REJOIN_STAGE_MASK && rejoin->Tries == 0) {
+        zclRejoin_Enter(rejoin, REJOIN_STAGE_BACKOFF, REJOIN_BACKOFF_TRIES);
+    }
+
+    switch (rejoin->Stage) {
+    case REJOIN_STAGE_CACHED:
+        rejoin->Tries--;
+        return REJOIN_CACHED_DELAY;
+    case REJOIN_STAGE_MASK:
+        rejoin->Tries--;
+        return REJOIN_MASK_DELAY;
+    default:
+        if (rejoin->Tries == 0) {
+            return REJOIN_BACKOFF_MAX_DELAY;
+        }
+        rejoin->Tries--;
+        rejoin->Delay = rejoin->Delay / 100 * REJOIN_BACKOFF_PERCENT;
+        if (rejoin->Delay > REJOIN_BACKOFF_MAX_DELAY) {
+            rejoin->Delay = REJOIN_BACKOFF_MAX_DELAY;
+        }
+        return rejoin->Delay;
+    }
+}
+
+void zclRejoin_Restored(rejoin_t *rejoin, uint32 now, uint16 parent) {
+    rejoinStats_t *stats = &rejoin->Stats;
+
+    if (rejoin->Parent != REJOIN_NO_PARENT && parent != rejoin->Parent) {
+        stats->ParentChanges++;
+    }
+    rejoin->Parent = parent;
+
+    // restore at start-up and the first join aren't rejoins
+    if (rejoin->Stage == REJOIN_STAGE_IDLE) {
+        return;
+    }
+    stats->LastLatency = now - rejoin->LostAt;
+    if (stats->LastLatency > stats->MaxLatency) {
+        stats->MaxLatency = stats->LastLatency;
+    }
+    stats->Count++;
+    switch (rejoin->Stage) {
+    case REJOIN_STAGE_CACHED:
+        stats->CachedCount++;
+        break;
+    case REJOIN_STAGE_MASK:
+        stats->MaskCount++;
+        break;
+    default:
+        stats->BackoffCount++;
+        break;
+    }
+    rejoin->Stage = REJOIN_STAGE_IDLE;
+}
+
+static void zclRejoin_Enter(rejoin_t *rejoin, uint8 stage, uint8 tries) {
+    rejoin->Stage = stage;
+    rejoin->Tries = tries;
+}
@@ -0,0 +1,74 @@
+#ifndef REJOIN_H
+#define REJOIN_H
+
+#include "hal_types.h"
+
+// Staged end device rejoin. A lost parent is looked for on the last channel with a
+// short retry train first, then on the configured channel mask, and only then with
+// exponential backoff up to REJOIN_BACKOFF_MAX_DELAY.
+#define REJOIN_STAGE_IDLE 0
+#define REJOIN_STAGE_CACHED 1  // last channel
+#define REJOIN_STAGE_MASK 2    // configured channel mask
+#define REJOIN_STAGE_BACKOFF 3 // configured channel mask, growing delay
+
+#define REJOIN_NO_PARENT 0xFFFF
+
+#ifndef REJOIN_CACHED_TRIES
+    #define REJOIN_CACHED_TRIES 4
+#endif
+#ifndef REJOIN_CACHED_DELAY
+    #define REJOIN_CACHED_DELAY 1000 // ms
+#endif
+
+#ifndef REJOIN_MASK_TRIES
+    #define REJOIN_MASK_TRIES 3
+#endif
+#ifndef REJOIN_MASK_DELAY
+    #define REJOIN_MASK_DELAY 5000 // ms
+#endif
+
+#ifndef REJOIN_BACKOFF_TRIES
+    #define REJOIN_BACKOFF_TRIES 5
+#endif
+#ifndef REJOIN_BACKOFF_START_DELAY
+    #define REJOIN_BACKOFF_START_DELAY ((uint32)10 * 1000) // ms
+#endif
+#ifndef REJOIN_BACKOFF_PERCENT
+    #define REJOIN_BACKOFF_PERCENT 140 // every next delay, percent of the previous one
+#endif
+#ifndef REJOIN_BACKOFF_MAX_DELAY
+    #define REJOIN_BACKOFF_MAX_DELAY ((uint32)45 * 60 * 1000) // ms
+#endif
+
+typedef struct {
+    uint16 Count;        // rejoins since start
+    uint16 CachedCount;  // of them found on the last channel
+    uint16 MaskCount;    // on the channel mask
+    uint16 BackoffCount; // after backoff
+    uint16 Failures;     // failed attempts
+    uint32 LastLatency;  // ms, parent lost to network restored
+    uint32 MaxLatency;   // ms
+    uint16 ParentChanges; // connects through another parent than the previous one
+} rejoinStats_t;
+
+typedef struct {
+    uint8 Stage;
+    uint8 Tries; // attempts left in the stage
+    uint32 Delay; // ms, next backoff delay
+    uint32 LostAt; // ms
+    uint16 Parent; // short address, REJOIN_NO_PARENT before the first connect
+    rejoinStats_t Stats;
+} rejoin_t;
+
+/*
+ * Parent lost or a rejoin attempt failed at now (ms), returns delay to the next attempt,
+ * Stage holds its scope
+ */
+extern uint32 zclRejoin_Failed(rejoin_t *rejoin, uint32 now);
+
+/*
+ * Network restored at now (ms) through parent, counts the rejoin if one was in progress
+ */
+extern void zclRejoin_Restored(rejoin_t *rejoin, uint32 now, uint16 parent);
+
+#endif // REJOIN_H
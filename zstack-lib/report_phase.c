@@ -0,0 +1,61 @@
+#include "report_phase.h"
+
+#define REPORT_PHASE_MAX_JITTER 45 // percent, keeps consecutive reports in order
+
+static uint32 zclReportPhase_Delay(reportPhase_t *phase, uint32 now, uint16 rand);
+
+// FNV-1a, consecutive addresses end up far apart
+uint32 zclReportPhase_Offset(uint8 const *ieee, uint32 period) {
+    uint32 hash = 2166136261UL;
+
+    if (period == 0) {
+        return 0;
+    }
+    for (uint8 i = 0; i < 8; i++) {
+        hash ^= ieee[i];
+        hash *= 16777619UL;
+    }
+    return hash % period;
+}
+
+uint32 zclReportPhase_Start(reportPhase_t *phase, uint32 offset, uint32 now, uint16 rand) {
+    phase->Due = now + offset;
+    return zclReportPhase_Delay(phase, now, rand);
+}
+
+uint32 zclReportPhase_Next(reportPhase_t *phase, uint32 now, uint16 rand) {
+    phase->Due += phase->Period;
+    if ((int32)(now - phase->Due) > (int32)phase->Period) {
+        // missed whole periods (long blocking operation), restart from now keeping no backlog
+        phase->Due = now + phase->Period;
+    }
+    return zclReportPhase_Delay(phase, now, rand);
+}
+
+uint32 zclReportPhase_SetPeriod(reportPhase_t *phase, uint32 period, uint32 now, uint16 rand) {
+    // the pending slot is one old period after the last one
+    uint32 last = phase->Due - phase->Period;
+
+    phase->Period = period;
+    phase->Due = last + period;
+    while (period > 0 && (int32)(now - phase->Due) > 0) {
+        phase->Due += period;
+    }
+    return zclReportPhase_Delay(phase, now, rand);
+}
+
+static uint32 zclReportPhase_Delay(reportPhase_t *phase, uint32 now, uint16 rand) {
+    uint8 percent = phase->Jitter < REPORT_PHASE_MAX_JITTER ? phase->Jitter : REPORT_PHASE_MAX_JITTER;
+    uint32 spread = phase->Period / 100 * percent;
+    uint32 fire = phase->Due;
+
+    if (phase->Period == 0) {
+        return 0;
+    }
+    if (spread > 0) {
+        // 2 * spread * rand / 65536 without 32 bit overflow
+        uint32 width = 2 * spread;
+        fire = fire - spread + (width >> 16) * rand + (((width & 0xFFFF) * rand) >> 16);
+    }
+    return (int32)(fire - now) > 0 ? fire - now : 1;
+}
@@ -0,0 +1,36 @@
+#ifndef REPORT_PHASE_H
+#define REPORT_PHASE_H
+
+#include "hal_types.h"
+
+// Spreads periodic reports of many devices over the period. Every device keeps its
+// own slot (offset from the IEEE address) and fires randomly around it, the slot
+// itself doesn't drift since jitter is not accumulated. Delays are at least 1 ms,
+// 0 is returned only for period 0, which means no periodic reports.
+typedef struct {
+    uint32 Period; // ms, 0 - off
+    uint32 Due;    // ms, system clock of the current slot
+    uint8 Jitter;  // percent of the period, each side of the slot
+} reportPhase_t;
+
+/*
+ * Slot offset within period (ms) for the 8 byte IEEE address
+ */
+extern uint32 zclReportPhase_Offset(uint8 const *ieee, uint32 period);
+
+/*
+ * Anchors the first slot offset ms from now, returns delay to the first report
+ */
+extern uint32 zclReportPhase_Start(reportPhase_t *phase, uint32 offset, uint32 now, uint16 rand);
+
+/*
+ * Moves to the next slot, returns delay to the next report
+ */
+extern uint32 zclReportPhase_Next(reportPhase_t *phase, uint32 now, uint16 rand);
+
+/*
+ * Changes the period keeping the last slot, returns delay to the next report
+ */
+extern uint32 zclReportPhase_SetPeriod(reportPhase_t *phase, uint32 period, uint32 now, uint16 rand);
+
+#endif // REPORT_PHASE_H
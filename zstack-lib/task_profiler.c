@@ -0,0 +1,107 @@
+#include "task_profiler.h"
+#include "Debug.h"
+#include "OSAL.h"
+#include "latency.h"
+
+#if TASK_PROFILER
+#if !defined(DO_DEBUG_UART) && !defined(DO_DEBUG_MT)
+#error "TASK_PROFILER needs DO_DEBUG_UART or DO_DEBUG_MT"
+#endif
+
+typedef struct {
+    uint16 Count;
+    uint32 Total; // us
+    uint32 Max;   // us
+} taskProfilerStat_t;
+
+typedef struct {
+    uint8 Task;
+    uint8 Bit;
+    taskProfilerStat_t Stat;
+} taskProfilerEvent_t;
+
+static void zclTaskProfiler_Add(taskProfilerStat_t *stat, uint32 elapsed);
+static taskProfilerEvent_t *zclTaskProfiler_FindEvent(uint8 task_id, uint8 bit);
+
+static taskProfilerStat_t zclTaskProfiler_Tasks[TASK_PROFILER_MAX_TASKS];
+static taskProfilerEvent_t zclTaskProfiler_Events[TASK_PROFILER_EVENT_SLOTS];
+static uint8 zclTaskProfiler_EventsUsed = 0;
+static uint32 zclTaskProfiler_LastDump = 0;
+
+uint16 zclTaskProfiler_Run(pTaskEventHandlerFn handler, uint8 task_id, uint16 events) {
+    uint32 start = zclLatency_Now();
+    uint16 remaining = (*handler)(task_id, events);
+    uint32 elapsed = zclLatency_Since(start);
+
+    if (task_id < TASK_PROFILER_MAX_TASKS) {
+        zclTaskProfiler_Add(&zclTaskProfiler_Tasks[task_id], elapsed);
+    }
+
+    // handlers process one event per call, charge the time to the highest cleared bit
+    uint16 processed = events & ~remaining;
+    for (int8 bit = 15; bit >= 0; bit--) {
+        if (processed & BV(bit)) {
+            taskProfilerEvent_t *event = zclTaskProfiler_FindEvent(task_id, bit);
+            if (event != NULL) {
+                zclTaskProfiler_Add(&event->Stat, elapsed);
+            }
+            break;
+        }
+    }
+
+    // dump outside of the measured interval
+    if (osal_GetSystemClock() - zclTaskProfiler_LastDump >= TASK_PROFILER_DUMP_PERIOD) {
+        zclTaskProfiler_Dump();
+        zclTaskProfiler_Reset();
+    }
+    return remaining;
+}
+
+void zclTaskProfiler_Dump(void) {
+    LREP("Task profile for %ld ms\r\n", osal_GetSystemClock() - zclTaskProfiler_LastDump);
+    for (uint8 task = 0; task < tasksCnt && task < TASK_PROFILER_MAX_TASKS; task++) {
+        taskProfilerStat_t *stat = &zclTaskProfiler_Tasks[task];
+        if (stat->Count == 0) {
+            continue;
+        }
+        LREP("task %d calls=%u total=%ldus max=%ldus\r\n", task, stat->Count, stat->Total, stat->Max);
+        for (uint8 i = 0; i < zclTaskProfiler_EventsUsed; i++) {
+            taskProfilerEvent_t *event = &zclTaskProfiler_Events[i];
+            if (event->Task == task) {
+                LREP("  evt 0x%04X calls=%u total=%ldus max=%ldus\r\n", BV(event->Bit), event->Stat.Count, event->Stat.Total,
+                     event->Stat.Max);
+            }
+        }
+    }
+}
+
+void zclTaskProfiler_Reset(void) {
+    osal_memset(zclTaskProfiler_Tasks, 0, sizeof(zclTaskProfiler_Tasks));
+    osal_memset(zclTaskProfiler_Events, 0, sizeof(zclTaskProfiler_Events));
+    zclTaskProfiler_EventsUsed = 0;
+    zclTaskProfiler_LastDump = osal_GetSystemClock();
+}
+
+static void zclTaskProfiler_Add(taskProfilerStat_t *stat, uint32 elapsed) {
+    if (stat->Count < 0xFFFF) {
+        stat->Count++;
+    }
+    stat->Total += elapsed;
+    stat->Max = MAX(stat->Max, elapsed);
+}
+
+static taskProfilerEvent_t *zclTaskProfiler_FindEvent(uint8 task_id, uint8 bit) {
+    for (uint8 i = 0; i < zclTaskProfiler_EventsUsed; i++) {
+        if (zclTaskProfiler_Events[i].Task == task_id && zclTaskProfiler_Events[i].Bit == bit) {
+            return &zclTaskProfiler_Events[i];
+        }
+    }
+    if (zclTaskProfiler_EventsUsed == TASK_PROFILER_EVENT_SLOTS) {
+        return NULL;
+    }
+    taskProfilerEvent_t *event = &zclTaskProfiler_Events[zclTaskProfiler_EventsUsed++];
+    event->Task = task_id;
+    event->Bit = bit;
+    return event;
+}
+#endif // TASK_PROFILER
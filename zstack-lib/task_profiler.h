@@ -0,0 +1,40 @@
+#ifndef TASK_PROFILER_H
+#define TASK_PROFILER_H
+
+#include "hal_types.h"
+#include "OSAL_Tasks.h"
+
+// Wraps tasksArr handlers to measure invocation count, total and max execution time
+// per task and per event bit. Statistics are dumped to the debug UART and cleared
+// every TASK_PROFILER_DUMP_PERIOD ms.
+#ifndef TASK_PROFILER
+    #define TASK_PROFILER FALSE
+#endif
+
+#ifndef TASK_PROFILER_MAX_TASKS
+    #define TASK_PROFILER_MAX_TASKS 16
+#endif
+
+// (task, event bit) pairs tracked, pairs seen after the table is full are only counted per task
+#ifndef TASK_PROFILER_EVENT_SLOTS
+    #define TASK_PROFILER_EVENT_SLOTS 24
+#endif
+
+#ifndef TASK_PROFILER_DUMP_PERIOD
+    #define TASK_PROFILER_DUMP_PERIOD ((uint32)60 * 1000)
+#endif
+
+#if TASK_PROFILER
+    #define PROFILED_TASK(handler) handler##_Profiled
+    #define PROFILED_TASK_WRAPPER(handler)                                                                                         \
+        static uint16 handler##_Profiled(uint8 task_id, uint16 events) { return zclTaskProfiler_Run(handler, task_id, events); }
+#else
+    #define PROFILED_TASK(handler) handler
+    #define PROFILED_TASK_WRAPPER(handler)
+#endif
+
+extern uint16 zclTaskProfiler_Run(pTaskEventHandlerFn handler, uint8 task_id, uint16 events);
+extern void zclTaskProfiler_Dump(void);
+extern void zclTaskProfiler_Reset(void);
+
+#endif // TASK_PROFILER_H
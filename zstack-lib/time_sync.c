@@ -0,0 +1,83 @@
+#include "time_sync.h"
+#include "Debug.h"
+#include "OSAL.h"
+#include "OSAL_Clock.h"
+#include "ZComDef.h"
+#include "bdb_interface.h"
+#include "mem_stats.h"
+#include "zcl_general.h"
+
+#define TIME_SYNC_INVALID ((uint32)0xFFFFFFFF)
+#define TIME_SYNC_SERVER 0x0000
+
+#define TIME_STATUS_MASTER BV(0)
+#define TIME_STATUS_SYNCHRONIZED BV(1)
+
+timeSyncStats_t zclTimeSync = {.LastSync = 0, .LastCorrection = 0, .Count = 0, .LocalOffset = 0};
+
+void zclTimeSync_Request(uint8 endpoint) {
+    afAddrType_t dstAddr = {.addrMode = (afAddrMode_t)Addr16Bit, .endPoint = 1, .addr.shortAddr = TIME_SYNC_SERVER};
+    zclReadCmd_t *readCmd = (zclReadCmd_t *)zclMemStats_Alloc(sizeof(zclReadCmd_t) + 4 * sizeof(uint16));
+
+    if (readCmd == NULL) {
+        return;
+    }
+    readCmd->numAttr = 4;
+    readCmd->attrID[0] = ATTRID_TIME_TIME;
+    readCmd->attrID[1] = ATTRID_TIME_STATUS;
+    readCmd->attrID[2] = ATTRID_TIME_TIME_ZONE;
+    readCmd->attrID[3] = ATTRID_TIME_LOCAL_TIME;
+    uint8 status = zcl_SendRead(endpoint, &dstAddr, ZCL_CLUSTER_ID_GEN_TIME, readCmd, ZCL_FRAME_CLIENT_SERVER_DIR, TRUE,
+                                bdb_getZCLFrameCounter());
+    LOGT("zclTimeSync_Request status=%d\r\n", status);
+    osal_mem_free(readCmd);
+}
+
+bool zclTimeSync_ProcessIncomingMsg(zclIncomingMsg_t *pInMsg) {
+    uint32 time = TIME_SYNC_INVALID;
+    uint8 timeStatus = TIME_STATUS_SYNCHRONIZED; // servers without TimeStatus are trusted
+    uint32 localTime = TIME_SYNC_INVALID;
+    int32 timeZone = 0;
+
+    if (pInMsg->clusterId != ZCL_CLUSTER_ID_GEN_TIME || pInMsg->zclHdr.commandID != ZCL_CMD_READ_RSP || pInMsg->attrCmd == NULL) {
+        return false;
+    }
+    // only the coordinator is asked, a response from anyone else doesn't move the clock
+    if (pInMsg->srcAddr.addrMode != (afAddrMode_t)Addr16Bit || pInMsg->srcAddr.addr.shortAddr != TIME_SYNC_SERVER) {
+        LOGW("zclTimeSync ignored time from 0x%X\r\n", pInMsg->srcAddr.addr.shortAddr);
+        return false;
+    }
+    zclReadRspCmd_t *rsp = (zclReadRspCmd_t *)pInMsg->attrCmd;
+    for (uint8 i = 0; i < rsp->numAttr; i++) {
+        zclReadRspStatus_t *attr = &rsp->attrList[i];
+        if (attr->status != ZCL_STATUS_SUCCESS) {
+            continue;
+        }
+        if (attr->attrID == ATTRID_TIME_TIME) {
+            time = osal_build_uint32(attr->data, 4);
+        } else if (attr->attrID == ATTRID_TIME_STATUS) {
+            timeStatus = *attr->data;
+        } else if (attr->attrID == ATTRID_TIME_TIME_ZONE) {
+            timeZone = (int32)osal_build_uint32(attr->data, 4);
+        } else if (attr->attrID == ATTRID_TIME_LOCAL_TIME) {
+            localTime = osal_build_uint32(attr->data, 4);
+        }
+    }
+    if (time == TIME_SYNC_INVALID || time == 0 || !(timeStatus & (TIME_STATUS_MASTER | TIME_STATUS_SYNCHRONIZED))) {
+        LOGW("zclTimeSync no valid time, status=0x%X\r\n", timeStatus);
+        return false;
+    }
+
+    zclTimeSync.LastCorrection = (int32)(time - osal_getClock());
+    zclTimeSync.LastSync = time;
+    zclTimeSync.Count++;
+    // LocalTime already has DST applied, TimeZone alone is the fallback
+    zclTimeSync.LocalOffset = localTime != TIME_SYNC_INVALID ? (int32)(localTime - time) : timeZone;
+    osal_setClock(time);
+    LOGI("zclTimeSync time=%ld correction=%ld\r\n", time, zclTimeSync.LastCorrection);
+    return true;
+}
+
+bool zclTimeSync_IsSynced(void) { return zclTimeSync.Count > 0; }
+
+uint32 zclTimeSync_LocalTime(void) { return osal_getClock() + zclTimeSync.LocalOffset; }
@@ -0,0 +1,48 @@
+#ifndef TIME_SYNC_H
+#define TIME_SYNC_H
+
+#include "hal_types.h"
+#include "zcl.h"
+
+// Time cluster client. Reads Time / TimeStatus from the coordinator and steps the OSAL
+// clock to each accepted answer, there is no slewing or drift correction in between.
+// ZCL time and OSAL UTCTime share the 2000-01-01 epoch.
+#ifndef TIME_SYNC_INTERVAL_SEC
+    #define TIME_SYNC_INTERVAL_SEC ((uint32)6 * 60 * 60)
+#endif
+
+#ifndef TIME_SYNC_RETRY_SEC
+    #define TIME_SYNC_RETRY_SEC 60
+#endif
+
+typedef struct {
+    uint32 LastSync;      // UTC of the last accepted time
+    int32 LastCorrection; // seconds added to the clock by the last sync
+    uint16 Count;         // accepted syncs since start
+    int32 LocalOffset;    // seconds from UTC to local time, DST included
+} timeSyncStats_t;
+
+extern timeSyncStats_t zclTimeSync;
+
+/*
+ * Sends Read Attributes for Time, TimeStatus, TimeZone and LocalTime to the coordinator
+ */
+extern void zclTimeSync_Request(uint8 endpoint);
+
+/*
+ * Handles incoming ZCL message, returns TRUE when the clock was set from it.
+ * Only Time read responses from the coordinator are accepted
+ */
+extern bool zclTimeSync_ProcessIncomingMsg(zclIncomingMsg_t *pInMsg);
+
+/*
+ * TRUE once the clock was set at least once
+ */
+extern bool zclTimeSync_IsSynced(void);
+
+/*
+ * Local time of the coordinator, seconds since 2000-01-01
+ */
+extern uint32 zclTimeSync_LocalTime(void);
+
+#endif // TIME_SYNC_H
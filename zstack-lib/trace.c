@@ -0,0 +1,96 @@
+#include "trace.h"
+#include "Debug.h"
+#include "OSAL.h"
+#include "hal_mcu.h"
+#include "hal_uart.h"
+
+#if TRACE
+#if !defined(DO_DEBUG_UART)
+#error "TRACE needs DO_DEBUG_UART"
+#endif
+
+static uint16 zclTrace_Free(void);
+static void zclTrace_Put(uint8 id, uint32 time, uint8 const *payload, uint8 len);
+
+static uint8 zclTrace_TaskID = 0xFF;
+static uint8 zclTrace_Buffer[TRACE_BUFFER_SIZE];
+static uint16 zclTrace_Head = 0; // next byte to write
+static uint16 zclTrace_Tail = 0; // next byte to send
+static uint16 zclTrace_Dropped = 0;
+
+void zclTrace_Init(uint8 task_id) { zclTrace_TaskID = task_id; }
+
+uint16 zclTrace_event_loop(uint8 task_id, uint16 events) {
+    if (events & TRACE_DRAIN_EVT) {
+        halIntState_t intState;
+        uint16 head;
+
+        HAL_ENTER_CRITICAL_SECTION(intState);
+        head = zclTrace_Head;
+        HAL_EXIT_CRITICAL_SECTION(intState);
+
+        if (head != zclTrace_Tail) {
+            uint16 len = (head > zclTrace_Tail ? head : TRACE_BUFFER_SIZE) - zclTrace_Tail;
+            len = MIN(len, TRACE_DRAIN_CHUNK);
+            uint16 written = HalUARTWrite(UART_PORT, &zclTrace_Buffer[zclTrace_Tail], len);
+
+            HAL_ENTER_CRITICAL_SECTION(intState);
+            zclTrace_Tail = (zclTrace_Tail + written) % TRACE_BUFFER_SIZE;
+            head = zclTrace_Head;
+            HAL_EXIT_CRITICAL_SECTION(intState);
+
+            if (written == 0) {
+                // UART TX buffer is full, let it drain instead of spinning
+                osal_start_timerEx(task_id, TRACE_DRAIN_EVT, TRACE_DRAIN_RETRY_MS);
+            } else if (head != zclTrace_Tail) {
+                osal_set_event(task_id, TRACE_DRAIN_EVT);
+            }
+        }
+        return (events ^ TRACE_DRAIN_EVT);
+    }
+    return 0;
+}
+
+void zclTrace_Push(uint8 id, uint8 const *payload, uint8 len) {
+    halIntState_t intState;
+    uint32 time = osal_GetSystemClock();
+    len = MIN(len, TRACE_MAX_PAYLOAD);
+
+    HAL_ENTER_CRITICAL_SECTION(intState);
+    bool wasEmpty = zclTrace_Head == zclTrace_Tail;
+    if (zclTrace_Dropped && zclTrace_Free() >= 2 * TRACE_HEADER_SIZE + 4 + len) {
+        uint8 dropped[4] = {LO_UINT16(zclTrace_Dropped), HI_UINT16(zclTrace_Dropped), 0, 0};
+        zclTrace_Put(TRACE_DROPPED, time, dropped, sizeof(dropped));
+        zclTrace_Dropped = 0;
+    }
+    if (zclTrace_Dropped == 0 && zclTrace_Free() >= TRACE_HEADER_SIZE + len) {
+        zclTrace_Put(id, time, payload, len);
+    } else if (zclTrace_Dropped < 0xFFFF) {
+        zclTrace_Dropped++;
+    }
+    HAL_EXIT_CRITICAL_SECTION(intState);
+
+    if (wasEmpty && zclTrace_TaskID != 0xFF) {
+        osal_set_event(zclTrace_TaskID, TRACE_DRAIN_EVT);
+    }
+}
+
+void zclTrace_Push32(uint8 id, uint8 count, uint32 a, uint32 b) {
+    uint8 payload[8] = {BREAK_UINT32(a, 0), BREAK_UINT32(a, 1), BREAK_UINT32(a, 2), BREAK_UINT32(a, 3),
+                        BREAK_UINT32(b, 0), BREAK_UINT32(b, 1), BREAK_UINT32(b, 2), BREAK_UINT32(b, 3)};
+    zclTrace_Push(id, payload, count * 4);
+}
+
+// one byte is kept free to tell a full ring from an empty one
+static uint16 zclTrace_Free(void) { return (zclTrace_Tail + TRACE_BUFFER_SIZE - zclTrace_Head - 1) % TRACE_BUFFER_SIZE; }
+
+static void zclTrace_Put(uint8 id, uint32 time, uint8 const *payload, uint8 len) {
+    uint8 header[TRACE_HEADER_SIZE] = {TRACE_SYNC, id, len, BREAK_UINT32(time, 0), BREAK_UINT32(time, 1), BREAK_UINT32(time, 2),
+                                       BREAK_UINT32(time, 3)};
+
+    for (uint8 i = 0; i < TRACE_HEADER_SIZE + len; i++) {
+        zclTrace_Buffer[zclTrace_Head] = i < TRACE_HEADER_SIZE ? header[i] : payload[i - TRACE_HEADER_SIZE];
+        zclTrace_Head = (zclTrace_Head + 1) % TRACE_BUFFER_SIZE;
+    }
+}
+#endif // TRACE
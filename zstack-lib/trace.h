@@ -0,0 +1,58 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "hal_types.h"
+#include "trace_events.h"
+
+// Binary trace: records are copied into a RAM ring and drained to the debug UART by
+// the lowest priority task, formatting happens on the host (trace_decode.py).
+// Frame: 0xA5, event id, payload length, timestamp ms (uint32 LE), payload.
+#ifndef TRACE
+    #define TRACE FALSE
+#endif
+
+#ifndef TRACE_BUFFER_SIZE
+    #define TRACE_BUFFER_SIZE 256
+#endif
+
+#ifndef TRACE_MAX_PAYLOAD
+    #define TRACE_MAX_PAYLOAD 32
+#endif
+
+// bytes handed to HalUARTWrite at once, must fit the UART TX buffer
+#ifndef TRACE_DRAIN_CHUNK
+    #define TRACE_DRAIN_CHUNK 32
+#endif
+
+#ifndef TRACE_DRAIN_RETRY_MS
+    #define TRACE_DRAIN_RETRY_MS 5
+#endif
+
+#define TRACE_SYNC 0xA5
+#define TRACE_HEADER_SIZE 7
+
+#define TRACE_DRAIN_EVT 0x0001
+
+#if TRACE
+    #define TRACE0(id) zclTrace_Push((id), NULL, 0)
+    #define TRACE1(id, a) zclTrace_Push32((id), 1, (uint32)(a), 0)
+    #define TRACE2(id, a, b) zclTrace_Push32((id), 2, (uint32)(a), (uint32)(b))
+    #define TRACE_BUF(id, buf, len) zclTrace_Push((id), (buf), (len))
+#else
+    #define TRACE0(id)
+    #define TRACE1(id, a)
+    #define TRACE2(id, a, b)
+    #define TRACE_BUF(id, buf, len)
+#endif
+
+extern void zclTrace_Init(uint8 task_id);
+extern uint16 zclTrace_event_loop(uint8 task_id, uint16 events);
+
+/*
+ * Copies a record into the ring, safe to call from interrupts.
+ * Payload longer than TRACE_MAX_PAYLOAD is truncated, records which don't fit are counted and dropped.
+ */
+extern void zclTrace_Push(uint8 id, uint8 const *payload, uint8 len);
+extern void zclTrace_Push32(uint8 id, uint8 count, uint32 a, uint32 b);
+
+#endif // TRACE_H
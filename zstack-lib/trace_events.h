@@ -0,0 +1,13 @@
+#ifndef TRACE_EVENTS_H
+#define TRACE_EVENTS_H
+
+// Trace event IDs, one per line, followed by the format used by trace_decode.py.
+// Arguments are little-endian uint32 values, {0} and {1} refer to them,
+// {hex} prints the raw payload. Keep IDs below 0x100 and never reuse them.
+#define TRACE_DROPPED 0x01          // {0} trace records dropped, ring was full
+#define TRACE_APP_EVENTS 0x10       // zclApp events 0x{0:04X}
+#define TRACE_MERCURY_TX 0x20       // Mercury sent: {hex}
+#define TRACE_MERCURY_RX 0x21       // Mercury received: {hex}
+#define TRACE_MERCURY_BAD_CRC 0x22  // Mercury invalid response, real CRC 0x{0:04X}
+
+#endif // TRACE_EVENTS_H